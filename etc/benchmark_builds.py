@@ -0,0 +1,365 @@
+#!/usr/bin/env python3
+"""Compare the run time and memory of two OpenROAD builds.
+
+Each benchmark script (by default the flow tests in test/) is run several
+times with a baseline and a candidate ``openroad`` binary, alternating
+between the two so that drifting machine load hits both builds alike.
+Every run records:
+
+* the wall time and peak RSS of the ``openroad`` process, and
+* the time spent in each engine, taken from the utl trace spans
+  (``odb::read``, ``gpl::nesterovPlace``, ``grt::globalRoute``, the drt
+  ``ProfileTask`` phases such as ``DR:main``, ``psm::analyzePowerGrid``,
+  ...) that the run writes with ``write_trace``.  Each binary is probed for the trace commands
+  first; builds without them only report wall time and memory.
+
+A metric is reported as a regression or an improvement only when Welch's
+t-test rejects equal means at the requested significance level, so noise
+from a handful of runs is not flagged.  All imports are from the Python
+standard library::
+
+    python3 etc/benchmark_builds.py \\
+        --baseline build_main/bin/openroad \\
+        --candidate build/bin/openroad \\
+        --runs 5 gcd_nangate45 aes_nangate45
+
+Exits with status 1 if any metric regressed significantly.
+"""
+
+import argparse
+import json
+import math
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+DEFAULT_SCRIPTS = ["gcd_nangate45"]
+
+
+def _build_parser():
+    parser = argparse.ArgumentParser(
+        description="Compare the run time and peak memory of two builds."
+    )
+    parser.add_argument(
+        "--baseline", required=True, help="openroad binary to compare against"
+    )
+    parser.add_argument(
+        "--candidate", required=True, help="openroad binary under test"
+    )
+    parser.add_argument(
+        "--runs", type=int, default=5, help="runs per build (default 5)"
+    )
+    parser.add_argument(
+        "--threads", type=int, default=1, help="-threads passed to openroad"
+    )
+    parser.add_argument(
+        "--alpha",
+        type=float,
+        default=0.05,
+        help="significance level of the t-test (default 0.05)",
+    )
+    parser.add_argument(
+        "--min_delta",
+        type=float,
+        default=2.0,
+        help="ignore deltas smaller than this percentage (default 2)",
+    )
+    parser.add_argument(
+        "--test_dir",
+        default=os.path.join(
+            os.path.dirname(os.path.abspath(__file__)), "..", "test"
+        ),
+        help="directory the scripts are run from (default test/)",
+    )
+    parser.add_argument(
+        "--json", help="also write the raw samples and results to this file"
+    )
+    parser.add_argument(
+        "scripts",
+        nargs="*",
+        default=DEFAULT_SCRIPTS,
+        help="test names or Tcl scripts to run (default gcd_nangate45)",
+    )
+    return parser
+
+
+# ---------------------------------------------------------------------------
+# Statistics
+# ---------------------------------------------------------------------------
+
+
+def _betacf(a, b, x):
+    """Continued fraction of the incomplete beta function (modified Lentz)."""
+    tiny = 1e-300
+    qab = a + b
+    qap = a + 1.0
+    qam = a - 1.0
+    c = 1.0
+    d = 1.0 - qab * x / qap
+    d = tiny if abs(d) < tiny else d
+    d = 1.0 / d
+    h = d
+    for m in range(1, 301):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        d = tiny if abs(d) < tiny else d
+        c = 1.0 + aa / c
+        c = tiny if abs(c) < tiny else c
+        d = 1.0 / d
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        d = tiny if abs(d) < tiny else d
+        c = 1.0 + aa / c
+        c = tiny if abs(c) < tiny else c
+        d = 1.0 / d
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1e-12:
+            break
+    return h
+
+
+def regularized_beta(a, b, x):
+    """I_x(a, b), the regularized incomplete beta function."""
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    log_front = (
+        math.lgamma(a + b)
+        - math.lgamma(a)
+        - math.lgamma(b)
+        + a * math.log(x)
+        + b * math.log1p(-x)
+    )
+    front = math.exp(log_front)
+    # The continued fraction converges quickly only below the mean.
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * _betacf(a, b, x) / a
+    return 1.0 - front * _betacf(b, a, 1.0 - x) / b
+
+
+def welch_t_test(a, b):
+    """Returns (t, two sided p-value) of Welch's unequal variance t-test."""
+    if len(a) < 2 or len(b) < 2:
+        return 0.0, 1.0
+    mean_a = statistics.fmean(a)
+    mean_b = statistics.fmean(b)
+    se2_a = statistics.variance(a) / len(a)
+    se2_b = statistics.variance(b) / len(b)
+    se2 = se2_a + se2_b
+    if se2 == 0.0:
+        if mean_a == mean_b:
+            return 0.0, 1.0
+        return math.copysign(math.inf, mean_b - mean_a), 0.0
+    t = (mean_b - mean_a) / math.sqrt(se2)
+    df = se2 * se2 / (
+        se2_a * se2_a / (len(a) - 1) + se2_b * se2_b / (len(b) - 1)
+    )
+    p = regularized_beta(df / 2.0, 0.5, df / (df + t * t))
+    return t, p
+
+
+# ---------------------------------------------------------------------------
+# Running
+# ---------------------------------------------------------------------------
+
+
+def resolve_script(test_dir, script):
+    """Maps a test name such as gcd_nangate45 to its Tcl script."""
+    if os.path.isfile(script):
+        return os.path.abspath(script)
+    path = os.path.join(test_dir, script + ".tcl")
+    if os.path.isfile(path):
+        return os.path.abspath(path)
+    sys.exit(f"Error: cannot find benchmark script {script}")
+
+
+def engine_times(trace_file):
+    """Sums the trace spans of the main thread by name, in seconds.
+
+    Spans of worker threads are skipped; they overlap the main thread span
+    that launched them and would count the same time twice.
+    """
+    try:
+        with open(trace_file) as f:
+            events = json.load(f)["traceEvents"]
+    except (OSError, ValueError, KeyError):
+        return {}
+    main_tids = {
+        event["tid"]
+        for event in events
+        if event.get("ph") == "M" and event["args"]["name"] == "main"
+    }
+    times = {}
+    for event in events:
+        if event.get("ph") == "X" and event["tid"] in main_tids:
+            name = event["name"]
+            times[name] = times.get(name, 0.0) + event["dur"] / 1e6
+    return times
+
+
+def supports_trace(binary, work_dir):
+    """Returns whether binary provides the utl trace commands.
+
+    Builds that predate them would fail on start_trace.
+    """
+    probe = os.path.join(work_dir, "probe.tcl")
+    with open(probe, "w") as f:
+        f.write("puts [llength [info commands write_trace]]\n")
+    result = subprocess.run(
+        [binary, "-no_init", "-no_splash", "-exit", probe],
+        capture_output=True,
+        text=True,
+    )
+    lines = result.stdout.split()
+    return result.returncode == 0 and bool(lines) and lines[-1] == "1"
+
+
+def run_once(binary, script, opt, work_dir, trace):
+    """Runs script once and returns its metrics as {name: value}."""
+    trace_file = os.path.join(work_dir, "trace.json")
+    log_file = os.path.join(work_dir, "run.log")
+    wrapper = os.path.join(work_dir, "benchmark.tcl")
+    with open(wrapper, "w") as f:
+        if trace:
+            f.write("start_trace\n")
+        f.write(f"source {{{script}}}\n")
+        if trace:
+            f.write("stop_trace\n")
+            f.write(f"write_trace {{{trace_file}}}\n")
+    if os.path.exists(trace_file):
+        os.remove(trace_file)
+
+    command = [
+        binary,
+        "-no_init",
+        "-no_splash",
+        "-exit",
+        "-threads",
+        str(opt.threads),
+        wrapper,
+    ]
+    with open(log_file, "w") as log:
+        start = time.perf_counter()
+        process = subprocess.Popen(
+            command, cwd=os.path.dirname(script), stdout=log, stderr=log
+        )
+        # wait4 gives the rusage of this child alone.
+        _, status, usage = os.wait4(process.pid, 0)
+        wall = time.perf_counter() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        # The log is in work_dir, which is removed on exit.
+        with open(log_file) as log:
+            tail = "".join(log.readlines()[-20:])
+        sys.exit(
+            f"{tail}\nError: {binary} failed on {script} with status"
+            f" {process.returncode}"
+        )
+
+    # ru_maxrss is in KiB on Linux
+    metrics = {"wall_s": wall, "peak_rss_mb": usage.ru_maxrss / 1024.0}
+    for name, seconds in engine_times(trace_file).items():
+        metrics[name + "_s"] = seconds
+    return metrics
+
+
+def compare(baseline, candidate, opt):
+    """Returns one result row per metric seen in both builds."""
+    rows = []
+    for name in sorted(set(baseline) & set(candidate)):
+        a = baseline[name]
+        b = candidate[name]
+        mean_a = statistics.fmean(a)
+        mean_b = statistics.fmean(b)
+        delta = 100.0 * (mean_b - mean_a) / mean_a if mean_a else 0.0
+        _, p = welch_t_test(a, b)
+        verdict = ""
+        if p < opt.alpha and abs(delta) >= opt.min_delta:
+            # Lower is better for every metric collected.
+            verdict = "regressed" if delta > 0 else "improved"
+        rows.append(
+            {
+                "metric": name,
+                "baseline": mean_a,
+                "baseline_stdev": statistics.stdev(a) if len(a) > 1 else 0.0,
+                "candidate": mean_b,
+                "candidate_stdev": statistics.stdev(b) if len(b) > 1 else 0.0,
+                "delta_pct": delta,
+                "p_value": p,
+                "verdict": verdict,
+            }
+        )
+    return rows
+
+
+def print_rows(script, rows):
+    print(f"\n{os.path.basename(script)}")
+    print(
+        f"{'metric':32} {'baseline':>18} {'candidate':>18}"
+        f" {'delta':>8} {'p':>7}"
+    )
+    for row in rows:
+        print(
+            f"{row['metric']:32}"
+            f" {row['baseline']:10.3f} ±{row['baseline_stdev']:7.3f}"
+            f" {row['candidate']:10.3f} ±{row['candidate_stdev']:7.3f}"
+            f" {row['delta_pct']:+7.1f}% {row['p_value']:7.4f} {row['verdict']}"
+        )
+
+
+def main(args=None):
+    opt = _build_parser().parse_args(args)
+    if opt.runs < 2:
+        sys.exit("Error: --runs must be at least 2 for the t-test")
+    binaries = {"baseline": opt.baseline, "candidate": opt.candidate}
+    for binary in binaries.values():
+        if not os.access(binary, os.X_OK):
+            sys.exit(f"Error: {binary} is not executable")
+
+    report = {}
+    regressed = False
+    with tempfile.TemporaryDirectory(prefix="benchmark_") as work_dir:
+        trace = {}
+        for build, binary in binaries.items():
+            trace[build] = supports_trace(binary, work_dir)
+            if not trace[build]:
+                print(
+                    f"Warning: {binary} has no write_trace; only wall time"
+                    " and memory are compared",
+                    file=sys.stderr,
+                )
+        for script in opt.scripts:
+            script = resolve_script(opt.test_dir, script)
+            samples = {"baseline": {}, "candidate": {}}
+            for run in range(opt.runs):
+                for build, binary in binaries.items():
+                    print(
+                        f"{os.path.basename(script)} run {run + 1}/{opt.runs}"
+                        f" {build}",
+                        file=sys.stderr,
+                    )
+                    metrics = run_once(
+                        binary, script, opt, work_dir, trace[build]
+                    )
+                    for name, value in metrics.items():
+                        samples[build].setdefault(name, []).append(value)
+            rows = compare(samples["baseline"], samples["candidate"], opt)
+            print_rows(script, rows)
+            regressed |= any(row["verdict"] == "regressed" for row in rows)
+            report[script] = {"samples": samples, "results": rows}
+
+    if opt.json:
+        with open(opt.json, "w") as f:
+            json.dump(report, f, indent=2)
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
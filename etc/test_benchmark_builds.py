@@ -0,0 +1,96 @@
+import argparse
+import json
+import os
+import tempfile
+from unittest import TestCase
+
+import benchmark_builds
+
+default_args = argparse.Namespace(alpha=0.05, min_delta=2.0)
+
+
+class TestStatistics(TestCase):
+    def test_regularized_beta(self):
+        # I_x(2, 3) = 6x^2 - 8x^3 + 3x^4
+        x = 0.4
+        expected = 6 * x**2 - 8 * x**3 + 3 * x**4
+        self.assertAlmostEqual(benchmark_builds.regularized_beta(2, 3, x), expected)
+        self.assertEqual(benchmark_builds.regularized_beta(2, 3, 0.0), 0.0)
+        self.assertEqual(benchmark_builds.regularized_beta(2, 3, 1.0), 1.0)
+
+    def test_welch_t_test(self):
+        # Reference values from scipy.stats.ttest_ind(equal_var=False)
+        t, p = benchmark_builds.welch_t_test(
+            [10, 11, 12, 13, 14], [12, 13, 14, 15, 16.5]
+        )
+        self.assertAlmostEqual(t, 1.99323, places=4)
+        self.assertAlmostEqual(p, 0.08172, places=4)
+
+    def test_welch_t_test_identical(self):
+        t, p = benchmark_builds.welch_t_test([5, 5, 5], [5, 5, 5])
+        self.assertEqual(t, 0.0)
+        self.assertEqual(p, 1.0)
+
+    def test_welch_t_test_too_few_samples(self):
+        self.assertEqual(benchmark_builds.welch_t_test([1], [2, 3]), (0.0, 1.0))
+
+
+class TestCompare(TestCase):
+    def test_regression_flagged(self):
+        baseline = {"wall_s": [10.0, 10.1, 9.9, 10.0, 10.05]}
+        candidate = {"wall_s": [12.0, 12.1, 11.9, 12.0, 12.05]}
+        (row,) = benchmark_builds.compare(baseline, candidate, default_args)
+        self.assertEqual(row["verdict"], "regressed")
+        self.assertAlmostEqual(row["delta_pct"], 20.0, places=1)
+
+    def test_improvement_flagged(self):
+        baseline = {"peak_rss_mb": [200.0, 201.0, 199.0]}
+        candidate = {"peak_rss_mb": [150.0, 151.0, 149.0]}
+        (row,) = benchmark_builds.compare(baseline, candidate, default_args)
+        self.assertEqual(row["verdict"], "improved")
+
+    def test_noise_not_flagged(self):
+        baseline = {"wall_s": [10.0, 12.0, 9.0, 11.0]}
+        candidate = {"wall_s": [11.0, 9.5, 12.0, 10.0]}
+        (row,) = benchmark_builds.compare(baseline, candidate, default_args)
+        self.assertEqual(row["verdict"], "")
+
+    def test_small_delta_not_flagged(self):
+        baseline = {"wall_s": [10.0, 10.001, 10.0]}
+        candidate = {"wall_s": [10.05, 10.051, 10.05]}
+        (row,) = benchmark_builds.compare(baseline, candidate, default_args)
+        self.assertEqual(row["verdict"], "")
+
+    def test_only_common_metrics(self):
+        baseline = {"wall_s": [1.0, 1.0], "gpl::nesterovPlace_s": [1.0, 1.0]}
+        candidate = {"wall_s": [1.0, 1.0]}
+        rows = benchmark_builds.compare(baseline, candidate, default_args)
+        self.assertEqual([row["metric"] for row in rows], ["wall_s"])
+
+
+class TestEngineTimes(TestCase):
+    def test_sums_main_thread_spans(self):
+        trace = {
+            "traceEvents": [
+                {"name": "thread_name", "ph": "M", "tid": 0, "args": {"name": "main"}},
+                {
+                    "name": "thread_name",
+                    "ph": "M",
+                    "tid": 1,
+                    "args": {"name": "thread 1"},
+                },
+                {"name": "grt::globalRoute", "ph": "X", "tid": 0, "dur": 1500000},
+                {"name": "grt::globalRoute", "ph": "X", "tid": 0, "dur": 500000},
+                {"name": "worker", "ph": "X", "tid": 1, "dur": 1000000},
+                {"name": "rss_mb", "ph": "C", "tid": 0, "args": {"value": 1}},
+            ]
+        }
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "trace.json")
+            with open(path, "w") as f:
+                json.dump(trace, f)
+            times = benchmark_builds.engine_times(path)
+        self.assertEqual(times, {"grt::globalRoute": 2.0})
+
+    def test_missing_trace(self):
+        self.assertEqual(benchmark_builds.engine_times("/nonexistent/trace.json"), {})
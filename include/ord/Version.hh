@@ -0,0 +1,5 @@
+#define OPENROAD_VERSION "182ae6e1f66f20cde2787750c780cb41d774b072"
+
+#define OPENROAD_GIT_DESCRIBE ""
+
+/* #undef BUILD_OPENPHYSYN */
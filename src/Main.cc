@@ -41,6 +41,7 @@
 #include "sta/StaMain.hh"
 #include "sta/StringUtil.hh"
 #include "utl/Logger.h"
+#include "utl/PerfCounters.h"
 #include "utl/decode.h"
 #include "web/web.h"
 
@@ -102,11 +103,13 @@ static bool no_settings = false;
 static bool minimize = false;
 static bool web_enabled = false;
 static const char* web_port_arg = nullptr;
+static bool perf_counters = false;
 
 static const char* init_filename = ".openroad";
 
 static void showUsage(const char* prog, const char* init_filename);
 static void showSplash();
+static void startPerfCounters();
 
 #ifdef ENABLE_PYTHON3
 #define X(name)                                \
@@ -256,6 +259,12 @@ int main(int argc, char* argv[])
     std::filesystem::remove(metrics_filename, err_ignored);
   }
 
+  // Opened before any worker thread exists so that they are all counted.
+  perf_counters = findCmdLineFlag(argc, argv, "-perf_counters");
+  if (perf_counters) {
+    utl::PerfCounters::open();
+  }
+
   read_odb_filename = findCmdLineKey(argc, argv, "-db");
   no_settings = findCmdLineFlag(argc, argv, "-no_settings");
   minimize = findCmdLineFlag(argc, argv, "-minimize");
@@ -278,6 +287,9 @@ int main(int argc, char* argv[])
     if (!findCmdLineFlag(cmd_argc, cmd_argv, "-no_splash")) {
       showSplash();
     }
+    if (perf_counters) {
+      startPerfCounters();
+    }
 
     utl::Logger* logger = ord::OpenRoad::openRoad()->getLogger();
     if (findCmdLineFlag(cmd_argc, cmd_argv, "-gui")) {
@@ -406,6 +418,9 @@ static int tclAppInit(int& argc,
     if (!no_splash) {
       showSplash();
     }
+    if (perf_counters) {
+      startPerfCounters();
+    }
 
     const char* threads = findCmdLineKey(argc, argv, "-threads");
     if (threads) {
@@ -547,7 +562,7 @@ static void showUsage(const char* prog, const char* init_filename)
   printf("Usage: %s [-help] [-version] [-no_init] [-no_splash] [-exit] ", prog);
   printf("[-gui] [-web] [-threads count|max] [-log file_name] ");
   printf("[-metrics file_name] [-db file_name] [-no_settings] [-minimize] ");
-  printf("cmd_file\n");
+  printf("[-perf_counters] cmd_file\n");
   printf("  -help                 show help and exit\n");
   printf("  -version              show version and exit\n");
   printf("  -no_init              do not read %s init file\n", init_filename);
@@ -568,9 +583,23 @@ static void showUsage(const char* prog, const char* init_filename)
   printf(
       "  -metrics <file_name>  write metrics in <file_name> in JSON format\n");
   printf("  -db <file_name>      open a .odb database at startup\n");
+  printf(
+      "  -perf_counters        count hardware events of all threads from "
+      "startup\n");
   printf("  cmd_file              source cmd_file\n");
 }
 
+static void startPerfCounters()
+{
+  utl::Logger* logger = ord::OpenRoad::openRoad()->getLogger();
+  if (!utl::PerfCounters::start(logger)) {
+    logger->warn(utl::ORD,
+                 105,
+                 "Hardware performance counters are not available "
+                 "(check /proc/sys/kernel/perf_event_paranoid).");
+  }
+}
+
 static void showSplash()
 {
   utl::Logger* logger = ord::OpenRoad::openRoad()->getLogger();
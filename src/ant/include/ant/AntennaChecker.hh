@@ -43,6 +43,10 @@ class AntennaChecker
   // Used in repair
   void initAntennaRules();
   void makeNetWiresFromGuides(const std::vector<odb::dbNet*>& nets);
+  // getAntennaViolations reuses the result of a net whose wire and pins
+  // did not change since it was last checked.
+  int getNetCacheHits() const;
+  int getNetCacheMisses() const;
 
  private:
   class Impl;
@@ -4,10 +4,12 @@
 #include "ant/AntennaChecker.hh"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -31,6 +33,7 @@
 #include "odb/geom.h"
 #include "omp.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/unionFind.h"
 
 namespace ant {
@@ -74,6 +77,7 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
                                   int num_threads,
                                   bool verbose)
 {
+  utl::TraceScope trace("ant::checkAntennas");
   return impl_->checkAntennas(net, num_threads, verbose);
 }
 
@@ -105,6 +109,16 @@ void AntennaChecker::initAntennaRules()
   impl_->initAntennaRules();
 }
 
+int AntennaChecker::getNetCacheHits() const
+{
+  return impl_->getNetCacheHits();
+}
+
+int AntennaChecker::getNetCacheMisses() const
+{
+  return impl_->getNetCacheMisses();
+}
+
 //////////////////////////////////////////////////
 
 AntennaChecker::Impl::Impl(odb::dbDatabase* db, utl::Logger* logger)
@@ -114,7 +128,13 @@ AntennaChecker::Impl::Impl(odb::dbDatabase* db, utl::Logger* logger)
 
 void AntennaChecker::Impl::initAntennaRules()
 {
-  block_ = db_->getChip()->getBlock();
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  // The cached net results hold pointers into the block they were computed
+  // on.  The callback loses its owner when that block is destroyed.
+  if (block != block_ || !net_results_cbk_.hasOwner()) {
+    resetNetResults(block);
+  }
+  block_ = block;
   odb::dbTech* tech = db_->getTech();
   // initialize nets_to_report_ with all nets to avoid issues with
   // multithreading
@@ -1181,11 +1201,90 @@ Violations AntennaChecker::Impl::getAntennaViolations(odb::dbNet* net,
     return antenna_violations;
   }
 
+  const size_t route_version = netRouteVersion(net);
+  {
+    absl::MutexLock lock(&net_results_mutex_);
+    auto cached = net_results_.find(net);
+    if (cached != net_results_.end()
+        && cached->second.route_version == route_version
+        && cached->second.diode_mterm == diode_mterm
+        && cached->second.ratio_margin == ratio_margin) {
+      net_cache_hits_++;
+      return cached->second.violations;
+    }
+    net_cache_misses_++;
+  }
+
   checkNet(net, false, false, diode_mterm, ratio_margin, antenna_violations);
 
+  absl::MutexLock lock(&net_results_mutex_);
+  net_results_[net] = {.route_version = route_version,
+                       .diode_mterm = diode_mterm,
+                       .ratio_margin = ratio_margin,
+                       .violations = antenna_violations};
+
   return antenna_violations;
 }
 
+// Hashes everything checkNet reads from the net: the wire and the placed
+// pins it connects.  Diodes added by repair show up as new iterms.
+size_t AntennaChecker::Impl::netRouteVersion(odb::dbNet* net)
+{
+  size_t version = 0;
+
+  odb::dbWire* wire = net->getWire();
+  if (wire) {
+    const int length = wire->length();
+    for (int i = 0; i < length; i++) {
+      odb::hash_combine(version, wire->getOpcode(i));
+      odb::hash_combine(version, wire->getData(i));
+    }
+  }
+
+  for (odb::dbITerm* iterm : net->getITerms()) {
+    odb::dbInst* inst = iterm->getInst();
+    odb::hash_combine(version, iterm->getId());
+    odb::hash_combine(version, std::hash<odb::dbMaster*>{}(inst->getMaster()));
+    odb::hash_combine(version, std::hash<odb::Point>{}(inst->getLocation()));
+    odb::hash_combine(version, inst->getOrient().getValue());
+  }
+
+  return version;
+}
+
+void AntennaChecker::Impl::resetNetResults(odb::dbBlock* block)
+{
+  absl::MutexLock lock(&net_results_mutex_);
+  net_results_.clear();
+  net_results_cbk_.removeOwner();
+  if (block != nullptr) {
+    net_results_cbk_.addOwner(block);
+  }
+}
+
+void AntennaChecker::Impl::eraseNetResult(odb::dbNet* net)
+{
+  absl::MutexLock lock(&net_results_mutex_);
+  net_results_.erase(net);
+}
+
+void AntennaChecker::Impl::NetResultsCallback::inDbNetDestroy(odb::dbNet* net)
+{
+  impl_->eraseNetResult(net);
+}
+
+int AntennaChecker::Impl::getNetCacheHits() const
+{
+  absl::MutexLock lock(&net_results_mutex_);
+  return net_cache_hits_;
+}
+
+int AntennaChecker::Impl::getNetCacheMisses() const
+{
+  absl::MutexLock lock(&net_results_mutex_);
+  return net_cache_misses_;
+}
+
 bool AntennaChecker::Impl::designIsPlaced()
 {
   for (odb::dbBTerm* bterm : block_->getBTerms()) {
@@ -61,6 +61,18 @@ check_net_violation(char* net_name)
     return false;
 }
 
+int
+get_net_cache_hits()
+{
+  return getAntennaChecker()->getNetCacheHits();
+}
+
+int
+get_net_cache_misses()
+{
+  return getAntennaChecker()->getNetCacheMisses();
+}
+
 void
 set_report_file_name(char* file_name)
 {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <fstream>
 #include <map>
 #include <memory>
@@ -15,6 +16,7 @@
 #include "ant/AntennaChecker.hh"
 #include "odb/PtrSetMap.h"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/dbWireGraph.h"
 
 namespace utl {
@@ -96,8 +98,35 @@ class AntennaChecker::Impl
   void initAntennaRules();
   void setReportFileName(const char* file_name);
   void makeNetWiresFromGuides(const std::vector<odb::dbNet*>& nets);
+  int getNetCacheHits() const;
+  int getNetCacheMisses() const;
 
  private:
+  // Result of getAntennaViolations for one net, valid while the net's route
+  // version and the check parameters are unchanged.
+  struct NetCheckResult
+  {
+    size_t route_version;
+    odb::dbMTerm* diode_mterm;
+    float ratio_margin;
+    Violations violations;
+  };
+
+  // Drops the cached result of a destroyed net so that a net created later
+  // at the same address is checked again.
+  class NetResultsCallback : public odb::dbBlockCallBackObj
+  {
+   public:
+    explicit NetResultsCallback(Impl* impl) : impl_(impl) {}
+    void inDbNetDestroy(odb::dbNet* net) override;
+
+   private:
+    Impl* impl_;
+  };
+
+  static size_t netRouteVersion(odb::dbNet* net);
+  void resetNetResults(odb::dbBlock* block);
+  void eraseNetResult(odb::dbNet* net);
   bool haveRoutedNets();
   bool designIsPlaced();
   bool haveGuides();
@@ -180,6 +209,11 @@ class AntennaChecker::Impl
   std::vector<odb::dbNet*> nets_;
   odb::PtrMap<odb::dbNet, ViolationReport> net_to_report_;
   absl::Mutex map_mutex_;
+  odb::PtrMap<odb::dbNet, NetCheckResult> net_results_;
+  int net_cache_hits_{0};
+  int net_cache_misses_{0};
+  mutable absl::Mutex net_results_mutex_;
+  NetResultsCallback net_results_cbk_{this};
   // consts
   static constexpr int kMaxDiodeCountPerGate = 10;
 };
@@ -0,0 +1,44 @@
+# A net whose route changes between two checks, as when repair_antennas
+# re-routes it between iterations, is checked again instead of reusing
+# its cached result.
+source "helpers.tcl"
+read_lef merged_spacing.lef
+read_def sw130_random.def
+
+check_antennas
+
+# Checks net_name and compares the result and whether it came from the
+# cache with the expected ones.
+proc check_net { net_name expected_violation expected_hit } {
+  set hits [ant::get_net_cache_hits]
+  set misses [ant::get_net_cache_misses]
+  set violation [ant::check_net_violation $net_name]
+  set hit [expr { [ant::get_net_cache_hits] - $hits }]
+  set miss [expr { [ant::get_net_cache_misses] - $misses }]
+  puts "$net_name: violation $violation, cache hits $hit, misses $miss"
+  if { $violation != $expected_violation } {
+    error "$net_name: expected violation $expected_violation, got $violation"
+  }
+  if { $hit != $expected_hit || $miss != !$expected_hit } {
+    error "$net_name: expected cache hit $expected_hit"
+  }
+}
+
+set net_name "net50"
+set net [[ord::get_db_block] findNet $net_name]
+
+check_net $net_name 1 0
+check_net $net_name 1 1
+
+# Rip up the route.
+set wire [$net getWire]
+$wire detach
+check_net $net_name 0 0
+check_net $net_name 0 1
+
+# Route the net again.
+$wire attach $net
+check_net $net_name 1 0
+check_net $net_name 1 1
+
+puts pass
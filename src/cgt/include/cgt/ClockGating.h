@@ -23,6 +23,11 @@ class ClockGating
   void setMaxCover(int max_cover);
   void setDumpDir(const char* dir);
 
+  // Number of candidate gating conditions that were disproved by random
+  // simulation and by SAT.
+  int getRejectedSimCount() const;
+  int getRejectedSatCount() const;
+
  private:
   class Impl;
   std::unique_ptr<Impl> impl_;
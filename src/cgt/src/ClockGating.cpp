@@ -7,6 +7,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -100,6 +102,16 @@ void ClockGating::setDumpDir(const char* dir)
 {
 }
 
+int ClockGating::getRejectedSimCount() const
+{
+  return impl_->getRejectedSimCount();
+}
+
+int ClockGating::getRejectedSatCount() const
+{
+  return impl_->getRejectedSatCount();
+}
+
 //////////////////////////////////////////////////
 
 ClockGating::Impl::Impl(utl::Logger* const logger, sta::dbSta* const sta)
@@ -1145,40 +1157,72 @@ utl::UniquePtrWithDeleter<abc::Abc_Ntk_t> ClockGating::Impl::makeTestNetwork(
   }
 }
 
+// Simulates the strashed test network on kSimWords * 64 random patterns at
+// once, one bit per pattern.  Any set output bit is a counterexample.
 bool ClockGating::Impl::simulationTest(abc::Abc_Ntk_t* const abc_network,
                                        const std::string& combined_gate_name)
 {
   DebugScopedTimer timer(
       sim_time_, logger_, CGT, "clock_gating", 3, "Simulation time: {}");
+  assert(abc::Abc_NtkIsStrash(abc_network));
+
+  constexpr int kSimWords = 4;
+  std::vector<uint64_t> sim_values(
+      static_cast<size_t>(abc::Abc_NtkObjNumMax(abc_network)) * kSimWords);
+  auto values = [&sim_values](abc::Abc_Obj_t* obj) {
+    return &sim_values[static_cast<size_t>(abc::Abc_ObjId(obj)) * kSimWords];
+  };
+  auto complement = [](const int is_complemented) {
+    return is_complemented ? ~uint64_t{0} : uint64_t{0};
+  };
+
+  std::fill_n(values(abc::Abc_AigConst1(abc_network)), kSimWords, ~uint64_t{0});
+
   abc::Abc_Obj_t* obj;
   int idx;
-  std::vector<int> sim_input;
-  for (int i = 0; i < 10; i++) {
-    Abc_NtkForEachPi(abc_network, obj, idx)
-    {
-      sim_input.resize(idx + 1);
-      sim_input[idx] = rand_bits_.get();
-      debugPrint(logger_,
-                 CGT,
-                 "clock_gating",
-                 5,
-                 "Input: {} == {}",
-                 abc::Abc_ObjName(obj),
-                 sim_input[idx]);
+  Abc_NtkForEachCi(abc_network, obj, idx)
+  {
+    uint64_t* input = values(obj);
+    for (int word = 0; word < kSimWords; word++) {
+      input[word] = rand_bits_.getWord();
     }
+    debugPrint(logger_,
+               CGT,
+               "clock_gating",
+               5,
+               "Input: {} == {:#018x}",
+               abc::Abc_ObjName(obj),
+               input[0]);
+  }
 
-    UniquePtrWithDeleter<int> sim_output(
-        abc::Abc_NtkVerifySimulatePattern(abc_network, sim_input.data()),
-        &free);
-    if (*sim_output) {
-      debugPrint(logger_,
-                 CGT,
-                 "clock_gating",
-                 4,
-                 "Clock gate signal '{}' is not valid (simulation test)",
-                 combined_gate_name);
-      rejected_sim_count_++;
-      return false;
+  // AIG nodes are stored in topological order.
+  Abc_NtkForEachNode(abc_network, obj, idx)
+  {
+    const uint64_t* fanin0 = values(abc::Abc_ObjFanin0(obj));
+    const uint64_t* fanin1 = values(abc::Abc_ObjFanin1(obj));
+    const uint64_t compl0 = complement(abc::Abc_ObjFaninC0(obj));
+    const uint64_t compl1 = complement(abc::Abc_ObjFaninC1(obj));
+    uint64_t* output = values(obj);
+    for (int word = 0; word < kSimWords; word++) {
+      output[word] = (fanin0[word] ^ compl0) & (fanin1[word] ^ compl1);
+    }
+  }
+
+  Abc_NtkForEachCo(abc_network, obj, idx)
+  {
+    const uint64_t* fanin0 = values(abc::Abc_ObjFanin0(obj));
+    const uint64_t compl0 = complement(abc::Abc_ObjFaninC0(obj));
+    for (int word = 0; word < kSimWords; word++) {
+      if (fanin0[word] ^ compl0) {
+        debugPrint(logger_,
+                   CGT,
+                   "clock_gating",
+                   4,
+                   "Clock gate signal '{}' is not valid (simulation test)",
+                   combined_gate_name);
+        rejected_sim_count_++;
+        return false;
+      }
     }
   }
   return true;
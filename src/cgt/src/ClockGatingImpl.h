@@ -48,6 +48,9 @@ class ClockGating::Impl
   void setMaxCover(int max_cover) { max_cover_ = max_cover; }
   void setDumpDir(const char* dir);
 
+  int getRejectedSimCount() const { return rejected_sim_count_; }
+  int getRejectedSatCount() const { return rejected_sat_count_; }
+
  private:
   // Searches for a minimal set of nets that can form a gating condition for the
   // given instances. The given range of candidate nets (begin-end) is divided
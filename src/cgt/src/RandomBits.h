@@ -25,6 +25,14 @@ class RandomBits
     return bit;
   }
 
+  // Returns 64 random bits, e.g. one bit per pattern of a bit-parallel
+  // simulation.
+  uint64_t getWord()
+  {
+    const uint64_t high = generator_();
+    return (high << 32) | generator_();
+  }
+
  private:
   std::mt19937 generator_;
   uint32_t bit_buffer_ = 0;
@@ -44,4 +44,16 @@ clock_gating_cmd(const char* dump_dir)
   cgt->run();
 }
 
+int
+get_rejected_sim_count()
+{
+  return getClockGating()->getRejectedSimCount();
+}
+
+int
+get_rejected_sat_count()
+{
+  return getClockGating()->getRejectedSatCount();
+}
+
 %}
@@ -0,0 +1,29 @@
+# Candidate gating conditions that random simulation disproves are rejected
+# before SAT, and the accepted clock gate is the same as with SAT alone.
+source "helpers.tcl"
+read_liberty asap7/asap7sc7p5t_AO_RVT_FF_nldm_211120.lib.gz
+read_liberty asap7/asap7sc7p5t_INVBUF_RVT_FF_nldm_220122.lib.gz
+read_liberty asap7/asap7sc7p5t_OA_RVT_FF_nldm_211120.lib.gz
+read_liberty asap7/asap7sc7p5t_SEQ_RVT_FF_nldm_220123.lib
+read_liberty asap7/asap7sc7p5t_SIMPLE_RVT_FF_nldm_211120.lib.gz
+read_lef asap7/asap7_tech_1x_201209.lef
+read_lef asap7/asap7sc7p5t_28_R_1x_220121a.lef
+read_verilog countdown_asap7.v
+link_design countdown
+create_clock [get_ports clk] -name clock -period 0.5
+clock_gating -min_instances 1
+
+set rejected_sim [cgt::get_rejected_sim_count]
+set rejected_sat [cgt::get_rejected_sat_count]
+puts "Rejected at simulation: $rejected_sim, at SAT: $rejected_sat"
+if { $rejected_sim == 0 } {
+  error "no gating condition was rejected by simulation"
+}
+
+set verilog_file [make_result_file countdown_sim_reject_gated.v]
+write_verilog $verilog_file
+if { [diff_files countdown_asap7_gated.vok $verilog_file] } {
+  error "the accepted clock gates changed"
+}
+
+puts pass
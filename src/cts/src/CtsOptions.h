@@ -107,6 +107,8 @@ class CtsOptions : public odb::dbBlockCallBackObj
   int getCapSteps() const { return capSteps_; }
   void setSlewSteps(int steps) { slewSteps_ = steps; }
   int getSlewSteps() const { return slewSteps_; }
+  void setCharCacheFile(const std::string& file) { charCacheFile_ = file; }
+  std::string getCharCacheFile() const { return charCacheFile_; }
   void setClockTreeMaxDepth(unsigned depth) { clockTreeMaxDepth_ = depth; }
   unsigned getClockTreeMaxDepth() const { return clockTreeMaxDepth_; }
   void setEnableFakeLutEntries(bool enable) { enableFakeLutEntries_ = enable; }
@@ -363,6 +365,7 @@ class CtsOptions : public odb::dbBlockCallBackObj
   double maxCharCap_ = 0;
   int capSteps_ = 20;
   int slewSteps_ = 7;
+  std::string charCacheFile_;
   unsigned charWirelengthIterations_ = 4;
   double sinkBufferInputCap_ = 0;
   unsigned clockTreeMaxDepth_ = 100;
@@ -8,6 +8,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -35,6 +36,110 @@ Point<double> HTreeBuilder::legalizeOneBuffer(Point<double> bufferLoc,
   return resolveLocationCollision(legalLoc);
 }
 
+HTreeBuilder::~HTreeBuilder() = default;
+
+void HTreeBuilder::mapSinkLocations()
+{
+  if (sinkLocationsMapped_) {
+    return;
+  }
+  clock_.forEachSink([&](ClockInst& inst) {
+    const Point<double> normLocation((float) inst.getX() / wireSegmentUnit_,
+                                     (float) inst.getY() / wireSegmentUnit_);
+    mapLocationToSink_[normLocation] = &inst;
+    if (!fuzzyEqual(inst.getInsertionDelay(), 0.0, 1e-6)) {
+      setSinkInsertionDelay(normLocation,
+                            inst.getInsertionDelay() / wireSegmentUnit_);
+      // clang-format off
+      debugPrint(logger_, CTS, "clustering", 1, "sink {} has insDelay {} at {}",
+                 inst.getName(), getSinkInsertionDelay(normLocation),
+                 normLocation);
+      // clang-format on
+    }
+  });
+  sinkLocationsMapped_ = true;
+}
+
+float HTreeBuilder::topLevelMaxDiameter() const
+{
+  const double clusterDiameter = (type_ == TreeType::MacroTree)
+                                     ? options_->getMacroMaxDiameter()
+                                     : options_->getMaxDiameter();
+  return (clusterDiameter * options_->getDbUnits()) / wireSegmentUnit_;
+}
+
+unsigned HTreeBuilder::topLevelClusterSize() const
+{
+  return (type_ == TreeType::MacroTree)
+             ? options_->getMacroSinkClusteringSize()
+             : options_->getSinkClusteringSize();
+}
+
+unsigned HTreeBuilder::minClusteringSinks() const
+{
+  return (type_ == TreeType::MacroTree) ? min_clustering_macro_sinks_
+                                        : min_clustering_sinks_;
+}
+
+void HTreeBuilder::precomputeClustering()
+{
+  // Only touches this builder's sinks, so builders of different clocks can
+  // run this concurrently.  The H-tree itself is built serially by run().
+  wireSegmentUnit_ = techChar_->getLengthUnit();
+  mapSinkLocations();
+
+  std::vector<std::pair<float, float>> topLevelSinks;
+  std::vector<const ClockInst*> sinkInsts;
+  initTopLevelSinks(topLevelSinks, sinkInsts);
+  if (topLevelSinks.size() <= minClusteringSinks()
+      || !(options_->getSinkClustering())) {
+    return;
+  }
+
+  topLevelMatching_ = runSinkClustering(topLevelSinks,
+                                        sinkInsts,
+                                        topLevelMaxDiameter(),
+                                        topLevelClusterSize(),
+                                        topLevelBestClusterSize_,
+                                        topLevelBestDiameter_);
+}
+
+std::unique_ptr<SinkClustering> HTreeBuilder::runSinkClustering(
+    const std::vector<std::pair<float, float>>& sinks,
+    const std::vector<const ClockInst*>& sinkInsts,
+    const float maxDiameter,
+    const unsigned clusterSize,
+    unsigned& bestClusterSize,
+    float& bestDiameter)
+{
+  auto matching = std::make_unique<SinkClustering>(options_, techChar_, this);
+  const unsigned numPoints = sinks.size();
+
+  for (int pointIdx = 0; pointIdx < numPoints; ++pointIdx) {
+    const std::pair<float, float>& point = sinks[pointIdx];
+    matching->addPoint(point.first, point.second);
+    if (sinkInsts[pointIdx]->getInputCap() == 0) {
+      // Comes here in second level since first level buf cap is not set
+      matching->addCap(options_->getSinkBufferInputCap());
+    } else {
+      matching->addCap(sinkInsts[pointIdx]->getInputCap());
+    }
+  }
+
+  bestClusterSize = 0;
+  bestDiameter = 0.0;
+  // clang-format off
+  debugPrint(logger_, CTS, "clustering", 1, "**** match.run({}, {}, {}) ****",
+             clusterSize, maxDiameter, wireSegmentUnit_);
+  // clang-format on
+  matching->run(clusterSize,
+                maxDiameter,
+                wireSegmentUnit_,
+                bestClusterSize,
+                bestDiameter);
+  return matching;
+}
+
 void HTreeBuilder::preSinkClustering(
     const std::vector<std::pair<float, float>>& sinks,
     const std::vector<const ClockInst*>& sinkInsts,
@@ -49,68 +154,41 @@ void HTreeBuilder::preSinkClustering(
                             ? options_->isMacroSinkClusteringSizeSet()
                             : options_->isSinkClusteringSizeSet();
 
-  unsigned min_clustering_sinks = (type_ == TreeType::MacroTree)
-                                      ? min_clustering_macro_sinks_
-                                      : min_clustering_sinks_;
-
   const std::vector<std::pair<float, float>>& points = sinks;
   if (!secondLevel) {
-    clock_.forEachSink([&](ClockInst& inst) {
-      const Point<double> normLocation((float) inst.getX() / wireSegmentUnit_,
-                                       (float) inst.getY() / wireSegmentUnit_);
-      mapLocationToSink_[normLocation] = &inst;
-      if (!fuzzyEqual(inst.getInsertionDelay(), 0.0, 1e-6)) {
-        setSinkInsertionDelay(normLocation,
-                              inst.getInsertionDelay() / wireSegmentUnit_);
-        // clang-format off
-	debugPrint(logger_, CTS, "clustering", 1, "sink {} has insDelay {} at {}",
-		   inst.getName(), getSinkInsertionDelay(normLocation),
-		   normLocation);
-        // clang-format on
-      }
-    });
+    mapSinkLocations();
   }
 
-  if (sinks.size() <= min_clustering_sinks
+  if (sinks.size() <= minClusteringSinks()
       || !(options_->getSinkClustering())) {
     topLevelSinksClustered_ = sinks;
     return;
   }
 
-  SinkClustering matching(options_, techChar_, this);
-  const unsigned numPoints = points.size();
-
-  for (int pointIdx = 0; pointIdx < numPoints; ++pointIdx) {
-    const std::pair<float, float>& point = points[pointIdx];
-    matching.addPoint(point.first, point.second);
-    if (sinkInsts[pointIdx]->getInputCap() == 0) {
-      // Comes here in second level since first level buf cap is not set
-      matching.addCap(options_->getSinkBufferInputCap());
-    } else {
-      matching.addCap(sinkInsts[pointIdx]->getInputCap());
-    }
-  }
-
   unsigned bestClusterSize = 0;
   float bestDiameter = 0.0;
-  // clang-format off
-  debugPrint(logger_, CTS, "clustering", 1, "**** match.run({}, {}, {}) ****",
-             clusterSize, maxDiameter, wireSegmentUnit_);
-  // clang-format on
-  matching.run(clusterSize,
-               maxDiameter,
-               wireSegmentUnit_,
-               bestClusterSize,
-               bestDiameter);
+  std::unique_ptr<SinkClustering> matching;
+  if (!secondLevel && topLevelMatching_) {
+    matching = std::move(topLevelMatching_);
+    bestClusterSize = topLevelBestClusterSize_;
+    bestDiameter = topLevelBestDiameter_;
+  } else {
+    matching = runSinkClustering(sinks,
+                                 sinkInsts,
+                                 maxDiameter,
+                                 clusterSize,
+                                 bestClusterSize,
+                                 bestDiameter);
+  }
   std::string size_log, diameter_log;
   size_log = diameter_log = "";
   if (!maxDiameterSet) {
     diameter_log = "max ";
-    bestDiameter = matching.getMaxDiameter();
+    bestDiameter = matching->getMaxDiameter();
   }
   if (!clusterSizeSet) {
     size_log = "max ";
-    bestClusterSize = matching.getMaxSize();
+    bestClusterSize = matching->getMaxSize();
   }
   if (clusterSizeSet || maxDiameterSet) {
     logger_->info(
@@ -139,7 +217,7 @@ void HTreeBuilder::preSinkClustering(
 
   std::vector<std::pair<float, float>> newSinkLocations;
   for (const std::vector<unsigned>& cluster :
-       matching.sinkClusteringSolution()) {
+       matching->sinkClusteringSolution()) {
     if (!cluster.empty()) {
       std::vector<ClockInst*> clusterClockInsts;  // sink clock insts
       float xSum = 0;
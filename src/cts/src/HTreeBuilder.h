@@ -7,6 +7,7 @@
 #include <functional>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -22,6 +23,7 @@
 
 namespace cts {
 class Graphics;
+class SinkClustering;
 
 class SegmentBuilder
 {
@@ -161,8 +163,10 @@ class HTreeBuilder : public TreeBuilder
       : TreeBuilder(options, net, parent, logger, db)
   {
   }
+  ~HTreeBuilder() override;
 
   void run() override;
+  void precomputeClustering() override;
   Point<double> legalizeOneBuffer(Point<double> bufferLoc,
                                   const std::string& bufferName) override;
   void findLegalLocations(const Point<double>& parentPoint,
@@ -345,6 +349,17 @@ class HTreeBuilder : public TreeBuilder
                          float maxDiameter,
                          unsigned clusterSize,
                          bool secondLevel = false);
+  std::unique_ptr<SinkClustering> runSinkClustering(
+      const std::vector<std::pair<float, float>>& sinks,
+      const std::vector<const ClockInst*>& sinkInsts,
+      float maxDiameter,
+      unsigned clusterSize,
+      unsigned& bestClusterSize,
+      float& bestDiameter);
+  void mapSinkLocations();
+  float topLevelMaxDiameter() const;
+  unsigned topLevelClusterSize() const;
+  unsigned minClusteringSinks() const;
   void assignSinksToBranches(
       LevelTopology& topology,
       unsigned branchPtIdx1,
@@ -381,6 +396,11 @@ class HTreeBuilder : public TreeBuilder
   std::vector<LevelTopology> topologyForEachLevel_;
   std::map<Point<double>, ClockInst*> mapLocationToSink_;
   std::vector<std::pair<float, float>> topLevelSinksClustered_;
+  bool sinkLocationsMapped_ = false;
+  // First-level clustering computed by precomputeClustering().
+  std::unique_ptr<SinkClustering> topLevelMatching_;
+  unsigned topLevelBestClusterSize_ = 0;
+  float topLevelBestDiameter_ = 0.0;
 
   int wireSegmentUnit_ = 0;
   unsigned minInputCap_ = 0;
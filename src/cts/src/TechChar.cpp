@@ -9,10 +9,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <filesystem>
+#include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iterator>
 #include <limits>
 #include <ostream>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -29,6 +33,7 @@
 #include "sta/LibertyClass.hh"
 #include "sta/MinMax.hh"
 #include "sta/PowerClass.hh"
+#include "sta/Scene.hh"
 #include "sta/Sdc.hh"
 #include "sta/Search.hh"
 #include "sta/SearchClass.hh"
@@ -1095,6 +1100,11 @@ void TechChar::createStaInstance()
 
   // Gets the corner and other analysis attributes from the new instance.
   charCorner_ = openStaChar_->cmdScene();
+
+  // Time the topologies of the batch with the same number of threads as the
+  // main timer; they are independent so each graph level is timed
+  // concurrently.
+  openStaChar_->setThreadCount(openSta_->threadCount());
 }
 
 void TechChar::setParasitics(
@@ -1586,6 +1596,53 @@ void TechChar::create()
   }
   // Setup of the attributes required to run the characterization.
   initCharacterization();
+
+  // The characterization only depends on the inputs hashed by
+  // computeCacheKey, so a previous run's results can be reused.
+  const std::string& cacheFile = options_->getCharCacheFile();
+  const size_t cacheKey = computeCacheKey();
+  std::vector<ResultData> convertedSolutions;
+  if (!cacheFile.empty()
+      && readCharacterization(cacheFile, cacheKey, convertedSolutions)) {
+    logger_->info(
+        CTS, 241, "Loaded characterization from cache {}.", cacheFile);
+  } else {
+    characterize();
+    // Post-processing of the results.
+    convertedSolutions = characterizationPostProcess();
+    if (!cacheFile.empty()) {
+      writeCharacterization(cacheFile, cacheKey, convertedSolutions);
+    }
+  }
+  compileLut(convertedSolutions);
+  if (logger_->debugCheck(CTS, "characterization", 3)) {
+    printCharacterization();
+    printSolution();
+  }
+  odb::dbBlock::destroy(charBlock_);
+  if (is_hierarchical) {
+    db_network_->setHierarchy();
+  }
+}
+
+void TechChar::characterize()
+{
+  // State of one topology while its buffer combinations are timed.
+  struct TopologyRun
+  {
+    SolutionData solution;
+    sta::Pin* outPin;
+    sta::Vertex* inPinVert;
+    sta::Vertex* outPinVert;
+    sta::Pin* firstPinLastNet;
+    // Parasitics of the last net without the load.
+    float c1;
+    float c2;
+    float r1;
+    unsigned buffersCombinations;
+    std::vector<ResultData> results;
+  };
+
   int64_t topologiesCreated = 0;
   for (unsigned setupWirelength : wirelengthsToTest_) {
     // Creates the topologies for the current wirelength.
@@ -1597,108 +1654,115 @@ void TechChar::create()
     createStaInstance();
     // Setup of the parasitics for each net.
     setParasitics(topologiesVector, setupWirelength);
-    // For each topology...
     sta::Graph* graph = openStaChar_->ensureGraph();
-    int topoIndex = 0;
-    for (SolutionData solution : topologiesVector) {
+
+    // The topologies are independent nets of the characterization block, so
+    // all of them are timed together: each timing update below evaluates one
+    // pattern of every topology, and the timer spreads the topologies of a
+    // graph level over its threads.
+    std::vector<TopologyRun> runs;
+    runs.reserve(topologiesVector.size());
+    for (const SolutionData& solution : topologiesVector) {
       // clang-format off
-      debugPrint(logger_, CTS, "tech char", 1, "*genrate combinations for "
-                 "topology: {} of {}", topoIndex + 1, topologiesVector.size());
+      debugPrint(logger_, CTS, "tech char", 1, "*# bufs = {}; "
+                 "# nodes with buf = {}",
+                 masterNames_.size(), solution.instVector.size());
       // clang-format on
-      topoIndex++;
+      // For each possible buffer combination (different sizes).
+      const unsigned buffersCombinations
+          = getBufferingCombo(masterNames_.size(), solution.instVector.size());
+      if (buffersCombinations == 0) {
+        continue;
+      }
+
+      TopologyRun& run = runs.emplace_back();
+      run.solution = solution;
+      run.buffersCombinations = buffersCombinations;
       // Gets the input and output port (as terms, pins and vertices).
       odb::dbBTerm* inBTerm = solution.inPort->getBTerm();
       odb::dbBTerm* outBTerm = solution.outPort->getBTerm();
       odb::dbNet* lastNet = solution.netVector.back();
       sta::Pin* inPin = db_network_->dbToSta(inBTerm);
-      sta::Pin* outPin = db_network_->dbToSta(outBTerm);
-      sta::Vertex* outPinVert = graph->pinLoadVertex(outPin);
-      sta::Vertex* inPinVert = graph->pinDrvrVertex(inPin);
+      run.outPin = db_network_->dbToSta(outBTerm);
+      run.outPinVert = graph->pinLoadVertex(run.outPin);
+      run.inPinVert = graph->pinDrvrVertex(inPin);
 
       // Gets the first pin of the last net. Needed to set a new parasitic
       // (load) value.
-      sta::Pin* firstPinLastNet = nullptr;
       if (lastNet->getBTerms().size() > 1) {
         // Parasitics for purewire segment.
         // First and last pin are already available.
-        firstPinLastNet = inPin;
+        run.firstPinLastNet = inPin;
       } else {
         // Parasitics for the end/start of a net. One Port and one
         // instance pin.
         odb::dbITerm* netITerm = lastNet->get1stITerm();
-        firstPinLastNet = db_network_->dbToSta(netITerm);
+        run.firstPinLastNet = db_network_->dbToSta(netITerm);
       }
 
-      float c1, c2, r1;
       bool piExists = false;
       // Gets the parasitics that are currently used for the last net.
-      openStaChar_->findPiElmore(firstPinLastNet,
+      openStaChar_->findPiElmore(run.firstPinLastNet,
                                  sta::RiseFall::rise(),
                                  sta::MinMax::max(),
-                                 c2,
-                                 r1,
-                                 c1,
+                                 run.c2,
+                                 run.r1,
+                                 run.c1,
                                  piExists);
+    }
 
-      // clang-format off
-      debugPrint(logger_, CTS, "tech char", 1, "*# bufs = {}; "
-                 "# nodes with buf = {}",
-                 masterNames_.size(), solution.instVector.size());
-      // clang-format on
-      // For each possible buffer combination (different sizes).
-      unsigned buffersCombinations
-          = getBufferingCombo(masterNames_.size(), solution.instVector.size());
-
-      if (buffersCombinations == 0) {
-        continue;
-      }
-
-      do {
-        // For each possible load.
-        for (float load : loadsToTest_) {
-          // Sets the new parasitic of the last net (load added to last pin).
-          openStaChar_->makePiElmore(firstPinLastNet,
+    // Every step times the next buffer combination of the topologies that
+    // have one left.
+    std::vector<TopologyRun*> active;
+    for (TopologyRun& run : runs) {
+      active.push_back(&run);
+    }
+    while (!active.empty()) {
+      debugPrint(logger_,
+                 CTS,
+                 "tech char",
+                 1,
+                 "*generate combinations for {} of {} topologies",
+                 active.size(),
+                 topologiesVector.size());
+      // For each possible load.
+      for (float load : loadsToTest_) {
+        // Sets the new parasitic of the last net (load added to last pin).
+        for (TopologyRun* run : active) {
+          openStaChar_->makePiElmore(run->firstPinLastNet,
                                      sta::RiseFall::rise(),
                                      sta::MinMaxAll::all(),
-                                     c2,
-                                     r1,
-                                     c1 + load);
-          openStaChar_->setElmore(firstPinLastNet,
-                                  outPin,
+                                     run->c2,
+                                     run->r1,
+                                     run->c1 + load);
+          openStaChar_->setElmore(run->firstPinLastNet,
+                                  run->outPin,
                                   sta::RiseFall::rise(),
                                   sta::MinMaxAll::all(),
-                                  r1 * (c1 + c2 + load));
-          // For each possible input slew.
-          for (float inputslew : slewsToTest_) {
-            // Sets the slew on the input vertex.
-            // Here the new pattern is created (combination of load, buffers
-            // and slew values).
-            openStaChar_->setAnnotatedSlew(inPinVert,
+                                  run->r1 * (run->c1 + run->c2 + load));
+        }
+        // For each possible input slew.
+        for (float inputslew : slewsToTest_) {
+          // Sets the slew on the input vertices.
+          // Here the new patterns are created (combination of load, buffers
+          // and slew values).
+          for (TopologyRun* run : active) {
+            openStaChar_->setAnnotatedSlew(run->inPinVert,
                                            charCorner_,
                                            sta::MinMaxAll::all(),
                                            sta::RiseFallBoth::riseFall(),
                                            inputslew);
-            // Updates timing for the new pattern.
-            openStaChar_->updateTiming(true);
-
-            // Gets the results (delay, slew, power...) for the pattern.
-            ResultData results = computeTopologyResults(
-                solution, outPinVert, load, inputslew, setupWirelength);
-
-            // Appends the results to a map, grouping each result by
-            // wirelength, load, output slew and input cap.
-            CharKey solutionKey;
-            solutionKey.wirelength = results.wirelength;
-            solutionKey.pinSlew = results.pinSlew;
-            solutionKey.load = results.load;
-            solutionKey.totalcap = results.totalcap;
-            if (solutionMap_.find(solutionKey) != solutionMap_.end()) {
-              solutionMap_[solutionKey].push_back(results);
-            } else {
-              std::vector<ResultData> resultGroup;
-              resultGroup.push_back(results);
-              solutionMap_[solutionKey] = std::move(resultGroup);
-            }
+          }
+          // Updates timing for the new patterns.
+          openStaChar_->updateTiming(true);
+
+          // Gets the results (delay, slew, power...) for each pattern.
+          for (TopologyRun* run : active) {
+            run->results.push_back(computeTopologyResults(run->solution,
+                                                          run->outPinVert,
+                                                          load,
+                                                          inputslew,
+                                                          setupWirelength));
             topologiesCreated++;
             if (logger_->debugCheck(utl::CTS, "tech char", 1)
                 && topologiesCreated % 50000 == 0) {
@@ -1711,14 +1775,36 @@ void TechChar::create()
             }
           }
         }
+      }
+
+      std::vector<TopologyRun*> next;
+      for (TopologyRun* run : active) {
         // If the solution is not a pure-wire, update the buffer topologies.
-        if (!solution.isPureWire && buffersCombinations > 1) {
-          updateBufferTopologies(solution);
+        if (!run->solution.isPureWire && run->buffersCombinations > 1) {
+          updateBufferTopologies(run->solution);
         }
         // For pure-wire solution buffersCombinations == 1, so it only runs
         // once.
-        buffersCombinations--;
-      } while (buffersCombinations != 0);
+        run->buffersCombinations--;
+        if (run->buffersCombinations != 0) {
+          next.push_back(run);
+        }
+      }
+      active = std::move(next);
+    }
+
+    // Appends the results to a map, grouping each result by wirelength,
+    // load, output slew and input cap.  Topologies are appended in creation
+    // order so the groups are the same as timing them one by one.
+    for (TopologyRun& run : runs) {
+      for (ResultData& results : run.results) {
+        CharKey solutionKey;
+        solutionKey.wirelength = results.wirelength;
+        solutionKey.pinSlew = results.pinSlew;
+        solutionKey.load = results.load;
+        solutionKey.totalcap = results.totalcap;
+        solutionMap_[solutionKey].push_back(std::move(results));
+      }
     }
     openStaChar_.reset(nullptr);
   }
@@ -1726,18 +1812,186 @@ void TechChar::create()
     logger_->info(
         CTS, 39, "Number of created patterns = {}.", topologiesCreated);
   }
-  // Post-processing of the results.
-  const std::vector<ResultData> convertedSolutions
-      = characterizationPostProcess();
-  compileLut(convertedSolutions);
-  if (logger_->debugCheck(CTS, "characterization", 3)) {
-    printCharacterization();
-    printSolution();
+}
+
+namespace {
+
+// Hashes the size and modification time of `fileName` rather than its
+// contents, which can be hundreds of megabytes for a Liberty library.
+void hashFileStamp(size_t& key, const std::string& fileName)
+{
+  boost::hash_combine(key, fileName);
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(fileName, ec);
+  boost::hash_combine(key, ec ? 0 : size);
+  const auto time = std::filesystem::last_write_time(fileName, ec);
+  boost::hash_combine(key, ec ? 0 : time.time_since_epoch().count());
+}
+
+}  // namespace
+
+size_t TechChar::computeCacheKey() const
+{
+  size_t key = 0;
+  boost::hash_combine(key, kCharCacheVersion);
+  std::set<std::string> libFiles;
+  for (const std::string& masterName : masterNames_) {
+    boost::hash_combine(key, masterName);
+    odb::dbMaster* master = db_->findMaster(masterName.c_str());
+    sta::LibertyCell* libertyCell
+        = master ? db_network_->libertyCell(db_network_->dbToSta(master))
+                 : nullptr;
+    if (libertyCell) {
+      sta::LibertyPort *input, *output;
+      libertyCell->bufferPorts(input, output);
+      libFiles.insert(libertyCell->libertyLibrary()->filename());
+      boost::hash_combine(key, libertyCell->area());
+      if (input) {
+        boost::hash_combine(key, input->capacitance());
+      }
+    }
   }
-  odb::dbBlock::destroy(charBlock_);
-  if (is_hierarchical) {
-    db_network_->setHierarchy();
+  // An edited library can change the timing without changing the cells.
+  for (const std::string& libFile : libFiles) {
+    hashFileStamp(key, libFile);
+  }
+  boost::hash_combine(key, charBuf_->getName());
+  boost::hash_combine(key, options_->getRootBuffer());
+  boost::hash_combine(key, options_->getSinkBuffer());
+  boost::hash_combine(key, options_->getSinkBufferInputCap());
+  boost::hash_combine(key, options_->getWireSegmentUnit());
+  boost::hash_combine(key, options_->getMaxCharSlew());
+  boost::hash_combine(key, options_->getMaxCharCap());
+  boost::hash_combine(key, options_->getSlewSteps());
+  boost::hash_combine(key, options_->getCapSteps());
+  boost::hash_combine(key, options_->isSinkBufferMaxCapDerateSet());
+  boost::hash_combine(key, options_->getSinkBufferMaxCapDerate());
+  boost::hash_combine(key, charSlewStepSize_);
+  boost::hash_combine(key, charCapStepSize_);
+  // Clock wire RC of the command scene, see initClockLayerResCap.
+  boost::hash_combine(key, openSta_->cmdScene()->name());
+  boost::hash_combine(key, resPerDBU_);
+  boost::hash_combine(key, capPerDBU_);
+  boost::hash_combine(key, lengthUnit_);
+  boost::hash_range(key, wirelengthsToTest_.begin(), wirelengthsToTest_.end());
+  boost::hash_range(key, loadsToTest_.begin(), loadsToTest_.end());
+  boost::hash_range(key, slewsToTest_.begin(), slewsToTest_.end());
+  for (sta::Scene* scene : openSta_->scenes()) {
+    boost::hash_combine(key, scene->name());
+  }
+  return key;
+}
+
+// Cache file layout:
+//   version <n>
+//   key <hash>
+//   bounds <min slew> <max slew> <min cap> <max cap> <min len> <max len>
+//   solutions <count>
+//   one line per solution: load inSlew wirelength pinSlew pinArrival
+//     totalcap totalPower isPureWire <topology count> <topology...>
+void TechChar::writeCharacterization(
+    const std::string& fileName,
+    size_t key,
+    const std::vector<ResultData>& solutions) const
+{
+  std::ofstream out(fileName);
+  if (!out) {
+    logger_->warn(
+        CTS, 242, "Cannot write characterization cache {}.", fileName);
+    return;
+  }
+  out << std::setprecision(std::numeric_limits<float>::max_digits10);
+  out << "version " << kCharCacheVersion << '\n';
+  out << "key " << key << '\n';
+  out << "bounds " << minSlew_ << ' ' << maxSlew_ << ' ' << minCapacitance_
+      << ' ' << maxCapacitance_ << ' ' << minSegmentLength_ << ' '
+      << maxSegmentLength_ << '\n';
+  out << "solutions " << solutions.size() << '\n';
+  for (const ResultData& solution : solutions) {
+    out << solution.load << ' ' << solution.inSlew << ' '
+        << solution.wirelength << ' ' << solution.pinSlew << ' '
+        << solution.pinArrival << ' ' << solution.totalcap << ' '
+        << solution.totalPower << ' ' << solution.isPureWire << ' '
+        << solution.topology.size();
+    for (const std::string& topology : solution.topology) {
+      out << ' ' << topology;
+    }
+    out << '\n';
   }
+  debugPrint(logger_,
+             CTS,
+             "tech char",
+             1,
+             "Wrote {} characterization results to {}.",
+             solutions.size(),
+             fileName);
+}
+
+bool TechChar::readCharacterization(const std::string& fileName,
+                                    size_t key,
+                                    std::vector<ResultData>& solutions)
+{
+  std::ifstream in(fileName);
+  if (!in) {
+    return false;
+  }
+  std::string tag;
+  unsigned version = 0;
+  size_t fileKey = 0;
+  if (!(in >> tag >> version) || tag != "version"
+      || version != kCharCacheVersion || !(in >> tag >> fileKey)
+      || tag != "key") {
+    logger_->warn(CTS,
+                  243,
+                  "Ignoring characterization cache {} with unknown format.",
+                  fileName);
+    return false;
+  }
+  if (fileKey != key) {
+    debugPrint(logger_,
+               CTS,
+               "tech char",
+               1,
+               "Characterization cache {} is stale.",
+               fileName);
+    return false;
+  }
+
+  unsigned minSlew, maxSlew, minCap, maxCap, minLength, maxLength;
+  size_t count = 0;
+  bool valid = (in >> tag >> minSlew >> maxSlew >> minCap >> maxCap
+                >> minLength >> maxLength)
+               && tag == "bounds" && (in >> tag >> count)
+               && tag == "solutions";
+  std::vector<ResultData> cached;
+  for (size_t i = 0; valid && i < count; i++) {
+    ResultData solution;
+    size_t topologyCount = 0;
+    valid = static_cast<bool>(
+        in >> solution.load >> solution.inSlew >> solution.wirelength
+        >> solution.pinSlew >> solution.pinArrival >> solution.totalcap
+        >> solution.totalPower >> solution.isPureWire >> topologyCount);
+    for (size_t j = 0; valid && j < topologyCount; j++) {
+      valid = static_cast<bool>(in >> solution.topology.emplace_back());
+    }
+    cached.push_back(std::move(solution));
+  }
+  if (!valid) {
+    logger_->warn(CTS,
+                  244,
+                  "Ignoring truncated characterization cache {}.",
+                  fileName);
+    return false;
+  }
+
+  minSlew_ = minSlew;
+  maxSlew_ = maxSlew;
+  minCapacitance_ = minCap;
+  maxCapacitance_ = maxCap;
+  minSegmentLength_ = minLength;
+  maxSegmentLength_ = maxLength;
+  solutions = std::move(cached);
+  return true;
 }
 
 // Compute possible buffering solution combinations given #buffers and
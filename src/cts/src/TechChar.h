@@ -229,6 +229,14 @@ class TechChar
                                  uint8_t inputCap,
                                  uint8_t inputSlew);
 
+  void characterize();
+  size_t computeCacheKey() const;
+  void writeCharacterization(const std::string& fileName,
+                             size_t key,
+                             const std::vector<ResultData>& solutions) const;
+  bool readCharacterization(const std::string& fileName,
+                            size_t key,
+                            std::vector<ResultData>& solutions);
   void compileLut(const std::vector<ResultData>& lutSols);
   void setLengthUnit(unsigned length) { lengthUnit_ = length; }
   unsigned computeKey(uint8_t length, uint8_t load, uint8_t outputSlew) const
@@ -291,6 +299,8 @@ class TechChar
 
   static constexpr unsigned NUM_BITS_PER_FIELD = 10;
   static constexpr unsigned MAX_NORMALIZED_VAL = (1 << NUM_BITS_PER_FIELD) - 1;
+  // Bump when the characterization or the cache file layout changes.
+  static constexpr unsigned kCharCacheVersion = 1;
 
   unsigned lengthUnit_ = 0;
   unsigned lengthUnitRatio_ = 0;
@@ -75,6 +75,9 @@ class TreeBuilder
   virtual ~TreeBuilder() = default;
 
   virtual void run() = 0;
+  // Work that only reads this tree's sinks and may run concurrently with
+  // the same call on other builders, ahead of the serial run().
+  virtual void precomputeClustering() {}
   void mergeBlockages();
   void initBlockages();
   void setTechChar(TechChar& techChar) { techChar_ = &techChar; }
@@ -57,6 +57,8 @@
 #include "sta/Sdc.hh"
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
+#include "utl/Trace.h"
 #include "utl/timer.h"
 
 namespace cts {
@@ -88,6 +90,7 @@ TritonCTS::~TritonCTS()
 
 void TritonCTS::runTritonCts()
 {
+  utl::TraceScope trace("cts::runTritonCts");
   utl::Timer timer;
   odb::dbChip* chip = db_->getChip();
   odb::dbBlock* block = chip->getBlock();
@@ -302,6 +305,31 @@ void TritonCTS::buildClockTrees()
     builder->setDb(db_);
     builder->setLogger(logger_);
     builder->initBlockages();
+  }
+
+  // Sink clustering of each clock is independent and dominates runtime on
+  // designs with many clocks, so it is computed for all trees up front.
+  // Tree construction stays serial: it reports per-tree progress and
+  // extends the shared TechChar segment table.
+  int thread_count = openSta_->threadCount();
+  if (logger_->debugCheck(CTS, "Stree", 1) || options_->getObserver()) {
+    // Clustering plot files are written under a fixed name and the GUI
+    // observer is not thread safe.
+    thread_count = 1;
+  }
+  if (thread_count > 1 && builders_.size() > 1) {
+    utl::ThreadPool pool(std::min<size_t>(thread_count, builders_.size()));
+    pool.parallelFor(builders_,
+                     [](const std::unique_ptr<TreeBuilder>& builder) {
+                       builder->precomputeClustering();
+                     });
+  } else {
+    for (auto& builder : builders_) {
+      builder->precomputeClustering();
+    }
+  }
+
+  for (auto& builder : builders_) {
     builder->run();
   }
 }
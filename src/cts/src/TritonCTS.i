@@ -112,6 +112,12 @@ set_cap_steps(int steps)
   getTritonCts()->getParms()->setCapSteps(steps);
 }
 
+void
+set_char_cache_file(const char* file)
+{
+  getTritonCts()->getParms()->setCharCacheFile(file);
+}
+
 void
 set_metric_output(const char* file)
 {
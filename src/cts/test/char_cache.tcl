@@ -0,0 +1,69 @@
+# The characterization cache is reused by an identical run and rebuilt
+# when the clock wire RC changes.
+source "helpers.tcl"
+source "cts-helpers.tcl"
+
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+
+set block [make_array 100]
+sta::db_network_defined
+
+create_clock -period 5 clk
+
+set_wire_rc -clock -layer metal5
+
+set_cts_config -wire_unit 20 \
+  -root_buf CLKBUF_X3 \
+  -buf_list CLKBUF_X3
+
+set cache_file [make_result_file char_cache.txt]
+file delete $cache_file
+configure_cts_characterization -cache_file $cache_file
+
+set original [pin_nets $block]
+set original_nets {}
+foreach net [$block getNets] {
+  lappend original_nets [$net getName]
+}
+
+proc read_cache { cache_file } {
+  set stream [open $cache_file r]
+  set contents [read $stream]
+  close $stream
+  return $contents
+}
+
+# Marks the cache so that a rewrite can be told from a reuse.  The reader
+# ignores anything after the last solution.
+proc mark_cache { cache_file } {
+  set stream [open $cache_file a]
+  puts $stream "marker"
+  close $stream
+}
+
+clock_tree_synthesis
+set characterized [clock_tree $block $original]
+if { ![file exists $cache_file] } {
+  error "characterization cache was not written"
+}
+mark_cache $cache_file
+
+remove_clock_tree $block $original $original_nets
+clock_tree_synthesis
+set cached [clock_tree $block $original]
+if { [string first "marker" [read_cache $cache_file]] == -1 } {
+  error "identical run did not reuse the characterization cache"
+}
+if { $characterized != $cached } {
+  error "clock tree built from the cache differs"
+}
+
+remove_clock_tree $block $original $original_nets
+set_wire_rc -clock -layer metal3
+clock_tree_synthesis
+if { [string first "marker" [read_cache $cache_file]] != -1 } {
+  error "characterization cache was reused after the wire RC changed"
+}
+
+puts pass
@@ -0,0 +1,44 @@
+# The clock trees do not depend on the number of threads used to cluster
+# the sinks of each tree.
+source "helpers.tcl"
+source "cts-helpers.tcl"
+
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+
+# Two clock nets of 300 sinks each so both trees are clustered.
+set block [make_array 600 200000 200000 300]
+sta::db_network_defined
+
+create_clock -period 5 clk
+
+set_wire_rc -clock -layer metal5
+
+set_cts_config -wire_unit 20 \
+  -distance_between_buffers 100 \
+  -sink_clustering_size 10 \
+  -sink_clustering_max_diameter 60 \
+  -num_static_layers 1 \
+  -root_buf CLKBUF_X3 \
+  -buf_list CLKBUF_X3
+
+set original [pin_nets $block]
+set original_nets {}
+foreach net [$block getNets] {
+  lappend original_nets [$net getName]
+}
+
+set_thread_count 1
+clock_tree_synthesis -sink_clustering_enable
+set serial [clock_tree $block $original]
+
+remove_clock_tree $block $original $original_nets
+set_thread_count 4
+clock_tree_synthesis -sink_clustering_enable
+set parallel [clock_tree $block $original]
+
+if { $serial != $parallel } {
+  error "clock trees built with 1 and 4 threads differ"
+}
+
+puts pass
@@ -81,3 +81,68 @@ proc report_ndr_nets { } {
     puts "  $net"
   }
 }
+
+# Maps each instance to the nets of its pins.
+proc pin_nets { block } {
+  set nets [dict create]
+  foreach inst [$block getInsts] {
+    set pins [dict create]
+    foreach iterm [$inst getITerms] {
+      set net [$iterm getNet]
+      if { $net != "NULL" } {
+        dict set pins [[$iterm getMTerm] getName] [$net getName]
+      }
+    }
+    dict set nets [$inst getName] $pins
+  }
+  return $nets
+}
+
+# Describes the inserted buffers and the driver of each original clock pin
+# by location so that the result does not depend on generated names.
+proc clock_tree { block original } {
+  set buffers {}
+  foreach inst [$block getInsts] {
+    if { ![dict exists $original [$inst getName]] } {
+      lappend buffers "[[$inst getMaster] getName] [$inst getLocation]"
+    }
+  }
+  set drivers {}
+  foreach name [lsort [dict keys $original]] {
+    set inst [$block findInst $name]
+    foreach pin {CK A} {
+      set iterm [$inst findITerm $pin]
+      if { $iterm == "NULL" || [$iterm getNet] == "NULL" } {
+        continue
+      }
+      foreach driver [[$iterm getNet] getITerms] {
+        if { [$driver isOutputSignal] } {
+          lappend drivers "$name/$pin [[$driver getInst] getLocation]"
+        }
+      }
+    }
+  }
+  return [list [lsort $buffers] $drivers]
+}
+
+# Removes the inserted buffers and nets and reconnects the original pins.
+proc remove_clock_tree { block original original_nets } {
+  foreach inst [$block getInsts] {
+    if { ![dict exists $original [$inst getName]] } {
+      odb::dbInst_destroy $inst
+    }
+  }
+  foreach net [$block getNets] {
+    if { [lsearch -exact $original_nets [$net getName]] == -1 } {
+      odb::dbNet_destroy $net
+    }
+  }
+  dict for {name pins} $original {
+    set inst [$block findInst $name]
+    dict for {pin net_name} $pins {
+      set iterm [$inst findITerm $pin]
+      $iterm disconnect
+      $iterm connect [$block findNet $net_name]
+    }
+  }
+}
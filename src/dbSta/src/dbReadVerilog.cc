@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <map>
@@ -12,6 +13,7 @@
 #include <regex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -27,6 +29,9 @@
 #include "sta/PortDirection.hh"
 #include "sta/VerilogReader.hh"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
+#include "utl/mem_stats.h"
+#include "utl/timer.h"
 
 namespace ord {
 
@@ -140,6 +145,7 @@ class Verilog2db
                           dbVerilogNetwork* verilog_network,
                           bool link_make_black_boxes);
   void restoreTopBlock(const char* orig_top_cell_name);
+  void setThreadCount(int thread_count) { thread_count_ = thread_count; }
 
  private:
   struct LineInfo
@@ -147,6 +153,14 @@ class Verilog2db
     std::string file_name;
     int line_number;
   };
+  // A flat net whose pins have been collected but whose dbNet has not been
+  // created yet.
+  struct PendingNet
+  {
+    Net* net;
+    std::string name;
+    PinSeq pins;
+  };
   using InstPair = std::pair<const Instance*, dbModInst*>;
   using InstPairs = std::vector<InstPair>;
   void makeDbModule(Instance* inst, dbModule* parent, InstPairs& inst_pairs);
@@ -163,6 +177,15 @@ class Verilog2db
                dbModITerm*& mod_iterm);
   void recordBusPortsOrder();
   void makeDbNets(const Instance* inst, PinSet& visited_pins);
+  void flushDbNets();
+  void makeDbNet(const PendingNet& pending);
+  dbInst* findDbInst(const Instance* inst);
+  dbMTerm* findMTerm(dbInst* db_inst, const Pin* pin);
+  void countLeafInstsAndNets(const Instance* inst,
+                             uint32_t& num_insts,
+                             uint32_t& num_nets) const;
+  void beginNetlist();
+  void endNetlist();
 
   void makeModNetsForSubmodule(const Instance* inst, dbModInst* mod_inst);
   void makeModNetsForSubmodules(InstPairs& inst_pairs);
@@ -189,6 +212,14 @@ class Verilog2db
   bool omit_filename_prop_ = false;
   static const std::regex kLineInfoRe;
   std::vector<ConcreteCell*> unused_cells_;
+  // Leaf instances and mterms resolved while building the current block, so
+  // connecting pins does not go through name lookups.
+  std::unordered_map<const Instance*, dbInst*> inst_map_;
+  std::unordered_map<const Port*, dbMTerm*> mterm_map_;
+  std::vector<PendingNet> pending_nets_;
+  std::unique_ptr<utl::ThreadPool> thread_pool_;
+  int thread_count_ = 1;
+  static constexpr size_t kNetBatchSize = 16384;
 };
 
 // Example: "./designs/src/gcd/gcd.v:571.3-577.6"
@@ -207,12 +238,23 @@ bool dbLinkDesign(const char* top_cell_name,
   bool success = verilog_network->linkNetwork(
       top_cell_name, link_make_black_boxes, verilog_network->report());
   if (success) {
+    const utl::Timer timer;
     Verilog2db v2db(verilog_network, db, logger, hierarchy, omit_filename_prop);
+    // The verilog network is not part of the Sta, so it does not follow
+    // set_thread_count.
+    v2db.setThreadCount(verilog_network->getDbNetwork()->threadCount());
     v2db.makeBlock();
     v2db.makeDbNetlist();
     // Link unused modules in case if we want to swap to such modules later
     v2db.processUnusedCells(
         top_cell_name, verilog_network, link_make_black_boxes);
+    debugPrint(logger,
+               utl::ODB,
+               "dbReadVerilog",
+               1,
+               "dbLinkDesign {:.2f} seconds, peak RSS {} MB",
+               timer.elapsed(),
+               utl::getPeakRSS() / (1024 * 1024));
   }
 
   return success;
@@ -268,18 +310,70 @@ void Verilog2db::makeBlock()
 
 void Verilog2db::makeDbNetlist()
 {
+  beginNetlist();
   recordBusPortsOrder();
   // As a side effect we accumulate the instance <-> modinst pairs
   InstPairs inst_pairs;
   makeDbModule(network_->topInstance(), /* parent */ nullptr, inst_pairs);
   PinSet visited_pins(network_);
   makeDbNets(network_->topInstance(), visited_pins);
+  flushDbNets();
   if (hierarchy_) {
     makeModNetsForSubmodules(inst_pairs);
   }
   for (auto inst : dont_touch_insts_) {
     inst->setDoNotTouch(true);
   }
+  endNetlist();
+}
+
+// Size the block's name tables and the lookup maps for the netlist about to
+// be created.
+void Verilog2db::beginNetlist()
+{
+  uint32_t num_insts = 0;
+  uint32_t num_nets = 0;
+  countLeafInstsAndNets(network_->topInstance(), num_insts, num_nets);
+  block_->reserveInsts(num_insts);
+  block_->reserveNets(num_nets);
+  inst_map_.clear();
+  inst_map_.reserve(num_insts);
+  mterm_map_.clear();
+
+  if (thread_count_ > 1) {
+    thread_pool_ = std::make_unique<utl::ThreadPool>(thread_count_);
+  }
+}
+
+void Verilog2db::endNetlist()
+{
+  // Instances of the next linked cell may reuse these addresses.
+  inst_map_.clear();
+  mterm_map_.clear();
+  thread_pool_.reset();
+}
+
+// Upper bound on the flat nets: hierarchical nets are counted once per
+// level they appear in.
+void Verilog2db::countLeafInstsAndNets(const Instance* inst,
+                                       uint32_t& num_insts,
+                                       uint32_t& num_nets) const
+{
+  std::unique_ptr<NetIterator> net_iter{network_->netIterator(inst)};
+  while (net_iter->hasNext()) {
+    net_iter->next();
+    ++num_nets;
+  }
+  std::unique_ptr<InstanceChildIterator> child_iter{
+      network_->childIterator(inst)};
+  while (child_iter->hasNext()) {
+    const Instance* child = child_iter->next();
+    if (network_->isHierarchical(child)) {
+      countLeafInstsAndNets(child, num_insts, num_nets);
+    } else {
+      ++num_insts;
+    }
+  }
 }
 
 void Verilog2db::recordBusPortsOrder()
@@ -561,6 +655,7 @@ void Verilog2db::makeChildInsts(Instance* inst,
 
       auto db_inst
           = dbInst::create(block_, master, child_name.c_str(), false, module);
+      inst_map_[child] = db_inst;
       debugPrint(logger_,
                  utl::ODB,
                  "dbReadVerilog",
@@ -728,75 +823,135 @@ void Verilog2db::makeDbNets(const Instance* inst, PinSet& visited_pins)
       continue;
     }
 
-    // Create a new flat net
-    const std::string net_name = network_->pathName(net);
-    dbNet* db_net = dbNet::create(block_, net_name.c_str());
-    debugPrint(logger_,
-               utl::ODB,
-               "dbReadVerilog",
-               2,
-               "makeDbNets created net '{}' (id={})",
-               db_net->getName(),
-               db_net->getId());
-    if (network_->isPower(net)) {
-      db_net->setSigType(odb::dbSigType::POWER);
-    }
-    if (network_->isGround(net)) {
-      db_net->setSigType(odb::dbSigType::GROUND);
+    pending_nets_.push_back({net, {}, std::move(net_pins)});
+    if (pending_nets_.size() >= kNetBatchSize) {
+      flushDbNets();
     }
+  }
 
+  // Recursion into child module instances
+  std::unique_ptr<InstanceChildIterator> child_iter{
+      network_->childIterator(inst)};
+  while (child_iter->hasNext()) {
+    const Instance* child = child_iter->next();
+    makeDbNets(child, visited_pins);
+  }
+}
+
+// Name the pending nets and sort their pins, which only reads the verilog
+// network and can run in parallel, then create the dbNets in the order the
+// nets were found.
+void Verilog2db::flushDbNets()
+{
+  auto prepare = [this](PendingNet& pending) {
+    pending.name = network_->pathName(pending.net);
     // Sort connected pins for regression stability
-    std::ranges::sort(net_pins, PinPathNameLess(network_));
-
-    // Connect pins to the new flat net
-    for (const Pin* pin : net_pins) {
-      if (network_->isTopLevelPort(pin)) {
-        const std::string port_name = network_->portName(pin);
-        if (block_->findBTerm(port_name.c_str()) == nullptr) {
-          dbBTerm* bterm = dbBTerm::create(db_net, port_name.c_str());
+    std::ranges::sort(pending.pins, PinPathNameLess(network_));
+  };
+  if (thread_pool_ && pending_nets_.size() > 1) {
+    const size_t chunk_count = thread_pool_->threadCount() * 4;
+    const size_t chunk_size
+        = (pending_nets_.size() + chunk_count - 1) / chunk_count;
+    std::vector<size_t> chunk_begins;
+    for (size_t begin = 0; begin < pending_nets_.size(); begin += chunk_size) {
+      chunk_begins.push_back(begin);
+    }
+    thread_pool_->parallelFor(chunk_begins, [&](const size_t begin) {
+      const size_t end = std::min(begin + chunk_size, pending_nets_.size());
+      for (size_t i = begin; i < end; ++i) {
+        prepare(pending_nets_[i]);
+      }
+    });
+  } else {
+    for (PendingNet& pending : pending_nets_) {
+      prepare(pending);
+    }
+  }
+
+  for (const PendingNet& pending : pending_nets_) {
+    makeDbNet(pending);
+  }
+  pending_nets_.clear();
+}
+
+void Verilog2db::makeDbNet(const PendingNet& pending)
+{
+  Net* net = pending.net;
+  dbNet* db_net = dbNet::create(block_, pending.name.c_str());
+  debugPrint(logger_,
+             utl::ODB,
+             "dbReadVerilog",
+             2,
+             "makeDbNets created net '{}' (id={})",
+             db_net->getName(),
+             db_net->getId());
+  if (network_->isPower(net)) {
+    db_net->setSigType(odb::dbSigType::POWER);
+  }
+  if (network_->isGround(net)) {
+    db_net->setSigType(odb::dbSigType::GROUND);
+  }
+
+  // Connect pins to the new flat net
+  for (const Pin* pin : pending.pins) {
+    if (network_->isTopLevelPort(pin)) {
+      const std::string port_name = network_->portName(pin);
+      if (block_->findBTerm(port_name.c_str()) == nullptr) {
+        dbBTerm* bterm = dbBTerm::create(db_net, port_name.c_str());
+        debugPrint(logger_,
+                   utl::ODB,
+                   "dbReadVerilog",
+                   2,
+                   "makeDbNets created bterm '{}' (id={})",
+                   bterm->getName(),
+                   bterm->getId());
+        dbIoType io_type = staToDb(network_->direction(pin));
+        bterm->setIoType(io_type);
+      }
+    } else if (network_->isLeaf(pin)) {
+      dbInst* db_inst = findDbInst(network_->instance(pin));
+      if (db_inst) {
+        dbMTerm* mterm = findMTerm(db_inst, pin);
+        if (mterm) {
+          db_inst->getITerm(mterm)->connect(db_net);
           debugPrint(logger_,
                      utl::ODB,
                      "dbReadVerilog",
                      2,
-                     "makeDbNets created bterm '{}' (id={})",
-                     bterm->getName(),
-                     bterm->getId());
-          dbIoType io_type = staToDb(network_->direction(pin));
-          bterm->setIoType(io_type);
-        }
-      } else if (network_->isLeaf(pin)) {
-        const std::string port_name = network_->portName(pin);
-        Instance* inst = network_->instance(pin);
-        const std::string inst_name = network_->pathName(inst);
-        dbInst* db_inst = block_->findInst(inst_name.c_str());
-        if (db_inst) {
-          dbMaster* master = db_inst->getMaster();
-          dbMTerm* mterm = master->findMTerm(block_, port_name.c_str());
-          if (mterm) {
-            db_inst->getITerm(mterm)->connect(db_net);
-            debugPrint(logger_,
-                       utl::ODB,
-                       "dbReadVerilog",
-                       2,
-                       "makeDbNets connected mterm '{}' (id={}) to net "
-                       "'{}' (id={})",
-                       mterm->getName(),
-                       mterm->getId(),
-                       db_net->getName(),
-                       db_net->getId());
-          }
+                     "makeDbNets connected mterm '{}' (id={}) to net "
+                     "'{}' (id={})",
+                     mterm->getName(),
+                     mterm->getId(),
+                     db_net->getName(),
+                     db_net->getId());
         }
       }
     }
   }
+}
 
-  // Recursion into child module instances
-  std::unique_ptr<InstanceChildIterator> child_iter{
-      network_->childIterator(inst)};
-  while (child_iter->hasNext()) {
-    const Instance* child = child_iter->next();
-    makeDbNets(child, visited_pins);
+dbInst* Verilog2db::findDbInst(const Instance* inst)
+{
+  auto it = inst_map_.find(inst);
+  if (it != inst_map_.end()) {
+    return it->second;
   }
+  const std::string inst_name = network_->pathName(inst);
+  return block_->findInst(inst_name.c_str());
+}
+
+dbMTerm* Verilog2db::findMTerm(dbInst* db_inst, const Pin* pin)
+{
+  // A leaf cell port always maps to the same mterm of the cell's master.
+  const Port* port = network_->port(pin);
+  auto it = mterm_map_.find(port);
+  if (it != mterm_map_.end()) {
+    return it->second;
+  }
+  const std::string port_name = network_->portName(pin);
+  dbMTerm* mterm = db_inst->getMaster()->findMTerm(block_, port_name.c_str());
+  mterm_map_[port] = mterm;
+  return mterm;
 }
 
 void Verilog2db::makeModNetsForSubmodules(InstPairs& inst_pairs)
@@ -1190,6 +1345,7 @@ void Verilog2db::makeUnusedBlock(const char* name)
 //
 void Verilog2db::makeUnusedDbNetlist()
 {
+  beginNetlist();
   recordBusPortsOrder();
   Instance* inst = network_->topInstance();
   dbModule* module = block_->getTopModule();
@@ -1200,6 +1356,7 @@ void Verilog2db::makeUnusedDbNetlist()
   // Create top-level
   PinSet visited_pins(network_);
   makeDbNets(inst, visited_pins);
+  flushDbNets();
   makeModNets(inst);
   if (hierarchy_) {
     makeModNetsForSubmodules(inst_pairs);
@@ -1207,6 +1364,7 @@ void Verilog2db::makeUnusedDbNetlist()
   for (auto inst : dont_touch_insts_) {
     inst->setDoNotTouch(true);
   }
+  endNetlist();
 }
 
 //
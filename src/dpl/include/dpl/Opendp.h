@@ -46,6 +46,7 @@ class Padding;
 class PixelPt;
 class PlacementDRC;
 class Journal;
+class OdbCallBack;
 
 template <typename T>
 struct TypedCoordinate;
@@ -128,6 +129,10 @@ class Opendp
   void setDeepIterativePlacement(bool deep_iterative);
   void setNegotiationDebugInterval(int iterative_jump);
   void setNegotiationDebugStart(int iterative_start);
+  // Overrides the active cell count at which the negotiation legalizer
+  // sweeps row bands in parallel; negative keeps the default.
+  void setNegotiationMinBandCells(int min_band_cells);
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
 
   // Global padding.
   int padGlobalLeft() const;
@@ -206,6 +211,7 @@ class Opendp
   friend class Graphics;
   friend class CellPlaceOrderLess;
   friend class NegotiationLegalizer;
+  friend class OdbCallBack;
   void findDisplacementStats();
   DbuPt pointOffMacro(const Node& cell);
   void convertDbToCell(odb::dbInst* db_inst, Node& cell);
@@ -223,6 +229,17 @@ class Opendp
   bool isMultiRow(const Node* cell) const;
   void updateDbInstLocations();
 
+  // Incremental legalization of the instances edited since the last
+  // detailed placement, on the network and grid kept from that run.
+  // Returns false when the edits need a full import.
+  bool importEcoInsts(int max_displacement_x, int max_displacement_y);
+  void armEcoPlacement();
+  void disarmEcoPlacement();
+  // Erase the kept footprint of an edited instance.
+  void eraseEcoInst(odb::dbInst* inst);
+  // Erase and drop the kept cell of a destroyed instance.
+  void removeEcoInst(odb::dbInst* inst);
+
   void initGrid();
 
   void initPlacementDRC();
@@ -375,12 +392,17 @@ class Opendp
   std::shared_ptr<Padding> padding_;
   std::unique_ptr<PlacementDRC> drc_engine_;
   Journal* journal_ = nullptr;
+  // Set when the network and grid match the db after a detailed placement,
+  // up to the edits recorded by db_cbk_.
+  bool eco_ready_ = false;
+  std::unique_ptr<OdbCallBack> db_cbk_;
 
   // DPL-wide displacement budget set via detailedPlacement() and honored
   // by every DPL pass (diamond search, and negotiation).
   int max_displacement_x_ = 0;  // sites
   int max_displacement_y_ = 0;  // rows
   bool disallow_one_site_gaps_ = false;
+  int num_threads_ = 1;
   std::vector<Node*> placement_failures_;
 
   // 2D pixel grid
@@ -412,6 +434,7 @@ class Opendp
   bool deep_iterative_debug_ = false;
   int negotiation_debug_interval_ = 1;
   int negotiation_debug_start_ = 0;
+  int negotiation_min_band_cells_ = -1;
   bool incremental_ = false;
   bool use_diamond_legalizer_ = false;
 
@@ -114,6 +114,8 @@ void Opendp::insertDecapCells(const double target, IRDropByPoint& psm_ir_drops)
     importDb();
     adjustNodesOrient();
   }
+  // The new instances are painted on the grid kept for -incremental.
+  disarmEcoPlacement();
 
   double total_cap = 0.0;
   decap_count_ = 0;
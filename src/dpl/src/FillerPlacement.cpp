@@ -96,6 +96,8 @@ void Opendp::fillerPlacement(const dbMasterSeq& filler_masters,
     importDb();
     adjustNodesOrient();
   }
+  // The new instances are painted on the grid kept for -incremental.
+  disarmEcoPlacement();
 
   const auto filtered_masters = filterFillerMasters(filler_masters);
 
@@ -42,6 +42,8 @@ constexpr double kAlpha = 0.7;         // adaptive-pf α
 constexpr double kBeta = 10.0;         // adaptive-pf β
 constexpr double kGamma = 0.005;       // adaptive-pf γ
 constexpr int kIth = 300;              // pf ramp-up threshold iteration
+constexpr int kMinBandRows = 64;       // row-band sweep: min band height
+constexpr int kMinBandCells = 20000;   // row-band sweep: min active cells
 
 // ---------------------------------------------------------------------------
 // FenceRect / FenceRegion
@@ -125,6 +127,7 @@ class NegotiationLegalizer
   void setRowSearchWindow(int w) { row_search_window_ = w; }
   void setDrcPenalty(double p) { drc_penalty_ = p; }
   void setNumThreads(int n) { num_threads_ = n; }
+  void setMinBandCells(int n) { min_band_cells_ = n; }
   // When set, site_search_window_/row_search_window_ are used as hard
   // ranges: disables both window extensions.
   void setDisableWindowExtension(bool disable)
@@ -156,6 +159,14 @@ class NegotiationLegalizer
                       int iter,
                       bool updateHistory,
                       bool print_row);
+  // Multi-threaded sweep over row bands; returns false when the serial
+  // sweep must be used instead (see negotiationIter).  Adds the cells it
+  // ripped up and replaced to moves_count.
+  bool negotiationBandSweep(const std::vector<int>& activeCells,
+                            int iter,
+                            int& moves_count);
+  // Rips up and replaces one cell; returns false when it was skipped.
+  bool negotiateCell(int cell_idx, int iter);
   void ripUp(int cell_idx);
   void place(int cell_idx, int x, int y);
   [[nodiscard]] std::pair<int, int> findBestLocation(int cell_idx,
@@ -289,6 +300,7 @@ class NegotiationLegalizer
 
   double drc_penalty_{kDrcPenalty};
   int num_threads_{1};
+  int min_band_cells_{kMinBandCells};
   bool disable_window_extension_{false};
 
   // Stuck-cell tallies for the current runNegotiation call. Reset at the
@@ -23,6 +23,7 @@
 #include "odb/db.h"
 #include "odb/geom.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 namespace dpl {
 
@@ -306,28 +307,30 @@ int NegotiationLegalizer::negotiationIter(std::vector<int>& activeCells,
   int moves_count = 0;
   sortByNegotiationOrder(activeCells);
 
-  for (int idx : activeCells) {
-    if (cells_[idx].fixed) {
-      continue;
-    }
-    // Isolation point: skip legal cells during phase 2.
-    if (iter >= kIsolationPt && isCellLegal(idx)) {
-      continue;
+  if (!negotiationBandSweep(activeCells, iter, moves_count)) {
+    for (int idx : activeCells) {
+      if (cells_[idx].fixed) {
+        continue;
+      }
+      // Isolation point: skip legal cells during phase 2.
+      if (iter >= kIsolationPt && isCellLegal(idx)) {
+        continue;
+      }
+      ripUp(idx);
+      const auto [bx, by] = findBestLocation(idx, iter);
+      place(idx, bx, by);
+      moves_count++;
+      debugPrint(logger_,
+                 utl::DPL,
+                 "negotiation",
+                 2,
+                 "Negotiation iter {}, cell {}, moves {}, best location {}, {}",
+                 iter,
+                 cells_[idx].db_inst->getName(),
+                 moves_count,
+                 bx,
+                 by);
     }
-    ripUp(idx);
-    const auto [bx, by] = findBestLocation(idx, iter);
-    place(idx, bx, by);
-    moves_count++;
-    debugPrint(logger_,
-               utl::DPL,
-               "negotiation",
-               2,
-               "Negotiation iter {}, cell {}, moves {}, best location {}, {}",
-               iter,
-               cells_[idx].db_inst->getName(),
-               moves_count,
-               bx,
-               by);
   }
 
   // Re-sync the DPL pixel grid before checking violations.  During the
@@ -430,6 +433,123 @@ int NegotiationLegalizer::negotiationIter(std::vector<int>& activeCells,
   return totalViolations;
 }
 
+// ===========================================================================
+// negotiationBandSweep – row-band parallel variant of the negotiationIter
+// rip-up/replace loop
+// ===========================================================================
+
+// The die is cut into horizontal bands at least twice as tall as the rows any
+// active cell can touch around its anchors, so a cell of band k never reads or
+// writes a pixel (usage, history or DPL occupancy) that a cell of band k + 2
+// does.  Even bands are swept concurrently, then odd bands, each band in
+// negotiation order.  Cells whose reach crosses into the shared boundary rows
+// of a neighbouring band are swept serially afterwards.  History costs stay
+// on the shared grid and are bumped after the sweep, so every band sees the
+// congestion its neighbours left at the band borders in the last iteration.
+//
+// The band layout depends only on the cells, not on the thread count, so the
+// result is the same for any num_threads_ > 1.  Small designs and debug runs
+// (the observer and the level-2 stuck-cell tallies are not thread safe) keep
+// the serial sweep.
+bool NegotiationLegalizer::negotiationBandSweep(
+    const std::vector<int>& activeCells,
+    int iter,
+    int& moves_count)
+{
+  if (num_threads_ <= 1 || std::cmp_less(activeCells.size(), min_band_cells_)
+      || debug_observer_ != nullptr
+      || logger_->debugCheck(utl::DPL, "negotiation", 2)) {
+    return false;
+  }
+
+  // Rows a cell may touch beyond its anchor row: verticalWindowRows extends
+  // up to twice the row cap, plus the footprint and one row of slack for the
+  // DRC neighbour lookups.
+  auto rowReach = [this](const NegCell& cell) {
+    return 2 * effectiveRowCap(cell) + cell.height + 1;
+  };
+  int halo = 0;
+  for (int idx : activeCells) {
+    if (!cells_[idx].fixed) {
+      halo = std::max(halo, rowReach(cells_[idx]));
+    }
+  }
+  const int band_rows = std::max(2 * halo, kMinBandRows);
+  const int num_bands = (grid_h_ + band_rows - 1) / band_rows;
+  if (num_bands < 3) {
+    return false;
+  }
+
+  std::vector<std::vector<int>> bands(num_bands);
+  std::vector<int> border_cells;
+  for (int idx : activeCells) {
+    const NegCell& cell = cells_[idx];
+    if (cell.fixed) {
+      continue;
+    }
+    const int band = std::clamp(cell.y / band_rows, 0, num_bands - 1);
+    const int lo = std::min(cell.y, cell.init_y) - rowReach(cell);
+    const int hi = std::max(cell.y, cell.init_y) + rowReach(cell);
+    if (lo >= band * band_rows - halo && hi <= (band + 1) * band_rows + halo) {
+      bands[band].push_back(idx);
+    } else {
+      border_cells.push_back(idx);
+    }
+  }
+
+  // Each band counts its own moves so the workers never share a counter.
+  std::vector<int> band_moves(num_bands, 0);
+  utl::ThreadPool pool(std::min(num_threads_, (num_bands + 1) / 2));
+  for (int parity = 0; parity < 2; ++parity) {
+    std::vector<int> batch;
+    for (int band = parity; band < num_bands; band += 2) {
+      if (!bands[band].empty()) {
+        batch.push_back(band);
+      }
+    }
+    pool.parallelFor(batch, [&](const int band) {
+      for (int idx : bands[band]) {
+        if (negotiateCell(idx, iter)) {
+          band_moves[band]++;
+        }
+      }
+    });
+  }
+  for (int idx : border_cells) {
+    if (negotiateCell(idx, iter)) {
+      moves_count++;
+    }
+  }
+  for (int moves : band_moves) {
+    moves_count += moves;
+  }
+
+  debugPrint(logger_,
+             utl::DPL,
+             "negotiation",
+             1,
+             "Negotiation iter {}: {} row bands of {} rows, {} border cells, "
+             "{} moves.",
+             iter,
+             num_bands,
+             band_rows,
+             border_cells.size(),
+             moves_count);
+  return true;
+}
+
+bool NegotiationLegalizer::negotiateCell(int cell_idx, int iter)
+{
+  // Isolation point: skip legal cells during phase 2.
+  if (iter >= kIsolationPt && isCellLegal(cell_idx)) {
+    return false;
+  }
+  ripUp(cell_idx);
+  const auto [bx, by] = findBestLocation(cell_idx, iter);
+  place(cell_idx, bx, by);
+  return true;
+}
+
 // ===========================================================================
 // ripUp / place
 // ===========================================================================
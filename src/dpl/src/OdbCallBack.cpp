@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "OdbCallBack.h"
+
+#include <unordered_set>
+#include <vector>
+
+#include "dpl/Opendp.h"
+#include "infrastructure/Objects.h"
+#include "infrastructure/network.h"
+#include "odb/db.h"
+
+namespace dpl {
+
+OdbCallBack::OdbCallBack(Opendp* opendp) : opendp_(opendp)
+{
+}
+
+void OdbCallBack::reset()
+{
+  valid_ = true;
+  dirty_insts_.clear();
+  dirty_set_.clear();
+  rewired_insts_.clear();
+  rewired_set_.clear();
+  num_removed_ = 0;
+}
+
+namespace {
+
+std::vector<odb::dbInst*> liveInsts(
+    const std::vector<odb::dbInst*>& insts,
+    const std::unordered_set<odb::dbInst*>& live)
+{
+  std::vector<odb::dbInst*> result;
+  std::unordered_set<odb::dbInst*> seen;
+  for (odb::dbInst* inst : insts) {
+    if (live.contains(inst) && seen.insert(inst).second) {
+      result.push_back(inst);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+std::vector<odb::dbInst*> OdbCallBack::getDirtyInsts() const
+{
+  return liveInsts(dirty_insts_, dirty_set_);
+}
+
+std::vector<odb::dbInst*> OdbCallBack::getRewiredInsts() const
+{
+  std::vector<odb::dbInst*> insts;
+  for (odb::dbInst* inst : liveInsts(rewired_insts_, rewired_set_)) {
+    if (!dirty_set_.contains(inst)) {
+      insts.push_back(inst);
+    }
+  }
+  return insts;
+}
+
+void OdbCallBack::markDirty(odb::dbInst* inst)
+{
+  if (!valid_) {
+    return;
+  }
+  if (inst->isFixed() || !inst->getMaster()->isCoreAutoPlaceable()) {
+    // Fixed instances are painted as obstructions; editing one changes the
+    // grid the kept cells were legalized against.
+    invalidate();
+    return;
+  }
+  if (dirty_set_.insert(inst).second) {
+    dirty_insts_.push_back(inst);
+    // The kept node still has the old location and master.
+    opendp_->eraseEcoInst(inst);
+  }
+}
+
+void OdbCallBack::markRewired(odb::dbInst* inst)
+{
+  if (valid_ && rewired_set_.insert(inst).second) {
+    rewired_insts_.push_back(inst);
+  }
+}
+
+void OdbCallBack::inDbInstCreate(odb::dbInst* inst)
+{
+  markDirty(inst);
+}
+
+void OdbCallBack::inDbInstDestroy(odb::dbInst* inst)
+{
+  if (!valid_) {
+    return;
+  }
+  dirty_set_.erase(inst);
+  rewired_set_.erase(inst);
+  const Node* cell = opendp_->network_->getNode(inst);
+  if (cell == nullptr) {
+    return;
+  }
+  if (cell->isFixed()) {
+    invalidate();
+    return;
+  }
+  opendp_->removeEcoInst(inst);
+  num_removed_++;
+}
+
+void OdbCallBack::inDbInstPlacementStatusBefore(
+    odb::dbInst* inst,
+    const odb::dbPlacementStatus& status)
+{
+  if (inst->isFixed() != status.isFixed()) {
+    invalidate();
+    return;
+  }
+  markDirty(inst);
+}
+
+void OdbCallBack::inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                           odb::dbMaster* /* master */)
+{
+  // Before the swap, so that the old footprint and padding are erased.
+  markDirty(inst);
+}
+
+void OdbCallBack::inDbPostMoveInst(odb::dbInst* inst)
+{
+  markDirty(inst);
+}
+
+void OdbCallBack::inDbNetDestroy(odb::dbNet* net)
+{
+  if (valid_) {
+    opendp_->network_->removeEdge(net);
+  }
+}
+
+void OdbCallBack::inDbITermPreDisconnect(odb::dbITerm* iterm)
+{
+  markRewired(iterm->getInst());
+}
+
+void OdbCallBack::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  markRewired(iterm->getInst());
+}
+
+void OdbCallBack::inDbBlockageCreate(odb::dbBlockage* /* blockage */)
+{
+  invalidate();
+}
+
+void OdbCallBack::inDbBlockageDestroy(odb::dbBlockage* /* blockage */)
+{
+  invalidate();
+}
+
+void OdbCallBack::inDbRegionCreate(odb::dbRegion* /* region */)
+{
+  invalidate();
+}
+
+void OdbCallBack::inDbRegionDestroy(odb::dbRegion* /* region */)
+{
+  invalidate();
+}
+
+void OdbCallBack::inDbRowCreate(odb::dbRow* /* row */)
+{
+  invalidate();
+}
+
+void OdbCallBack::inDbRowDestroy(odb::dbRow* /* row */)
+{
+  invalidate();
+}
+
+}  // namespace dpl
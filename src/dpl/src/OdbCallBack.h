@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
+
+namespace dpl {
+
+class Opendp;
+
+// Attached between a detailed_placement and the next one. Records the
+// instances created, moved, resized or re-statused and the instances whose
+// pins were rewired, so that an incremental call only revisits those on the
+// network and grid kept from the previous call. The footprint of a kept
+// cell is erased from the grid when it is first edited and destroyed
+// instances are removed right away. Edits the incremental path cannot
+// replay (rows, blockages, regions, fixed instances) invalidate the kept
+// state.
+class OdbCallBack : public odb::dbBlockCallBackObj
+{
+ public:
+  explicit OdbCallBack(Opendp* opendp);
+
+  void inDbInstCreate(odb::dbInst* inst) override;
+  void inDbInstDestroy(odb::dbInst* inst) override;
+  void inDbInstPlacementStatusBefore(
+      odb::dbInst* inst,
+      const odb::dbPlacementStatus& status) override;
+  void inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                odb::dbMaster* master) override;
+  void inDbPostMoveInst(odb::dbInst* inst) override;
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbITermPreDisconnect(odb::dbITerm* iterm) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbBlockageCreate(odb::dbBlockage* blockage) override;
+  void inDbBlockageDestroy(odb::dbBlockage* blockage) override;
+  void inDbRegionCreate(odb::dbRegion* region) override;
+  void inDbRegionDestroy(odb::dbRegion* region) override;
+  void inDbRowCreate(odb::dbRow* row) override;
+  void inDbRowDestroy(odb::dbRow* row) override;
+
+  void reset();
+  bool isValid() const { return valid_; }
+  // Edited instances that still exist, in the order they were first
+  // touched.
+  std::vector<odb::dbInst*> getDirtyInsts() const;
+  // Instances with rewired pins that were not otherwise edited.
+  std::vector<odb::dbInst*> getRewiredInsts() const;
+  int getNumRemoved() const { return num_removed_; }
+
+ private:
+  void invalidate() { valid_ = false; }
+  void markDirty(odb::dbInst* inst);
+  void markRewired(odb::dbInst* inst);
+
+  Opendp* opendp_;
+  bool valid_ = false;
+  // The vectors keep the order, the sets drop the destroyed instances.
+  std::vector<odb::dbInst*> dirty_insts_;
+  std::unordered_set<odb::dbInst*> dirty_set_;
+  std::vector<odb::dbInst*> rewired_insts_;
+  std::unordered_set<odb::dbInst*> rewired_set_;
+  int num_removed_ = 0;
+};
+
+}  // namespace dpl
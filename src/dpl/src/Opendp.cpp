@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "NegotiationLegalizer.h"
+#include "OdbCallBack.h"
 #include "PlacementDRC.h"
 #include "boost/geometry/index/predicates.hpp"
 #include "dpl/OptMirror.h"
@@ -30,6 +31,7 @@
 #include "odb/util.h"
 #include "util/journal.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/timer.h"
 
 namespace dpl {
@@ -63,6 +65,7 @@ Opendp::Opendp(odb::dbDatabase* db, utl::Logger* logger)
   network_ = std::make_unique<Network>();
   network_->init(logger);
   arch_ = std::make_unique<Architecture>();
+  db_cbk_ = std::make_unique<OdbCallBack>(this);
 }
 
 Opendp::~Opendp() = default;
@@ -70,16 +73,19 @@ Opendp::~Opendp() = default;
 void Opendp::setPaddingGlobal(const int left, const int right)
 {
   padding_->setPaddingGlobal(GridX{left}, GridX{right});
+  disarmEcoPlacement();
 }
 
 void Opendp::setPadding(odb::dbInst* inst, const int left, const int right)
 {
   padding_->setPadding(inst, GridX{left}, GridX{right});
+  disarmEcoPlacement();
 }
 
 void Opendp::setPadding(odb::dbMaster* master, const int left, const int right)
 {
   padding_->setPadding(master, GridX{left}, GridX{right});
+  disarmEcoPlacement();
 }
 
 void Opendp::setDebug(std::unique_ptr<DplObserver>& observer)
@@ -115,6 +121,11 @@ void Opendp::setNegotiationDebugStart(const int iterative_start)
   negotiation_debug_start_ = std::max(0, iterative_start);
 }
 
+void Opendp::setNegotiationMinBandCells(const int min_band_cells)
+{
+  negotiation_min_band_cells_ = min_band_cells;
+}
+
 void Opendp::setJournal(Journal* journal)
 {
   journal_ = journal;
@@ -135,15 +146,28 @@ void Opendp::detailedPlacement(const int max_displacement_x,
                                const double drc_penalty,
                                const bool disable_window_extension)
 {
+  utl::TraceScope trace("dpl::detailedPlacement");
   utl::Timer timer;
+  // Zero selects the default displacement limits.
+  const bool default_displacement
+      = max_displacement_x == 0 || max_displacement_y == 0;
+  const int displacement_x = default_displacement ? 500 : max_displacement_x;
+  const int displacement_y = default_displacement ? 100 : max_displacement_y;
+
   incremental_ = incremental;
   use_diamond_legalizer_ |= use_diamond_legalizer;
-  importDb();
-  adjustNodesOrient();
-  if (!incremental_) {
-    for (const auto& node : network_->getNodes()) {
-      if (node->getType() == Node::CELL && !node->isFixed()) {
-        node->setPlaced(false);
+  // Reuse the network and grid of the previous run when only movable
+  // cells were edited since then.
+  const bool eco
+      = incremental_ && importEcoInsts(displacement_x, displacement_y);
+  if (!eco) {
+    importDb();
+    adjustNodesOrient();
+    if (!incremental_) {
+      for (const auto& node : network_->getNodes()) {
+        if (node->getType() == Node::CELL && !node->isFixed()) {
+          node->setPlaced(false);
+        }
       }
     }
   }
@@ -204,13 +228,8 @@ void Opendp::detailedPlacement(const int max_displacement_x,
   odb::WireLengthEvaluator eval(block_);
   hpwl_before_ = eval.hpwl();
 
-  if (max_displacement_x == 0 || max_displacement_y == 0) {
-    max_displacement_x_ = 500;
-    max_displacement_y_ = 100;
-  } else {
-    max_displacement_x_ = max_displacement_x;
-    max_displacement_y_ = max_displacement_y;
-  }
+  max_displacement_x_ = displacement_x;
+  max_displacement_y_ = displacement_y;
 
   logger_->info(DPL,
                 5,
@@ -221,7 +240,12 @@ void Opendp::detailedPlacement(const int max_displacement_x,
 
   if (use_diamond_legalizer_) {
     logger_->info(DPL, 1101, "Legalizing using diamond search.");
-    diamondDPL();
+    if (eco) {
+      placement_failures_.clear();
+      place();
+    } else {
+      diamondDPL();
+    }
     findDisplacementStats();
     updateDbInstLocations();
     if (!placement_failures_.empty()) {
@@ -239,20 +263,27 @@ void Opendp::detailedPlacement(const int max_displacement_x,
       }
       logger_->error(DPL, 36, "Detailed placement failed inside DPL.");
     }
+    armEcoPlacement();
   } else {
-    initGrid();
-    setFixedGridCells();
-    // Populate pixel->group for each fence region so diamondRecovery's
-    // underlying diamondSearch correctly enforces region constraints.
-    if (!arch_->getRegions().empty()) {
-      groupInitPixels2();
-      groupInitPixels();
+    if (!eco) {
+      initGrid();
+      setFixedGridCells();
+      // Populate pixel->group for each fence region so diamondRecovery's
+      // underlying diamondSearch correctly enforces region constraints.
+      if (!arch_->getRegions().empty()) {
+        groupInitPixels2();
+        groupInitPixels();
+      }
     }
     logger_->info(DPL, 1102, "Legalizing using negotiation legalizer.");
 
     NegotiationLegalizer negotiation(
         this, db_, logger_, debug_observer_.get(), network_.get());
     negotiation.setDisableWindowExtension(disable_window_extension);
+    negotiation.setNumThreads(num_threads_);
+    if (negotiation_min_band_cells_ >= 0) {
+      negotiation.setMinBandCells(negotiation_min_band_cells_);
+    }
     if (site_search_window >= 0) {
       negotiation.setSiteSearchWindow(site_search_window);
     }
@@ -282,6 +313,11 @@ void Opendp::detailedPlacement(const int max_displacement_x,
 
     findDisplacementStats();
     updateDbInstLocations();
+    if (negotiation.numViolations() == 0) {
+      armEcoPlacement();
+    } else {
+      disarmEcoPlacement();
+    }
   }
   logger_->info(DPL, 500, "Runtime: {:.2f}s", timer.elapsed());
 }
@@ -306,6 +342,92 @@ void Opendp::updateDbInstLocations()
   }
 }
 
+////////////////////////////////////////////////////////////////
+
+bool Opendp::importEcoInsts(const int max_displacement_x,
+                            const int max_displacement_y)
+{
+  if (!eco_ready_ || !db_cbk_->isValid() || db_->getChip() == nullptr
+      || db_->getChip()->getBlock() != block_
+      || max_displacement_x != max_displacement_x_
+      || max_displacement_y != max_displacement_y_) {
+    return false;
+  }
+
+  // The callback already erased the footprints of the edited cells and
+  // dropped the removed ones. It is detached until this run legalizes every
+  // cell so that the legalizer's own moves are not recorded.
+  const std::vector<dbInst*> edited = db_cbk_->getDirtyInsts();
+  const std::vector<dbInst*> rewired = db_cbk_->getRewiredInsts();
+  const int removed = db_cbk_->getNumRemoved();
+  db_cbk_->removeOwner();
+  eco_ready_ = false;
+
+  for (dbInst* inst : rewired) {
+    network_->updatePins(inst);
+  }
+  for (dbInst* inst : edited) {
+    network_->addMaster(inst->getMaster(), grid_.get(), drc_engine_.get());
+    network_->updateNode(inst);
+    Node* cell = network_->getNode(inst);
+    cell->adjustCurrOrient(inst->getOrient());
+    // The legalizers only move unplaced cells off their db location.
+    cell->setPlaced(false);
+  }
+  logger_->info(DPL,
+                1105,
+                "Legalizing {} edited and {} removed instances incrementally.",
+                edited.size(),
+                removed);
+  return true;
+}
+
+void Opendp::eraseEcoInst(dbInst* inst)
+{
+  Node* cell = network_->getNode(inst);
+  if (cell != nullptr && cell->isPlaced()) {
+    grid_->erasePixel(cell);
+  }
+}
+
+void Opendp::removeEcoInst(dbInst* inst)
+{
+  // Erased while the instance still exists, as its padding is looked up
+  // from it.
+  eraseEcoInst(inst);
+  network_->removeNode(inst);
+}
+
+void Opendp::armEcoPlacement()
+{
+  if (!arch_->getRegions().empty()) {
+    // Region pixels are only assigned by the full flow.
+    disarmEcoPlacement();
+    return;
+  }
+
+  // Both legalizers leave the grid painted with the final locations.
+  for (auto& node : network_->getNodes()) {
+    if (node->getType() == Node::CELL && !node->isFixed()
+        && node->isPlaced()) {
+      // Report the displacement of the next run from here.
+      node->setOrigLeft(node->getLeft());
+      node->setOrigBottom(node->getBottom());
+    }
+  }
+  db_cbk_->reset();
+  if (!db_cbk_->hasOwner()) {
+    db_cbk_->addOwner(block_);
+  }
+  eco_ready_ = true;
+}
+
+void Opendp::disarmEcoPlacement()
+{
+  eco_ready_ = false;
+  db_cbk_->removeOwner();
+}
+
 void Opendp::reportLegalizationStats() const
 {
   logger_->report("Placement Analysis");
@@ -34,6 +34,7 @@ detailed_placement_cmd(int max_displacment_x,
                        double drc_penalty,
                        bool disable_window_extension){
   dpl::Opendp *opendp = ord::OpenRoad::openRoad()->getOpendp();
+  opendp->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
   opendp->detailedPlacement(max_displacment_x, max_displacment_y,
                             std::string(report_file_name),
                             incremental, use_diamond_legalizer,
@@ -137,11 +138,18 @@ void set_negotiation_debug_start_cmd(int iterative_start)
   opendp->setNegotiationDebugStart(iterative_start);
 }
 
+void set_negotiation_min_band_cells_cmd(int min_band_cells)
+{
+  dpl::Opendp* opendp = ord::OpenRoad::openRoad()->getOpendp();
+  opendp->setNegotiationMinBandCells(min_band_cells);
+}
+
 void improve_placement_cmd(int seed,
   int max_displacement_x,
   int max_displacement_y)
 {
   dpl::Opendp* opendp = ord::OpenRoad::openRoad()->getOpendp();
+  opendp->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
   opendp->improvePlacement(seed, max_displacement_x, max_displacement_y);
 }
 
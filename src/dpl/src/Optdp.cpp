@@ -97,6 +97,7 @@ void Opendp::improvePlacement(const int seed,
   mgr.setLogger(logger_);
   mgr.setGlobalSwapParams(global_swap_params_);
   mgr.setExtraDplEnabled(extra_dpl_enabled_);
+  mgr.setNumThreads(num_threads_);
   // Various settings.
   mgr.setSeed(seed);
   mgr.setMaxDisplacement(max_displacement_x, max_displacement_y);
@@ -170,6 +170,8 @@ std::optional<bool> orientFlipsY(const odb::dbOrientType& orient)
 
 void Opendp::importDb()
 {
+  // The network and grid are rebuilt, so the kept ECO state is stale.
+  disarmEcoPlacement();
   block_ = db_->getChip()->getBlock();
   core_ = block_->getCoreArea();
   grid_->setCore(core_);
@@ -357,6 +357,11 @@ void Node::addPin(Pin* pin)
 {
   pins_.emplace_back(pin);
 }
+void Node::clearPins()
+{
+  pins_.clear();
+  used_layers_ = 0;
+}
 void Node::setGroupId(int id)
 {
   group_id_ = id;
@@ -129,6 +129,8 @@ class Node
   void setRegion(const odb::Rect* in);
   void setMaster(Master* in);
   void addPin(Pin* pin);
+  // Forgets the pins along with the layers they use.
+  void clearPins();
   void setGroupId(int id);
   void addUsedLayer(int layer);
 
@@ -154,8 +154,13 @@ void Network::addEdge(odb::dbNet* net)
       // skip unplaced terminals
       continue;
     }
+    // Terminals created after the network was built have no node.
+    Node* node = getNode(bterm);
+    if (node == nullptr) {
+      continue;
+    }
     Pin* ptr = addPin(bterm);
-    connect(ptr, getNode(bterm));
+    connect(ptr, node);
     connect(ptr, edge);
   }
 
@@ -425,6 +430,95 @@ void Network::addNode(odb::dbInst* inst)
   Node ndi;
   const int id = nodes_.size();
   ndi.setId(id);
+  initNode(ndi, inst);
+  nodes_.emplace_back(std::make_unique<Node>(ndi));
+  inst_to_node_idx_[inst] = id;
+  ++cells_cnt_;
+}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void Network::updateNode(odb::dbInst* inst)
+{
+  Node* ndi = getNode(inst);
+  if (ndi == nullptr) {
+    addNode(inst);
+    ndi = getNode(inst);
+  } else {
+    detachPins(ndi);
+    initNode(*ndi, inst);
+  }
+  connectPins(ndi, inst);
+}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void Network::updatePins(odb::dbInst* inst)
+{
+  Node* ndi = getNode(inst);
+  if (ndi == nullptr) {
+    return;
+  }
+  detachPins(ndi);
+  connectPins(ndi, inst);
+}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void Network::connectPins(Node* ndi, odb::dbInst* inst)
+{
+  std::vector<odb::dbNet*> added_nets;
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    odb::dbNet* net = iterm->getNet();
+    // Supply nets have no edges, see createNetwork().
+    if (net == nullptr || net->getSigType().isSupply()
+        || std::ranges::find(added_nets, net) != added_nets.end()) {
+      continue;
+    }
+    Edge* edge = getEdge(net);
+    if (edge == nullptr) {
+      // addEdge() connects the pins of every cell on the net, this one
+      // included.
+      addEdge(net);
+      added_nets.push_back(net);
+      continue;
+    }
+    Pin* ptr = addPin(iterm);
+    connect(ptr, ndi);
+    connect(ptr, edge);
+  }
+}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void Network::removeNode(odb::dbInst* inst)
+{
+  auto it = inst_to_node_idx_.find(inst);
+  if (it == inst_to_node_idx_.end()) {
+    return;
+  }
+  Node* ndi = nodes_[it->second].get();
+  detachPins(ndi);
+  ndi->setType(Node::UNKNOWN);
+  ndi->setDbInst(nullptr);
+  ndi->setFixed(true);
+  ndi->setPlaced(false);
+  inst_to_node_idx_.erase(it);
+  --cells_cnt_;
+}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void Network::detachPins(Node* ndi)
+{
+  for (Pin* pin : ndi->getPins()) {
+    if (pin->getEdge() != nullptr) {
+      pin->getEdge()->removePin(pin);
+    }
+    pin->setEdge(nullptr);
+    pin->setNode(nullptr);
+  }
+  ndi->clearPins();
+}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void Network::initNode(Node& ndi, odb::dbInst* inst)
+{
   ndi.setDbInst(inst);
   ndi.setType(Node::CELL);
   auto master = getMaster(inst->getMaster());
@@ -441,9 +535,6 @@ void Network::addNode(odb::dbInst* inst)
   ndi.setBottom(ndi.getOrigBottom());
   ndi.setBottomPower(master->getBottomPowerType());
   ndi.setTopPower(master->getTopPowerType());
-  nodes_.emplace_back(std::make_unique<Node>(ndi));
-  inst_to_node_idx_[inst] = id;
-  ++cells_cnt_;
 }
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
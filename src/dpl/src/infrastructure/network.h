@@ -59,6 +59,14 @@ class Network
   // For creating and adding cells.
   void addNode(odb::dbInst*);
   void addNode(odb::dbBTerm*);
+  // Add a cell, or refresh its master, size and original location from the
+  // db, and connect its pins to their edges.
+  void updateNode(odb::dbInst*);
+  // Reconnect the pins of a cell after its instance was rewired.
+  void updatePins(odb::dbInst*);
+  // Detach a cell from its instance and its edges. Node ids are indices, so
+  // the node stays in place as an inert UNKNOWN node.
+  void removeNode(odb::dbInst*);
   void addFillerNode(DbuX left,
                      DbuY bottom,
                      DbuX width,
@@ -66,6 +74,9 @@ class Network
 
   // For creating and adding edges.
   void addEdge(odb::dbNet* net);
+  // Forget the edge of a destroyed net. Its pins are detached when their
+  // cells are updated.
+  void removeEdge(odb::dbNet* net) { net_to_edge_idx_.erase(net); }
 
   // For creating masters.
   Master* addMaster(odb::dbMaster* db_master,
@@ -80,6 +91,12 @@ class Network
   const odb::Rect& getCore() const { return core_; }
 
  private:
+  void initNode(Node& ndi, odb::dbInst* inst);
+  // The detached pins stay owned by the network until clear().
+  void detachPins(Node* ndi);
+  // Connect the pins of a cell, adding the edges of nets created since the
+  // network was built.
+  void connectPins(Node* ndi, odb::dbInst* inst);
   Pin* addPin(odb::dbITerm* term);
   Pin* addPin(odb::dbBTerm* term);
   void connect(Pin* pin, Node* node);
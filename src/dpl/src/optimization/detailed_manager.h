@@ -98,6 +98,8 @@ class DetailedMgr
   }
   void setExtraDplEnabled(bool enabled) { extra_dpl_enabled_ = enabled; }
   bool isExtraDplEnabled() const { return extra_dpl_enabled_; }
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+  int getNumThreads() const { return num_threads_; }
   int getMaxDisplacementX() const { return maxDispX_; }
   int getMaxDisplacementY() const { return maxDispY_; }
   bool getDisallowOneSiteGaps() const { return disallowOneSiteGaps_; }
@@ -357,6 +359,7 @@ class DetailedMgr
   double targetUt_{1.0};
   GlobalSwapParams global_swap_params_;
   bool extra_dpl_enabled_ = false;
+  int num_threads_ = 1;
 
   // Target displacement limits.
   int maxDispX_;
@@ -11,6 +11,7 @@
 #include <limits>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "boost/token_functions.hpp"
@@ -23,11 +24,34 @@
 #include "infrastructure/detailed_segment.h"
 #include "util/utility.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 using utl::DPL;
 
 namespace dpl {
 
+namespace {
+
+void addPending(DetailedReorderer::PendingSegs& pending, const int seg)
+{
+  // Segments are registered in order.
+  if (!pending.empty() && pending.back().first == seg) {
+    ++pending.back().second;
+  } else {
+    pending.emplace_back(seg, 1);
+  }
+}
+
+void removePending(DetailedReorderer::PendingSegs& pending, const int seg)
+{
+  auto it = std::ranges::find(pending, seg, &std::pair<int, int>::first);
+  if (--it->second == 0) {
+    pending.erase(it);
+  }
+}
+
+}  // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 DetailedReorderer::DetailedReorderer(Architecture* arch, Network* network)
@@ -116,63 +140,201 @@ void DetailedReorderer::run(DetailedMgr* mgrPtr,
 ///////////////////////////////////////////////////////////////////////////////
 void DetailedReorderer::reorder()
 {
-  traversal_ = 0;
-  edgeMask_.resize(network_->getNumEdges());
-  std::ranges::fill(edgeMask_, traversal_);
+  if (mgrPtr_->getNumThreads() > 1) {
+    reorderInParallel(mgrPtr_->getNumThreads());
+    return;
+  }
 
   // Loop over each segment; find single height cells and reorder.
+  std::vector<Window> windows;
   for (int s = 0; s < mgrPtr_->getNumSegments(); s++) {
     DetailedSeg* segPtr = mgrPtr_->getSegment(s);
-    const int segId = segPtr->getSegId();
-    const int rowId = segPtr->getRowId();
+    mgrPtr_->sortCellsInSeg(segPtr->getSegId());
 
-    const std::vector<Node*>& nodes = mgrPtr_->getCellsInSeg(segId);
-    if (nodes.size() < 2) {
+    windows.clear();
+    collectWindows(segPtr, windows);
+    for (const Window& window : windows) {
+      reorder(window);
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void DetailedReorderer::reorderInParallel(const int numThreads)
+{
+  // Windows are processed in rounds.  Each segment's windows still slide
+  // left to right, and a window only runs once no earlier segment has cells
+  // left to reorder on a net its cost looks at, nor in its row.  Windows
+  // that share neither can be reordered in either order with the same
+  // result, so the rounds reproduce the serial sweep over the segments and
+  // the result does not depend on the number of threads.  The windows of a
+  // round share no net and no row, so they never touch the same pixels, nor
+  // read the position of a cell another window moves.
+  const int numSegs = mgrPtr_->getNumSegments();
+  std::vector<std::vector<Window>> segWindows(numSegs);
+  std::vector<PendingSegs> netPending(network_->getNumEdges());
+  std::vector<PendingSegs> rowPending(arch_->getNumRows());
+  for (int s = 0; s < numSegs; s++) {
+    DetailedSeg* segPtr = mgrPtr_->getSegment(s);
+    mgrPtr_->sortCellsInSeg(segPtr->getSegId());
+    collectWindows(segPtr, segWindows[s]);
+    if (segWindows[s].empty()) {
       continue;
     }
-    mgrPtr_->sortCellsInSeg(segId);
+    addPending(rowPending[segPtr->getRowId()], s);
+    // Windows have the same size, so they start and end in order.
+    int registered = -1;
+    for (const Window& window : segWindows[s]) {
+      const int istrt = std::max(window.istrt, registered + 1);
+      updatePending(window.seg, istrt, window.istop, s, netPending, true);
+      registered = window.istop;
+    }
+  }
 
-    int j = 0;
-    const int n = (int) nodes.size();
-    while (j < n) {
-      while (j < n && arch_->isMultiHeightCell(nodes[j])) {
-        ++j;
+  std::vector<size_t> next(numSegs, 0);
+  std::vector<int> batch;
+  std::vector<const Edge*> edges;
+  utl::ThreadPool pool(numThreads);
+  while (true) {
+    batch.clear();
+    for (int s = 0; s < numSegs; s++) {
+      if (next[s] == segWindows[s].size()) {
+        continue;
       }
-      const int jstrt = j;
-      while (j < n && arch_->isSingleHeightCell(nodes[j])) {
-        ++j;
+      const Window& window = segWindows[s][next[s]];
+      if (rowPending[window.seg->getRowId()].front().first != s) {
+        continue;
       }
-      const int jstop = j - 1;
-
-      // Single height cells in [jstrt,jstop].
-      for (int i = jstrt; i + windowSize_ <= jstop; ++i) {
-        int istrt = i;
-        const int istop = std::min(jstop, istrt + windowSize_ - 1);
-        if (istop == jstop) {
-          istrt = std::max(jstrt, istop - windowSize_ + 1);
-        }
+      edges.clear();
+      collectEdges(mgrPtr_->getCellsInSeg(window.seg->getSegId()),
+                   window.istrt,
+                   window.istop,
+                   edges);
+      const bool ready = std::ranges::all_of(edges, [&](const Edge* edi) {
+        return netPending[edi->getId()].front().first == s;
+      });
+      if (ready) {
+        batch.push_back(s);
+      }
+    }
+    if (batch.empty()) {
+      break;
+    }
+    pool.parallelFor(
+        batch, [&](const int s) { reorder(segWindows[s][next[s]]); });
+
+    // Cells left of the next window of their segment are final.
+    for (int s : batch) {
+      const Window& window = segWindows[s][next[s]];
+      ++next[s];
+      int istop = window.istop;
+      if (next[s] < segWindows[s].size()) {
+        istop = std::min(istop, segWindows[s][next[s]].istrt - 1);
+      } else {
+        removePending(rowPending[window.seg->getRowId()], s);
+      }
+      updatePending(window.seg, window.istrt, istop, s, netPending, false);
+    }
+  }
+}
 
-        const Node* nextPtr = (istop != n - 1) ? nodes[istop + 1] : nullptr;
-        DbuX rightLimit{segPtr->getMaxX()};
-        if (nextPtr != nullptr) {
-          int leftPadding, rightPadding;
-          arch_->getCellPadding(nextPtr, leftPadding, rightPadding);
-          rightLimit = std::min((nextPtr->getLeft() - leftPadding), rightLimit);
-        }
-        const Node* prevPtr = (istrt != 0) ? nodes[istrt - 1] : nullptr;
-        DbuX leftLimit{segPtr->getMinX()};
-        if (prevPtr != nullptr) {
-          int leftPadding, rightPadding;
-          arch_->getCellPadding(prevPtr, leftPadding, rightPadding);
-          leftLimit = std::max(prevPtr->getRight() + rightPadding, leftLimit);
-        }
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void DetailedReorderer::updatePending(DetailedSeg* segPtr,
+                                      const int istrt,
+                                      const int istop,
+                                      const int seg,
+                                      std::vector<PendingSegs>& netPending,
+                                      const bool add) const
+{
+  // Adds (or removes) the cells [istrt,istop] of the segment to the
+  // pending count of segment seg on each net that counts towards the cost.
+  const std::vector<Node*>& nodes = mgrPtr_->getCellsInSeg(segPtr->getSegId());
+  std::vector<const Edge*> edges;
+  for (int i = istrt; i <= istop; i++) {
+    edges.clear();
+    collectEdges(nodes, i, i, edges);
+    for (const Edge* edi : edges) {
+      if (add) {
+        addPending(netPending[edi->getId()], seg);
+      } else {
+        removePending(netPending[edi->getId()], seg);
+      }
+    }
+  }
+}
 
-        reorder(nodes, istrt, istop, leftLimit, rightLimit, segId, rowId);
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void DetailedReorderer::collectWindows(DetailedSeg* segPtr,
+                                       std::vector<Window>& windows)
+{
+  // Windows slide over each run of single height cells; multi height
+  // cells are never moved, so the runs do not change while reordering.
+  const std::vector<Node*>& nodes = mgrPtr_->getCellsInSeg(segPtr->getSegId());
+  if (nodes.size() < 2) {
+    return;
+  }
+
+  int j = 0;
+  const int n = (int) nodes.size();
+  while (j < n) {
+    while (j < n && arch_->isMultiHeightCell(nodes[j])) {
+      ++j;
+    }
+    const int jstrt = j;
+    while (j < n && arch_->isSingleHeightCell(nodes[j])) {
+      ++j;
+    }
+    const int jstop = j - 1;
+
+    // Single height cells in [jstrt,jstop].
+    for (int i = jstrt; i + windowSize_ <= jstop; ++i) {
+      int istrt = i;
+      const int istop = std::min(jstop, istrt + windowSize_ - 1);
+      if (istop == jstop) {
+        istrt = std::max(jstrt, istop - windowSize_ + 1);
       }
+      windows.push_back({segPtr, istrt, istop});
     }
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void DetailedReorderer::reorder(const Window& window)
+{
+  DetailedSeg* segPtr = window.seg;
+  const std::vector<Node*>& nodes = mgrPtr_->getCellsInSeg(segPtr->getSegId());
+  const int n = (int) nodes.size();
+  const int istrt = window.istrt;
+  const int istop = window.istop;
+
+  const Node* nextPtr = (istop != n - 1) ? nodes[istop + 1] : nullptr;
+  DbuX rightLimit{segPtr->getMaxX()};
+  if (nextPtr != nullptr) {
+    int leftPadding, rightPadding;
+    arch_->getCellPadding(nextPtr, leftPadding, rightPadding);
+    rightLimit = std::min((nextPtr->getLeft() - leftPadding), rightLimit);
+  }
+  const Node* prevPtr = (istrt != 0) ? nodes[istrt - 1] : nullptr;
+  DbuX leftLimit{segPtr->getMinX()};
+  if (prevPtr != nullptr) {
+    int leftPadding, rightPadding;
+    arch_->getCellPadding(prevPtr, leftPadding, rightPadding);
+    leftLimit = std::max(prevPtr->getRight() + rightPadding, leftLimit);
+  }
+
+  reorder(nodes,
+          istrt,
+          istop,
+          leftLimit,
+          rightLimit,
+          segPtr->getSegId(),
+          segPtr->getRowId());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
@@ -247,7 +409,11 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
   // might be different.  So, just consider the first permutation
   // like all the others.
 
-  double bestCost = cost(nodes, jstrt, jstop);
+  // The nets of the window do not change between permutations.
+  std::vector<const Edge*> edges;
+  collectEdges(nodes, jstrt, jstop, edges);
+
+  double bestCost = cost(nodes, jstrt, jstop, edges);
   const double origCost = bestCost;
 
   std::vector<DbuX> bestPosn(size, DbuX{0});  // Current positions.
@@ -278,7 +444,7 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
       }
     }
     if (dispOkay) {
-      const double currCost = cost(nodes, jstrt, jstop);
+      const double currCost = cost(nodes, jstrt, jstop, edges);
       if (currCost < bestCost) {
         bestPosn = currPosn;
         bestCost = currCost;
@@ -342,7 +508,7 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
       // interval.  However, we might have shifted something.
       if (shifted) {
         // Recost.  The shifting might have changed the cost.
-        const double lastCost = cost(nodes, jstrt, jstop);
+        const double lastCost = cost(nodes, jstrt, jstop, edges);
         if (lastCost >= origCost) {
           failed = true;
         }
@@ -372,49 +538,57 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-double DetailedReorderer::cost(const std::vector<Node*>& nodes,
-                               const int istrt,
-                               const int istop)
+void DetailedReorderer::collectEdges(const std::vector<Node*>& nodes,
+                                     const int istrt,
+                                     const int istop,
+                                     std::vector<const Edge*>& edges) const
 {
-  // Compute hpwl for the specified sequence of cells.
-
-  ++traversal_;
-
-  double cost = 0.;
+  // Nets of the specified sequence of cells which count towards the cost.
   for (int i = istrt; i <= istop; i++) {
     const Node* ndi = nodes[i];
-    if (mgrPtr_->hasPlacementViolation(ndi)) {
-      return std::numeric_limits<double>::max();
-    }
-
     for (int pi = 0; pi < ndi->getNumPins(); pi++) {
-      const Pin* pini = ndi->getPins()[pi];
-
-      const Edge* edi = pini->getEdge();
-
+      const Edge* edi = ndi->getPins()[pi]->getEdge();
       const int npins = edi->getNumPins();
       if (npins <= 1 || npins >= skipNetsLargerThanThis_) {
         continue;
       }
-      if (edgeMask_[edi->getId()] == traversal_) {
-        continue;
-      }
-      edgeMask_[edi->getId()] = traversal_;
+      edges.push_back(edi);
+    }
+  }
+  std::ranges::sort(edges);
+  const auto [first, last] = std::ranges::unique(edges);
+  edges.erase(first, last);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+double DetailedReorderer::cost(const std::vector<Node*>& nodes,
+                               const int istrt,
+                               const int istop,
+                               const std::vector<const Edge*>& edges) const
+{
+  // Compute hpwl for the specified sequence of cells.
+  for (int i = istrt; i <= istop; i++) {
+    if (mgrPtr_->hasPlacementViolation(nodes[i])) {
+      return std::numeric_limits<double>::max();
+    }
+  }
 
-      DbuX xmin = std::numeric_limits<DbuX>::max();
-      DbuX xmax = std::numeric_limits<DbuX>::min();
-      for (int pj = 0; pj < edi->getNumPins(); pj++) {
-        const Pin* pinj = edi->getPins()[pj];
+  double cost = 0.;
+  for (const Edge* edi : edges) {
+    DbuX xmin = std::numeric_limits<DbuX>::max();
+    DbuX xmax = std::numeric_limits<DbuX>::min();
+    for (int pj = 0; pj < edi->getNumPins(); pj++) {
+      const Pin* pinj = edi->getPins()[pj];
 
-        const Node* ndj = pinj->getNode();
+      const Node* ndj = pinj->getNode();
 
-        const DbuX x = ndj->getCenterX() + pinj->getOffsetX();
+      const DbuX x = ndj->getCenterX() + pinj->getOffsetX();
 
-        xmin = std::min(xmin, x);
-        xmax = std::max(xmax, x);
-      }
-      cost += (xmax - xmin).v;
+      xmin = std::min(xmin, x);
+      xmax = std::max(xmax, x);
     }
+    cost += (xmax - xmin).v;
   }
   return cost;
 }
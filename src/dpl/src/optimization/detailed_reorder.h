@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "dpl/Opendp.h"
@@ -12,6 +13,8 @@ namespace dpl {
 class Node;
 class Architecture;
 class DetailedMgr;
+class DetailedSeg;
+class Edge;
 class Network;
 class DetailedReorderer
 {
@@ -21,8 +24,29 @@ class DetailedReorderer
   void run(DetailedMgr* mgrPtr, const std::string& command);
   void run(DetailedMgr* mgrPtr, const std::vector<std::string>& args);
 
+  // Segments, in order, that still have cells to reorder on a net or in a
+  // row, with the number of such cells (a row counts each segment once).
+  using PendingSegs = std::vector<std::pair<int, int>>;
+
  private:
+  // Consecutive single height cells [istrt,istop] of a segment.
+  struct Window
+  {
+    DetailedSeg* seg;
+    int istrt;
+    int istop;
+  };
+
   void reorder();
+  void reorderInParallel(int numThreads);
+  void collectWindows(DetailedSeg* segPtr, std::vector<Window>& windows);
+  void updatePending(DetailedSeg* segPtr,
+                     int istrt,
+                     int istop,
+                     int seg,
+                     std::vector<PendingSegs>& netPending,
+                     bool add) const;
+  void reorder(const Window& window);
   void reorder(const std::vector<Node*>& nodes,
                int jstrt,
                int jstop,
@@ -30,7 +54,14 @@ class DetailedReorderer
                DbuX rightLimit,
                int segId,
                int rowId);
-  double cost(const std::vector<Node*>& nodes, int istrt, int istop);
+  void collectEdges(const std::vector<Node*>& nodes,
+                    int istrt,
+                    int istop,
+                    std::vector<const Edge*>& edges) const;
+  double cost(const std::vector<Node*>& nodes,
+              int istrt,
+              int istop,
+              const std::vector<const Edge*>& edges) const;
 
   // Standard stuff.
   Architecture* arch_;
@@ -41,8 +72,6 @@ class DetailedReorderer
 
   // Other.
   int skipNetsLargerThanThis_ = 100;
-  std::vector<int> edgeMask_;
-  int traversal_ = 0;
   int windowSize_ = 3;
 };
 
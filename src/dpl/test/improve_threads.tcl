@@ -0,0 +1,36 @@
+# improve_placement gives the same placement with 1 and 4 threads.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def aes-opt.def
+
+proc inst_locations { block } {
+  set locations [dict create]
+  foreach inst [$block getInsts] {
+    dict set locations [$inst getName] [$inst getLocation]
+  }
+  return $locations
+}
+
+proc restore_locations { block locations } {
+  foreach inst [$block getInsts] {
+    $inst setLocation {*}[dict get $locations [$inst getName]]
+  }
+}
+
+set block [ord::get_db_block]
+set initial [inst_locations $block]
+
+set results {}
+foreach threads {1 4} {
+  restore_locations $block $initial
+  set_thread_count $threads
+  improve_placement
+  check_placement
+  lappend results [inst_locations $block]
+}
+
+if { [lindex $results 0] != [lindex $results 1] } {
+  error "improve_placement differs between 1 and 4 threads"
+}
+
+puts pass
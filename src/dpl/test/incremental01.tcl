@@ -0,0 +1,99 @@
+# detailed_placement -incremental after ECO edits (moved, resized, created
+# and destroyed instances) legalizes the edited cells and keeps the rest.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def gcd_replace.def
+
+proc inst_locations { block } {
+  set locations [dict create]
+  foreach inst [$block getInsts] {
+    dict set locations [$inst getName] [$inst getLocation]
+  }
+  return $locations
+}
+
+# Counts the instances outside `edited` that are not where they were.
+proc count_moved { block before edited } {
+  set moved 0
+  foreach inst [$block getInsts] {
+    set name [$inst getName]
+    if { [lsearch -exact $edited $name] != -1 } {
+      continue
+    }
+    if { ![dict exists $before $name] } {
+      continue
+    }
+    if { [dict get $before $name] != [$inst getLocation] } {
+      incr moved
+    }
+  }
+  return $moved
+}
+
+proc eco_edits { block prefix } {
+  set db [ord::get_db]
+  set insts [$block getInsts]
+  set edited {}
+
+  # Move two cells on top of two others.
+  foreach i {10 20} {
+    set inst [lindex $insts $i]
+    set target [lindex $insts [expr { $i + 100 }]]
+    $inst setLocation {*}[$target getLocation]
+    lappend edited [$inst getName]
+  }
+
+  # Upsize an inverter in place.
+  foreach inst [lrange $insts 0 299] {
+    if { [[$inst getMaster] getName] == "INV_X1" } {
+      $inst swapMaster [$db findMaster INV_X4]
+      lappend edited [$inst getName]
+      break
+    }
+  }
+
+  # Insert a buffer overlapping an existing cell, driving a new net.
+  set buffer [odb::dbInst_create $block [$db findMaster BUF_X4] ${prefix}_buf]
+  $buffer setLocation {*}[[lindex $insts 200] getLocation]
+  $buffer setPlacementStatus PLACED
+  set net [odb::dbNet_create $block ${prefix}_net]
+  [$buffer findITerm Z] connect $net
+  foreach iterm [[lindex $insts 210] getITerms] {
+    if { [$iterm isInputSignal] } {
+      $iterm disconnect
+      $iterm connect $net
+      break
+    }
+  }
+  lappend edited [$buffer getName]
+
+  # Remove a cell.
+  odb::dbInst_destroy [lindex $insts 300]
+  return $edited
+}
+
+set block [ord::get_db_block]
+foreach legalizer {negotiation diamond} {
+  set flags {}
+  if { $legalizer == "diamond" } {
+    set flags -use_diamond_legalizer
+  }
+  detailed_placement {*}$flags
+  set before [inst_locations $block]
+  set edited [lsort -unique [eco_edits $block $legalizer]]
+  tee -variable log "detailed_placement -incremental $flags"
+  set expected "Legalizing [llength $edited] edited and 1 removed instances"
+  if { [string first "DPL-1105" $log] == -1
+       || [string first $expected $log] == -1 } {
+    error "$legalizer: the edits were not legalized incrementally"
+  }
+  set moved [count_moved $block $before $edited]
+  puts "$legalizer: [llength $edited] edited, $moved other instances moved"
+  if { $moved > [llength $edited] } {
+    error "$legalizer: incremental placement moved $moved unedited instances"
+  }
+  # check_placement reimports the db, so it also checks the kept grid.
+  check_placement
+}
+
+puts pass
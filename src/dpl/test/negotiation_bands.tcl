@@ -0,0 +1,38 @@
+# The negotiation legalizer's row-band sweep (forced on a design below the
+# default active cell threshold) is legal and independent of the thread count.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def aes_cipher_top_replace.def
+
+proc inst_locations { block } {
+  set locations [dict create]
+  foreach inst [$block getInsts] {
+    dict set locations [$inst getName] [$inst getLocation]
+  }
+  return $locations
+}
+
+proc restore_locations { block locations } {
+  foreach inst [$block getInsts] {
+    $inst setLocation {*}[dict get $locations [$inst getName]]
+  }
+}
+
+set block [ord::get_db_block]
+set initial [inst_locations $block]
+dpl::set_negotiation_min_band_cells_cmd 1
+
+set results {}
+foreach threads {2 4} {
+  restore_locations $block $initial
+  set_thread_count $threads
+  detailed_placement
+  check_placement
+  lappend results [inst_locations $block]
+}
+
+if { [lindex $results 0] != [lindex $results 1] } {
+  error "band sweep placement differs between 2 and 4 threads"
+}
+
+puts pass
@@ -1494,7 +1494,7 @@ void FlexDR::optimizationFlow(const SearchRepairArgs& args,
         const std::string batch_name = std::string("DR:batch<")
                                        + std::to_string(workersInBatch.size())
                                        + ">";
-        ProfileTask profile(batch_name.c_str());
+        ProfileTask profile(batch_name);
         if (dist_on_) {
           processWorkersBatchDistributed(workersInBatch, version, iter_prog);
         } else {
@@ -1522,7 +1522,7 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
       && getDesign()->getTopBlock()->getMarkers().empty()) {
     return;
   }
-  ProfileTask profile(fmt::format("DR:searchRepair{}", iter_).c_str());
+  ProfileTask profile(fmt::format("DR:searchRepair{}", iter_));
 
   if (dist_on_) {
     if ((iter_ % 10 == 0 && iter_ != 60) || iter_ == 3 || iter_ == 15) {
@@ -7,20 +7,23 @@
 #include <ittnotify.h>
 #endif
 
+#include <string>
+
+#include "utl/Trace.h"
+
 namespace drt {
 
 #ifdef HAS_VTUNE
 // This class make a VTune task in its scope (RAII).  This is useful
 // in VTune to see where the runtime is going with more domain specific
-// display.
+// display.  The task is also recorded as a utl trace span.
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) : done_(false)
+  ProfileTask(const char* name) : trace_(name), done_(false) { begin(name); }
+  ProfileTask(const std::string& name) : trace_(name), done_(false)
   {
-    domain_ = __itt_domain_create("TritonRoute");
-    name_ = __itt_string_handle_create(name);
-    __itt_task_begin(domain_, __itt_null, __itt_null, name_);
+    begin(name.c_str());
   }
 
   ~ProfileTask()
@@ -36,9 +39,18 @@ class ProfileTask
   {
     done_ = true;
     __itt_task_end(domain_);
+    trace_.end();
   }
 
  private:
+  void begin(const char* name)
+  {
+    domain_ = __itt_domain_create("TritonRoute");
+    name_ = __itt_string_handle_create(name);
+    __itt_task_begin(domain_, __itt_null, __itt_null, name_);
+  }
+
+  utl::TraceScope trace_;
   __itt_domain* domain_;
   __itt_string_handle* name_;
   bool done_;
@@ -46,12 +58,16 @@ class ProfileTask
 
 #else
 
-// No-op version
+// Without VTune a task is only recorded as a utl trace span.
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) {}
-  void done() {}
+  ProfileTask(const char* name) : trace_(name) {}
+  ProfileTask(const std::string& name) : trace_(name) {}
+  void done() { trace_.end(); }
+
+ private:
+  utl::TraceScope trace_;
 };
 #endif
 
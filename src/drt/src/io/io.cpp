@@ -48,7 +48,9 @@
 #include "odb/dbTypes.h"
 #include "odb/dbWireCodec.h"
 #include "odb/geom.h"
+#include "omp.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 using odb::dbTechLayerType;
 
@@ -126,6 +128,14 @@ frInst* io::Parser::setInst(odb::dbInst* db_inst)
   if (existing_inst != nullptr) {
     return existing_inst;
   }
+  std::unique_ptr<frInst> inst = buildInst(db_inst);
+  frInst* raw_inst = inst.get();
+  getBlock()->addInst(std::move(inst));
+  return raw_inst;
+}
+
+std::unique_ptr<frInst> io::Parser::buildInst(odb::dbInst* db_inst) const
+{
   frMaster* master
       = getDesign()->name2master_.at(db_inst->getMaster()->getName());
   auto inst = std::make_unique<frInst>(db_inst->getName(), master, db_inst);
@@ -149,24 +159,42 @@ frInst* io::Parser::setInst(odb::dbInst* db_inst)
         = std::make_unique<frInstBlockage>(inst.get(), blk.get());
     inst->addInstBlockage(std::move(instBlk));
   }
-  frInst* raw_inst = inst.get();
-  getBlock()->addInst(std::move(inst));
-  return raw_inst;
+  return inst;
 }
 
 void io::Parser::setInsts(odb::dbBlock* block)
 {
+  std::vector<odb::dbInst*> db_insts;
   for (auto inst : block->getInsts()) {
     if (getDesign()->name2master_.find(inst->getMaster()->getName())
         == getDesign()->name2master_.end()) {
       logger_->error(
           DRT, 95, "Library cell {} not found.", inst->getMaster()->getName());
     }
+    db_insts.push_back(inst);
+  }
+
+  // Instances are built concurrently and added in block order, which
+  // assigns the same ids as building them one by one.
+  std::vector<std::unique_ptr<frInst>> insts(db_insts.size());
+  omp_set_num_threads(router_cfg_->MAX_THREADS);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic, 256)
+  for (int i = 0; i < db_insts.size(); i++) {
+    try {
+      insts[i] = buildInst(db_insts[i]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  for (auto& inst : insts) {
     if (getBlock()->name2inst_.find(inst->getName())
         != getBlock()->name2inst_.end()) {
       logger_->error(DRT, 96, "Same cell name: {}.", inst->getName());
     }
-    setInst(inst);
+    getBlock()->addInst(std::move(inst));
   }
 }
 
@@ -613,11 +641,11 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
                      term->getName(),
                      term->getSigType().getString());
     }
-    if (getBlock()->name2term_.find(term->getName())
-        == getBlock()->name2term_.end()) {
+    auto term_it = getBlock()->name2term_.find(term->getName());
+    if (term_it == getBlock()->name2term_.end()) {
       logger_->error(DRT, 104, "Terminal {} not found.", term->getName());
     }
-    auto frbterm = getBlock()->name2term_[term->getName()];  // frBTerm*
+    auto frbterm = term_it->second;  // frBTerm*
     frbterm->addToNet(netIn);
     netIn->addBTerm(frbterm);
   }
@@ -632,12 +660,12 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
                      term->getName(),
                      term->getSigType().getString());
     }
-    if (getBlock()->name2inst_.find(term->getInst()->getName())
-        == getBlock()->name2inst_.end()) {
+    auto inst_it = getBlock()->name2inst_.find(term->getInst()->getName());
+    if (inst_it == getBlock()->name2inst_.end()) {
       logger_->error(
           DRT, 105, "Component {} not found.", term->getInst()->getName());
     }
-    auto inst = getBlock()->name2inst_[term->getInst()->getName()];
+    auto inst = inst_it->second;
     // gettin inst term
     auto frterm = inst->getMaster()->getTerm(term->getMTerm()->getName());
     if (frterm == nullptr) {
@@ -651,15 +679,6 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
     instTerm->addToNet(netIn);
     netIn->addInstTerm(instTerm);
   }
-  if (!net->isSpecial() && net->getTermCount() > LARGE_NET_FANOUT_THRESHOLD) {
-    logger_->warn(
-        DRT,
-        120,
-        "Large net {} has {} pins which may impact routing performance. "
-        "Consider optimization.",
-        net->getName(),
-        net->getTermCount());
-  }
   if (net->getWire()
       && (net->getWireType() == odb::dbWireType::SHIELD
           || net->getWireType() == odb::dbWireType::COVER)) {
@@ -872,7 +891,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
         }
         tmpP->addToNet(netIn);
         tmpP->setLayerNum(layerNum);
-        auto layer = getTech()->name2layer_[layerName];
+        auto layer = layer_it->second;
         auto styleWidth = width;
         if (!(styleWidth)) {
           if ((layer->isHorizontal() && beginY != endY)
@@ -882,7 +901,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
             styleWidth = layer->getWidth();
           }
         }
-        width = getTech()->name2layer_[layerName]->getWidth();
+        width = layer->getWidth();
         auto defaultBeginExt = width / 2;
         auto defaultEndExt = width / 2;
 
@@ -918,7 +937,8 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
         netIn->addShape(std::move(tmpP));
       }
       if (!viaName.empty()) {
-        if (getTech()->name2via_.find(viaName) == getTech()->name2via_.end()) {
+        auto via_it = getTech()->name2via_.find(viaName);
+        if (via_it == getTech()->name2via_.end()) {
           logger_->error(DRT, 108, "Unsupported via in db.");
         } else {
           odb::Point p;
@@ -927,7 +947,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
           } else {
             p = {beginX, beginY};
           }
-          auto viaDef = getTech()->name2via_[viaName];
+          auto viaDef = via_it->second;
           auto tmpP = std::make_unique<frVia>(viaDef, p);
           tmpP->addToNet(netIn);
           netIn->addVia(std::move(tmpP));
@@ -947,14 +967,14 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
           }
           getSBoxCoords(box, beginX, beginY, endX, endY, width);
           auto layerNum = getTech()
-                              ->name2layer_[box->getTechLayer()->getName()]
+                              ->name2layer_.at(box->getTechLayer()->getName())
                               ->getLayerNum();
           auto tmpP = std::make_unique<frPathSeg>();
           tmpP->setPoints(odb::Point(beginX, beginY), odb::Point(endX, endY));
           tmpP->addToNet(netIn);
           tmpP->setLayerNum(layerNum);
-          width
-              = (width) ? width : getTech()->name2layer_[layerName]->getWidth();
+          width = (width) ? width
+                          : getTech()->name2layer_.at(layerName)->getWidth();
           auto defaultExt = width / 2;
 
           frEndStyleEnum tmpBeginEnum;
@@ -999,12 +1019,12 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
             }
           }
 
-          if (getTech()->name2via_.find(viaName)
-              == getTech()->name2via_.end()) {
+          auto via_it = getTech()->name2via_.find(viaName);
+          if (via_it == getTech()->name2via_.end()) {
             logger_->error(DRT, 109, "Unsupported via in db.");
           } else {
             const odb::Point p = box->getViaXY();
-            auto viaDef = getTech()->name2via_[viaName];
+            auto viaDef = via_it->second;
             auto tmpP = std::make_unique<frVia>(viaDef);
             tmpP->setOrigin(p);
             tmpP->addToNet(netIn);
@@ -1017,9 +1037,26 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
 }
 void io::Parser::setNets(odb::dbBlock* block)
 {
+  std::vector<std::pair<frNet*, odb::dbNet*>> nets;
   for (auto db_net : block->getNets()) {
-    addNet(db_net);
+    if (getBlock()->findNet(db_net->getName()) == nullptr) {
+      nets.emplace_back(createNet(db_net), db_net);
+    }
+  }
+
+  // Connectivity and routing only touch the net itself and its own terms,
+  // so nets are filled in concurrently once they all exist.
+  omp_set_num_threads(router_cfg_->MAX_THREADS);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int i = 0; i < nets.size(); i++) {
+    try {
+      updateNetRouting(nets[i].first, nets[i].second);
+    } catch (...) {
+      exception.capture();
+    }
   }
+  exception.rethrow();
 }
 
 frNet* io::Parser::addNet(odb::dbNet* db_net)
@@ -1028,6 +1065,13 @@ frNet* io::Parser::addNet(odb::dbNet* db_net)
   if (existing_net != nullptr) {
     return existing_net;
   }
+  frNet* net = createNet(db_net);
+  updateNetRouting(net, db_net);
+  return net;
+}
+
+frNet* io::Parser::createNet(odb::dbNet* db_net)
+{
   bool is_special = db_net->isSpecial();
   bool has_jumpers = db_net->hasJumpers();
   bool is_abuted = db_net->isConnectedByAbutment();
@@ -1054,8 +1098,16 @@ frNet* io::Parser::addNet(odb::dbNet* db_net)
   net_in->setHasJumpers(has_jumpers);
   net_in->setIsConnectedByAbutment(is_abuted);
   net_in->setAutoTaperEnabled(db_net->isAutoTaperEnabled());
-  updateNetRouting(net_in.get(), db_net);
   net_in->setType(db_net->getSigType());
+  if (!is_special && db_net->getTermCount() > LARGE_NET_FANOUT_THRESHOLD) {
+    logger_->warn(
+        DRT,
+        120,
+        "Large net {} has {} pins which may impact routing performance. "
+        "Consider optimization.",
+        db_net->getName(),
+        db_net->getTermCount());
+  }
   frNet* raw_net_in = net_in.get();
   if (is_special) {
     getBlock()->addSNet(std::move(net_in));
@@ -3789,128 +3841,160 @@ void io::Writer::writeViaDefToODB(odb::dbBlock* block,
   }
 }
 
-void io::Writer::updateDbConn(odb::dbBlock* block,
-                              odb::dbTech* db_tech,
-                              bool snapshot)
+void io::Writer::encodeNetConn(
+    odb::dbBlock* block,
+    odb::dbTech* db_tech,
+    odb::dbNet* net,
+    const std::list<std::shared_ptr<frConnFig>>& conn_figs,
+    odb::dbWireEncoder& wire_encoder)
 {
-  odb::dbWireEncoder _wire_encoder;
-  for (auto net : block->getNets()) {
-    if (connFigs_.find(net->getName()) != connFigs_.end()) {
-      if (getDesign()->getTopBlock()->findNet(net->getName())->isFixed()) {
-        continue;
+  wire_encoder.begin(block);
+  for (auto& connFig : conn_figs) {
+    switch (connFig->typeId()) {
+      case frcPathSeg: {
+        auto pathSeg = std::dynamic_pointer_cast<frPathSeg>(connFig);
+        auto layerName = getTech()->getLayer(pathSeg->getLayerNum())->getName();
+        auto layer = db_tech->findLayer(layerName.c_str());
+        if (pathSeg->isTapered() || !net->getNonDefaultRule()) {
+          wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
+        } else {
+          wire_encoder.newPath(
+              layer,
+              odb::dbWireType("ROUTED"),
+              net->getNonDefaultRule()->getLayerRule(layer));
+        }
+        auto [begin, end] = pathSeg->getPoints();
+        frSegStyle segStyle = pathSeg->getStyle();
+        if (segStyle.getBeginStyle() == frEndStyle(frcExtendEndStyle)) {
+          if (segStyle.getBeginExt() != layer->getWidth() / 2) {
+            wire_encoder.addPoint(
+                begin.x(), begin.y(), segStyle.getBeginExt(), 0);
+          } else {
+            wire_encoder.addPoint(begin.x(), begin.y());
+          }
+        } else if (segStyle.getBeginStyle()
+                   == frEndStyle(frcTruncateEndStyle)) {
+          wire_encoder.addPoint(begin.x(), begin.y(), 0, 0);
+        } else if (segStyle.getBeginStyle()
+                   == frEndStyle(frcVariableEndStyle)) {
+          wire_encoder.addPoint(
+              begin.x(), begin.y(), segStyle.getBeginExt(), 0);
+        }
+        if (segStyle.getEndStyle() == frEndStyle(frcExtendEndStyle)) {
+          if (segStyle.getEndExt() != layer->getWidth() / 2) {
+            wire_encoder.addPoint(end.x(), end.y(), segStyle.getEndExt(), 0);
+          } else {
+            wire_encoder.addPoint(end.x(), end.y());
+          }
+        } else if (segStyle.getEndStyle()
+                   == frEndStyle(frcTruncateEndStyle)) {
+          wire_encoder.addPoint(end.x(), end.y(), 0, 0);
+        } else if (segStyle.getBeginStyle()
+                   == frEndStyle(frcVariableEndStyle)) {
+          wire_encoder.addPoint(end.x(), end.y(), segStyle.getEndExt(), 0);
+        }
+        break;
       }
-      odb::dbWire* wire = net->getWire();
-      if (wire == nullptr) {
-        wire = odb::dbWire::create(net);
-        _wire_encoder.begin(wire);
-      } else {
-        odb::dbWire::destroy(wire);
-        wire = odb::dbWire::create(net);
-        _wire_encoder.begin(wire);
+      case frcVia: {
+        auto via = std::dynamic_pointer_cast<frVia>(connFig);
+        auto layerName
+            = getTech()->getLayer(via->getViaDef()->getLayer1Num())->getName();
+        auto viaName = via->getViaDef()->getName();
+        auto layer = db_tech->findLayer(layerName.c_str());
+        if (!net->getNonDefaultRule() || via->isTapered()) {
+          wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
+        } else {
+          wire_encoder.newPath(
+              layer,
+              odb::dbWireType("ROUTED"),
+              net->getNonDefaultRule()->getLayerRule(layer));
+        }
+        odb::Point origin = via->getOrigin();
+        wire_encoder.addPoint(origin.x(), origin.y());
+        odb::dbTechVia* tech_via = db_tech->findVia(viaName.c_str());
+        if (tech_via != nullptr) {
+          wire_encoder.addTechVia(tech_via);
+        } else {
+          odb::dbVia* db_via = block->findVia(viaName.c_str());
+          wire_encoder.addVia(db_via);
+        }
+        break;
       }
+      case frcPatchWire: {
+        auto pwire = std::dynamic_pointer_cast<frPatchWire>(connFig);
+        auto layerName = getTech()->getLayer(pwire->getLayerNum())->getName();
+        auto layer = db_tech->findLayer(layerName.c_str());
+        wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
+        odb::Point origin = pwire->getOrigin();
+        odb::Rect offsetBox = pwire->getOffsetBox();
+        wire_encoder.addPoint(origin.x(), origin.y());
+        wire_encoder.addRect(offsetBox.xMin(),
+                             offsetBox.yMin(),
+                             offsetBox.xMax(),
+                             offsetBox.yMax());
+        break;
+      }
+      default: {
+        wire_encoder.clear();
+        logger_->error(DRT,
+                       114,
+                       "Unknown connFig type while writing net {}.",
+                       net->getName());
+      }
+    }
+  }
+}
 
-      for (auto& connFig : connFigs_.at(net->getName())) {
-        switch (connFig->typeId()) {
-          case frcPathSeg: {
-            auto pathSeg = std::dynamic_pointer_cast<frPathSeg>(connFig);
-            auto layerName
-                = getTech()->getLayer(pathSeg->getLayerNum())->getName();
-            auto layer = db_tech->findLayer(layerName.c_str());
-            if (pathSeg->isTapered() || !net->getNonDefaultRule()) {
-              _wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
-            } else {
-              _wire_encoder.newPath(
-                  layer,
-                  odb::dbWireType("ROUTED"),
-                  net->getNonDefaultRule()->getLayerRule(layer));
-            }
-            auto [begin, end] = pathSeg->getPoints();
-            frSegStyle segStyle = pathSeg->getStyle();
-            if (segStyle.getBeginStyle() == frEndStyle(frcExtendEndStyle)) {
-              if (segStyle.getBeginExt() != layer->getWidth() / 2) {
-                _wire_encoder.addPoint(
-                    begin.x(), begin.y(), segStyle.getBeginExt(), 0);
-              } else {
-                _wire_encoder.addPoint(begin.x(), begin.y());
-              }
-            } else if (segStyle.getBeginStyle()
-                       == frEndStyle(frcTruncateEndStyle)) {
-              _wire_encoder.addPoint(begin.x(), begin.y(), 0, 0);
-            } else if (segStyle.getBeginStyle()
-                       == frEndStyle(frcVariableEndStyle)) {
-              _wire_encoder.addPoint(
-                  begin.x(), begin.y(), segStyle.getBeginExt(), 0);
-            }
-            if (segStyle.getEndStyle() == frEndStyle(frcExtendEndStyle)) {
-              if (segStyle.getEndExt() != layer->getWidth() / 2) {
-                _wire_encoder.addPoint(
-                    end.x(), end.y(), segStyle.getEndExt(), 0);
-              } else {
-                _wire_encoder.addPoint(end.x(), end.y());
-              }
-            } else if (segStyle.getEndStyle()
-                       == frEndStyle(frcTruncateEndStyle)) {
-              _wire_encoder.addPoint(end.x(), end.y(), 0, 0);
-            } else if (segStyle.getBeginStyle()
-                       == frEndStyle(frcVariableEndStyle)) {
-              _wire_encoder.addPoint(end.x(), end.y(), segStyle.getEndExt(), 0);
-            }
-            break;
-          }
-          case frcVia: {
-            auto via = std::dynamic_pointer_cast<frVia>(connFig);
-            auto layerName = getTech()
-                                 ->getLayer(via->getViaDef()->getLayer1Num())
-                                 ->getName();
-            auto viaName = via->getViaDef()->getName();
-            auto layer = db_tech->findLayer(layerName.c_str());
-            if (!net->getNonDefaultRule() || via->isTapered()) {
-              _wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
-            } else {
-              _wire_encoder.newPath(
-                  layer,
-                  odb::dbWireType("ROUTED"),
-                  net->getNonDefaultRule()->getLayerRule(layer));
-            }
-            odb::Point origin = via->getOrigin();
-            _wire_encoder.addPoint(origin.x(), origin.y());
-            odb::dbTechVia* tech_via = db_tech->findVia(viaName.c_str());
-            if (tech_via != nullptr) {
-              _wire_encoder.addTechVia(tech_via);
-            } else {
-              writeViaDefToODB(block, db_tech, via->getViaDef());
-              odb::dbVia* db_via = block->findVia(viaName.c_str());
-              _wire_encoder.addVia(db_via);
-            }
-            break;
-          }
-          case frcPatchWire: {
-            auto pwire = std::dynamic_pointer_cast<frPatchWire>(connFig);
-            auto layerName
-                = getTech()->getLayer(pwire->getLayerNum())->getName();
-            auto layer = db_tech->findLayer(layerName.c_str());
-            _wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
-            odb::Point origin = pwire->getOrigin();
-            odb::Rect offsetBox = pwire->getOffsetBox();
-            _wire_encoder.addPoint(origin.x(), origin.y());
-            _wire_encoder.addRect(offsetBox.xMin(),
-                                  offsetBox.yMin(),
-                                  offsetBox.xMax(),
-                                  offsetBox.yMax());
-            break;
-          }
-          default: {
-            _wire_encoder.clear();
-            logger_->error(DRT,
-                           114,
-                           "Unknown connFig type while writing net {}.",
-                           net->getName());
-          }
+void io::Writer::updateDbConn(odb::dbBlock* block,
+                              odb::dbTech* db_tech,
+                              bool snapshot,
+                              int num_threads)
+{
+  using ConnFigList = std::list<std::shared_ptr<frConnFig>>;
+  std::vector<std::pair<odb::dbNet*, const ConnFigList*>> nets;
+  for (auto net : block->getNets()) {
+    auto it = connFigs_.find(net->getName());
+    if (it == connFigs_.end()) {
+      continue;
+    }
+    if (getDesign()->getTopBlock()->findNet(net->getName())->isFixed()) {
+      continue;
+    }
+    // Create the vias added by the router up front so that the nets can be
+    // encoded concurrently without modifying the block.
+    for (auto& connFig : it->second) {
+      if (connFig->typeId() == frcVia) {
+        const frViaDef* via_def
+            = static_cast<frVia*>(connFig.get())->getViaDef();
+        if (db_tech->findVia(via_def->getName().c_str()) == nullptr) {
+          writeViaDefToODB(block, db_tech, via_def);
         }
       }
-      _wire_encoder.end();
-      net->setWireOrdered(false);
     }
+    nets.emplace_back(net, &it->second);
+  }
+
+  std::vector<odb::dbWireEncoder> encoders(nets.size());
+  omp_set_num_threads(num_threads);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < nets.size(); i++) {
+    try {
+      encodeNetConn(
+          block, db_tech, nets[i].first, *nets[i].second, encoders[i]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  for (int i = 0; i < nets.size(); i++) {
+    odb::dbNet* net = nets[i].first;
+    if (net->getWire() != nullptr) {
+      odb::dbWire::destroy(net->getWire());
+    }
+    encoders[i].end(odb::dbWire::create(net));
+    net->setWireOrdered(false);
   }
 }
 
@@ -4135,7 +4219,7 @@ void io::Writer::updateDb(odb::dbDatabase* db,
       }
     }
     fillConnFigs(false, router_cfg->VERBOSE);
-    updateDbConn(block, db_tech, snapshot);
+    updateDbConn(block, db_tech, snapshot, router_cfg->MAX_THREADS);
     TopLayerBTermHandler(getDesign(), db, logger_, router_cfg)
         .processBTermsAboveTopLayer(true);
   }
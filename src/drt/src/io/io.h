@@ -33,6 +33,7 @@ class dbBlock;
 class dbTech;
 class dbSBox;
 class dbTechLayer;
+class dbWireEncoder;
 }  // namespace odb
 namespace utl {
 class Logger;
@@ -92,6 +93,8 @@ class Parser
   void setDieArea(odb::dbBlock*);
   void setTracks(odb::dbBlock*);
   void setInsts(odb::dbBlock*);
+  // Builds the fr instance of db_inst without adding it to the block.
+  std::unique_ptr<frInst> buildInst(odb::dbInst* db_inst) const;
   void setObstructions(odb::dbBlock*);
   void setBTerms(odb::dbBlock*);
   odb::Rect getViaBoxForTermAboveMaxLayer(odb::dbBTerm* term,
@@ -102,6 +105,9 @@ class Parser
   void setVias(odb::dbBlock*);
   void updateNetRouting(frNet*, odb::dbNet*);
   void setNets(odb::dbBlock*);
+  // Creates the net of db_net and adds it to the block without its
+  // connectivity and routing, which updateNetRouting fills in.
+  frNet* createNet(odb::dbNet* db_net);
   void setAccessPoints(odb::dbDatabase*);
   void getSBoxCoords(odb::dbSBox*,
                      frCoord&,
@@ -187,7 +193,16 @@ class Writer
       std::vector<std::vector<
           std::map<frCoord, std::vector<std::shared_ptr<frPathSeg>>>>>&
           mergedPathSegs);
-  void updateDbConn(odb::dbBlock* block, odb::dbTech* db_tech, bool snapshot);
+  void updateDbConn(odb::dbBlock* block,
+                    odb::dbTech* db_tech,
+                    bool snapshot,
+                    int num_threads);
+  // Encodes the routing of one net without modifying the database.
+  void encodeNetConn(odb::dbBlock* block,
+                     odb::dbTech* db_tech,
+                     odb::dbNet* net,
+                     const std::list<std::shared_ptr<frConnFig>>& conn_figs,
+                     odb::dbWireEncoder& wire_encoder);
   void writeViaDefToODB(odb::dbBlock* block,
                         odb::dbTech* db_tech,
                         const frViaDef* via);
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "db/obj/frBTerm.h"
+#include "db/obj/frBlock.h"
+#include "db/obj/frInst.h"
+#include "db/obj/frInstTerm.h"
+#include "db/obj/frMTerm.h"
+#include "db/obj/frNet.h"
+#include "db/obj/frShape.h"
+#include "db/obj/frVia.h"
+#include "db/tech/frViaDef.h"
+#include "drt-global.h"
+#include "frDesign.h"
+#include "gtest/gtest.h"
+#include "io/io.h"
+#include "odb/db.h"
+#include "odb/dbTypes.h"
+#include "odb/dbWireCodec.h"
+#include "odb/defin.h"
+#include "odb/geom.h"
+#include "odb/lefin.h"
+#include "tst/db_fixture.h"
+
+namespace drt {
+
+class IoTest : public tst::DbFixture
+{
+ protected:
+  void SetUp() override
+  {
+    const std::string dir = "_main/src/drt/test/";
+    odb::lefin lef_reader(db_.get(), &logger_, false);
+    odb::dbTech* tech = lef_reader.createTech(
+        "ng45", getFilePath(dir + "Nangate45/Nangate45_tech.lef").c_str());
+    odb::dbLib* lib = lef_reader.createLib(
+        tech,
+        "ng45",
+        getFilePath(dir + "Nangate45/Nangate45_stdcell.lef").c_str());
+
+    odb::dbChip* chip = odb::dbChip::create(db_.get(), tech);
+    odb::defin def_reader(db_.get(), &logger_);
+    std::vector<odb::dbLib*> libs{lib};
+    def_reader.readChip(
+        libs,
+        getFilePath(dir + "gcd_nangate45_preroute.def").c_str(),
+        chip);
+    block_ = chip->getBlock();
+
+    // The DEF only has special wires; give some signal nets wires too.
+    addWires(tech);
+  }
+
+  void addWires(odb::dbTech* tech)
+  {
+    odb::dbTechLayer* metal2 = tech->findLayer("metal2");
+    odb::dbTechVia* via1 = tech->findVia("via1_4");
+    int wired = 0;
+    for (odb::dbNet* net : block_->getNets()) {
+      if (net->getSigType().isSupply() || net->getITermCount() < 2) {
+        continue;
+      }
+      auto iterms = net->getITerms();
+      const odb::Point from = (*iterms.begin())->getInst()->getLocation();
+      const odb::Point to = (*++iterms.begin())->getInst()->getLocation();
+      odb::dbWireEncoder encoder;
+      encoder.begin(odb::dbWire::create(net));
+      encoder.newPath(metal2, odb::dbWireType::ROUTED);
+      encoder.addPoint(from.x(), from.y());
+      encoder.addPoint(to.x(), from.y());
+      encoder.addTechVia(via1);
+      encoder.end();
+      if (++wired == 100) {
+        break;
+      }
+    }
+  }
+
+  // Parses the block with the given number of threads and flattens the
+  // instances and nets it built into one line per object.
+  std::vector<std::string> parse(const int threads)
+  {
+    RouterConfiguration router_cfg;
+    router_cfg.MAX_THREADS = threads;
+    router_cfg.VERBOSE = 0;
+    frDesign design(&logger_, &router_cfg);
+    io::Parser parser(db_.get(), &design, &logger_, &router_cfg);
+    parser.readTechAndLibs(db_.get());
+    parser.readDesign(db_.get());
+
+    std::vector<std::string> lines;
+    const frBlock* block = design.getTopBlock();
+    for (const auto& inst : block->getInsts()) {
+      std::ostringstream line;
+      line << "inst " << inst->getId() << " " << inst->getName() << " "
+           << inst->getMaster()->getName() << " " << inst->getOrigin() << " "
+           << inst->getOrient().getString() << " blockages "
+           << inst->getInstBlockages().size();
+      for (const auto& iterm : inst->getInstTerms()) {
+        line << " " << iterm->getTerm()->getName() << ":"
+             << (iterm->getNet() ? iterm->getNet()->getName() : "-");
+      }
+      lines.push_back(line.str());
+    }
+    for (const auto* nets : {&block->getNets(), &block->getSNets()}) {
+      for (const auto& net : *nets) {
+        std::ostringstream line;
+        line << "net " << net->getId() << " " << net->getName();
+        for (const frInstTerm* iterm : net->getInstTerms()) {
+          line << " " << iterm->getName();
+        }
+        for (const frBTerm* bterm : net->getBTerms()) {
+          line << " " << bterm->getName();
+        }
+        for (const auto& shape : net->getShapes()) {
+          line << " shape " << shape->getLayerNum() << " "
+               << shape->getBBox();
+        }
+        for (const auto& via : net->getVias()) {
+          line << " via " << via->getViaDef()->getName() << " "
+               << via->getOrigin();
+        }
+        for (const auto& pwire : net->getPatchWires()) {
+          line << " patch " << pwire->getLayerNum() << " "
+               << pwire->getBBox();
+        }
+        lines.push_back(line.str());
+      }
+    }
+    return lines;
+  }
+
+  odb::dbBlock* block_{nullptr};
+};
+
+TEST_F(IoTest, ParallelParseMatchesSerial)
+{
+  const std::vector<std::string> serial = parse(1);
+  const std::vector<std::string> parallel = parse(4);
+  ASSERT_EQ(serial.size(), parallel.size());
+  int routed_nets = 0;
+  for (size_t i = 0; i < serial.size(); i++) {
+    EXPECT_EQ(serial[i], parallel[i]);
+    if (serial[i].find(" via via1_4 ") != std::string::npos) {
+      ++routed_nets;
+    }
+  }
+  EXPECT_EQ(routed_nets, 100);
+}
+
+}  // namespace drt
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -37,6 +38,7 @@
 
 namespace utl {
 class ServiceRegistry;
+class ThreadPool;
 }  // namespace utl
 
 namespace est {
@@ -74,6 +76,23 @@ struct ParasiticsCapacitance
   double v_cap;
 };
 
+// Counters of the incremental parasitics updates made while
+// incremental parasitics are enabled.
+struct IncrementalParasiticsStats
+{
+  // updateParasitics calls; each one estimates the pending nets as a batch.
+  int64_t updates = 0;
+  // parasiticsInvalid calls on nets with estimated parasitics.
+  int64_t invalidations = 0;
+  // Invalidations of nets that were already pending an estimate.
+  int64_t repeated = 0;
+  // Nets actually re-estimated.
+  int64_t estimated = 0;
+  // Pending nets whose estimate was skipped because they do not affect
+  // timing.
+  int64_t skipped = 0;
+};
+
 class AbstractSteinerRenderer;
 class OdbCallBack;
 
@@ -184,6 +203,14 @@ class EstimateParasitics : public sta::dbStaState, public ParasiticsService
 
   bool hasParasiticsInvalid() const { return !parasitics_invalid_.empty(); }
 
+  const IncrementalParasiticsStats& incrementalStats() const
+  {
+    return incremental_stats_;
+  }
+  // Report the incremental counters accumulated since `begin` to the debug
+  // log and as est__incremental__* metrics.
+  void reportIncrementalStats(const IncrementalParasiticsStats& begin) const;
+
   // Functions to estimate RC from global routing results
   void estimateGlobalRouteRC(sta::SpefWriter* spef_writer = nullptr);
   void estimateGlobalRouteRC(odb::dbNet* db_net);
@@ -228,6 +255,45 @@ class EstimateParasitics : public sta::dbStaState, public ParasiticsService
     std::vector<ParasiticsCapacitance> clk_cap;     // Farads/meter
   };
 
+  // Pin or Steiner point of an estimated RC tree. Steiner and via nodes
+  // have no pin and are numbered by index.
+  struct RcNode
+  {
+    const sta::Pin* pin = nullptr;
+    int index = 0;
+  };
+
+  // Resistor between n1 and n2, or capacitor to ground on n1.
+  struct RcElement
+  {
+    static RcElement resistor(const RcNode& n1, const RcNode& n2, double res)
+    {
+      return {.n1 = n1, .n2 = n2, .value = res, .is_resistor = true};
+    }
+    static RcElement capacitor(const RcNode& n1, double cap)
+    {
+      return {.n1 = n1, .n2 = {}, .value = cap, .is_resistor = false};
+    }
+
+    RcNode n1;
+    RcNode n2;
+    double value;
+    bool is_resistor;
+  };
+
+  // Estimated wire RC of one net, built without touching sta::Parasitics
+  // so that several nets can be estimated concurrently and annotated later.
+  struct NetRcTree
+  {
+    const sta::Pin* drvr_pin = nullptr;
+    const sta::Net* net = nullptr;
+    bool is_pad = false;
+    bool is_clk = false;
+    std::vector<sta::Scene*> scenes;
+    // Indexed like scenes; empty if the net has no Steiner tree.
+    std::vector<std::vector<RcElement>> elements;
+  };
+
   odb::dbTech* currentTech() const;
   WireRC& wireRC(odb::dbTech* tech) { return wire_rc_[tech]; }
   // Resolve one WireRC category for the current technology; a category left
@@ -240,33 +306,39 @@ class EstimateParasitics : public sta::dbStaState, public ParasiticsService
   void estimateWireParasiticSteiner(const sta::Pin* drvr_pin,
                                     const sta::Net* net,
                                     sta::SpefWriter* spef_writer);
+  utl::ThreadPool* threadPool();
+  // Returns false if the net gets no wire parasitics.
+  bool initNetRcTree(const sta::Net* net, NetRcTree& rc_tree) const;
+  void initNetRcTree(const sta::Pin* drvr_pin,
+                     const sta::Net* net,
+                     NetRcTree& rc_tree) const;
+  void makeNetRcTree(NetRcTree& rc_tree);
+  void installNetRcTree(const NetRcTree& rc_tree,
+                        sta::SpefWriter* spef_writer);
+  void estimateNetRcTrees(std::vector<NetRcTree>& rc_trees,
+                          utl::ThreadPool* thread_pool,
+                          sta::SpefWriter* spef_writer);
   void makePadParasitic(const sta::Net* net, sta::SpefWriter* spef_writer);
   bool isPadNet(const sta::Net* net) const;
   bool isPadPin(const sta::Pin* pin) const;
   bool isPad(const sta::Instance* inst) const;
   odb::dbTechLayer* getPinLayer(const sta::Pin* pin);
   double computeAverageCutResistance(sta::Scene* scene);
-  void parasiticNodeConnectPins(sta::Parasitics* parasitics,
-                                sta::Parasitic* parasitic,
-                                sta::ParasiticNode* node,
-                                SteinerTree* tree,
-                                SteinerPt pt,
-                                size_t& resistor_id,
-                                sta::Scene* scene,
-                                std::set<const sta::Pin*>& connected_pins,
-                                const sta::Net* net,
-                                int& max_node_index,
-                                bool is_clk);
+  void connectPinsRc(SteinerTree* tree,
+                     SteinerPt pt,
+                     const RcNode& node,
+                     sta::Scene* corner,
+                     std::set<const sta::Pin*>& connected_pins,
+                     int& max_node_index,
+                     bool is_clk,
+                     std::vector<RcElement>& elements);
   void insertViaResistances(odb::dbTechLayer* pin_layer,
                             odb::dbTechLayer* tree_layer,
-                            sta::Parasitics* parasitics,
-                            sta::Parasitic* parasitic,
-                            sta::ParasiticNode* pin_node,
-                            sta::ParasiticNode* node,
-                            size_t& resistor_id,
+                            const RcNode& pin_node,
+                            const RcNode& node,
                             sta::Scene* corner,
-                            const sta::Net* net,
-                            int& max_node_index);
+                            int& max_node_index,
+                            std::vector<RcElement>& elements);
   void net2Pins(const sta::Net* net,
                 const sta::Pin*& pin1,
                 const sta::Pin*& pin2) const;
@@ -292,6 +364,10 @@ class EstimateParasitics : public sta::dbStaState, public ParasiticsService
   ParasiticsSrc parasitics_src_ = ParasiticsSrc::kNone;
 
   std::unordered_set<const sta::Net*, NetHash> parasitics_invalid_;
+  IncrementalParasiticsStats incremental_stats_;
+
+  // Created on first use and resized when the STA thread count changes.
+  std::unique_ptr<utl::ThreadPool> thread_pool_;
 
   std::unique_ptr<AbstractSteinerRenderer> steiner_renderer_;
 
@@ -300,6 +376,10 @@ class EstimateParasitics : public sta::dbStaState, public ParasiticsService
   bool incremental_parasitics_enabled_ = false;
 
   // constants
+  // Nets whose RC trees are held in memory at once by estimateWireParasitics.
+  static constexpr size_t kNetRcTreeBatchSize = 16384;
+  // Fewer pending nets than this are re-estimated on the calling thread.
+  static constexpr size_t kMinParallelNetRcTrees = 64;
   const sta::MinMax* min_ = sta::MinMax::min();
   const sta::MinMax* max_ = sta::MinMax::max();
 };
@@ -316,6 +396,7 @@ class IncrementalParasiticsGuard
  private:
   est::EstimateParasitics* estimate_parasitics_;
   bool need_unregister_;
+  IncrementalParasiticsStats stats_begin_;
 };
 
 }  // namespace est
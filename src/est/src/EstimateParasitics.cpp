@@ -11,6 +11,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <set>
 #include <utility>
@@ -47,6 +48,7 @@
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
 #include "utl/ServiceRegistry.h"
+#include "utl/ThreadPool.h"
 
 namespace est {
 
@@ -496,9 +498,14 @@ void EstimateParasitics::updateParasitics()
   network_->setDefaultLibertyLibrary(default_lib);
 
   switch (parasitics_src_) {
-    case ParasiticsSrc::kPlacement:
+    case ParasiticsSrc::kPlacement: {
+      // Nets invalidated several times since the last update are estimated
+      // once, as one batch that is built in parallel.
+      std::vector<NetRcTree> rc_trees;
+      rc_trees.reserve(parasitics_invalid_.size());
       for (const sta::Net* net : parasitics_invalid_) {
         if (isSkipNet(net)) {
+          incremental_stats_.skipped++;
           continue;
         }
         //
@@ -511,6 +518,7 @@ void EstimateParasitics::updateParasitics()
                      1,
                      "non-flat net {} is skipped",
                      sdc_network_->pathName(net));
+          incremental_stats_.skipped++;
           continue;
         }
         debugPrint(logger_,
@@ -519,15 +527,26 @@ void EstimateParasitics::updateParasitics()
                    1,
                    "net {} para is estimated for placement",
                    sdc_network_->pathName(net));
-        estimateWireParasitic(net);
+        if (initNetRcTree(net, rc_trees.emplace_back())) {
+          incremental_stats_.estimated++;
+        } else {
+          rc_trees.pop_back();
+        }
       }
+      estimateNetRcTrees(rc_trees,
+                         rc_trees.size() >= kMinParallelNetRcTrees
+                             ? threadPool()
+                             : nullptr,
+                         nullptr);
       break;
+    }
     case ParasiticsSrc::kGlobalRouting:
     case ParasiticsSrc::kDetailedRouting: {
       // TODO: update detailed route for modified nets
       incr_groute_->updateRoutes();
       for (const sta::Net* net : parasitics_invalid_) {
         if (isSkipNet(net)) {
+          incremental_stats_.skipped++;
           continue;
         }
         debugPrint(logger_,
@@ -537,6 +556,7 @@ void EstimateParasitics::updateParasitics()
                    "net {} para is estimated for GR or DR",
                    sdc_network_->pathName(net));
         estimateGlobalRouteRC(db_network_->staToDb(net));
+        incremental_stats_.estimated++;
       }
       break;
     }
@@ -564,6 +584,7 @@ void EstimateParasitics::updateParasitics()
     }
   }
   parasitics_invalid_.clear();
+  incremental_stats_.updates++;
 }
 
 bool EstimateParasitics::parasiticsValid() const
@@ -594,11 +615,13 @@ void EstimateParasitics::ensureWireParasitic(const sta::Pin* drvr_pin,
       case ParasiticsSrc::kPlacement:
         estimateWireParasitic(drvr_pin, net);
         parasitics_invalid_.erase(net);
+        incremental_stats_.estimated++;
         break;
       case ParasiticsSrc::kGlobalRouting: {
         incr_groute_->updateRoutes();
         estimateGlobalRouteRC(db_network_->staToDb(net));
         parasitics_invalid_.erase(net);
+        incremental_stats_.estimated++;
         break;
       }
       case ParasiticsSrc::kDetailedRouting:
@@ -699,16 +722,104 @@ void EstimateParasitics::estimateWireParasitics(sta::SpefWriter* spef_writer)
 
     sortClkAndSignalLayers();
 
+    // RC trees are built concurrently a batch at a time and then annotated
+    // serially in block net order, so the result matches a serial run.
+    utl::ThreadPool* thread_pool = threadPool();
+    std::vector<NetRcTree> rc_trees;
+    rc_trees.reserve(kNetRcTreeBatchSize);
     odb::dbSet<odb::dbNet> nets = block_->getNets();
     for (auto db_net : nets) {
-      sta::Net* cur_net = db_network_->dbToSta(db_net);
-      estimateWireParasitic(cur_net, spef_writer);
+      const sta::Net* cur_net = db_network_->dbToSta(db_net);
+      if (!initNetRcTree(cur_net, rc_trees.emplace_back())) {
+        rc_trees.pop_back();
+      }
+      if (rc_trees.size() >= kNetRcTreeBatchSize) {
+        estimateNetRcTrees(rc_trees, thread_pool, spef_writer);
+        rc_trees.clear();
+      }
     }
+    estimateNetRcTrees(rc_trees, thread_pool, spef_writer);
     parasitics_src_ = ParasiticsSrc::kPlacement;
     parasitics_invalid_.clear();
   }
 }
 
+utl::ThreadPool* EstimateParasitics::threadPool()
+{
+  const int thread_count = static_cast<int>(threadCount());
+  if (thread_count <= 1) {
+    thread_pool_.reset();
+    return nullptr;
+  }
+  // The calling thread only waits on each batch.
+  if (thread_pool_ == nullptr
+      || thread_pool_->threadCount() != static_cast<size_t>(thread_count)) {
+    stt_builder_->prepareConcurrentTrees();
+    thread_pool_ = std::make_unique<utl::ThreadPool>(thread_count);
+  }
+  return thread_pool_.get();
+}
+
+bool EstimateParasitics::initNetRcTree(const sta::Net* net,
+                                       NetRcTree& rc_tree) const
+{
+  PinSet* drivers = network_->drivers(net);
+  if (drivers == nullptr || drivers->empty() || network_->isPower(net)
+      || network_->isGround(net) || db_network_->staToDb(net)->isSpecial()) {
+    return false;
+  }
+  const Pin* drvr_pin = *drivers->begin();
+  if (isPadNet(net)) {
+    rc_tree.net = net;
+    rc_tree.is_pad = true;
+    return true;
+  }
+  if (isSkipPin(drvr_pin)) {
+    return false;
+  }
+  initNetRcTree(drvr_pin, net, rc_tree);
+  return true;
+}
+
+void EstimateParasitics::estimateNetRcTrees(std::vector<NetRcTree>& rc_trees,
+                                            utl::ThreadPool* thread_pool,
+                                            sta::SpefWriter* spef_writer)
+{
+  if (thread_pool == nullptr) {
+    for (NetRcTree& rc_tree : rc_trees) {
+      if (!rc_tree.is_pad) {
+        makeNetRcTree(rc_tree);
+      }
+    }
+  } else {
+    // A few chunks per thread balance nets of very different fanout
+    // without paying for one task per net.
+    const size_t chunk_count = thread_pool->threadCount() * 4;
+    const size_t chunk_size
+        = std::max<size_t>(1, (rc_trees.size() + chunk_count - 1) / chunk_count);
+    std::vector<std::pair<size_t, size_t>> chunks;
+    for (size_t begin = 0; begin < rc_trees.size(); begin += chunk_size) {
+      chunks.emplace_back(begin, std::min(begin + chunk_size, rc_trees.size()));
+    }
+    thread_pool->parallelFor(
+        chunks, [&](const std::pair<size_t, size_t>& chunk) {
+          for (size_t i = chunk.first; i < chunk.second; i++) {
+            if (!rc_trees[i].is_pad) {
+              makeNetRcTree(rc_trees[i]);
+            }
+          }
+        });
+  }
+
+  for (const NetRcTree& rc_tree : rc_trees) {
+    if (rc_tree.is_pad) {
+      makePadParasitic(rc_tree.net, spef_writer);
+    } else {
+      installNetRcTree(rc_tree, spef_writer);
+    }
+  }
+}
+
 void EstimateParasitics::estimateWireParasitic(const sta::Net* net,
                                                sta::SpefWriter* spef_writer)
 {
@@ -811,128 +922,176 @@ void EstimateParasitics::estimateWireParasiticSteiner(
   if (isSkipPin(drvr_pin)) {
     return;
   }
-  SteinerTree* tree = makeSteinerTree(drvr_pin);
-  if (tree) {
-    debugPrint(logger_,
-               EST,
-               "estimate_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (sta::Scene* corner : sta_->scenes()) {
-      if (sta_->isIdealClock(drvr_pin, corner->mode())) {
-        continue;
-      }
-      std::set<const Pin*> connected_pins;
-      Parasitics* parasitics = corner->parasitics(max_);
-      Parasitic* parasitic = parasitics->makeParasiticNetwork(net, false);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      const int branch_count = tree->branchCount();
-      int max_node_index = tree->getMaxIndex();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        odb::Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        sta::ParasiticNode* n1 = parasitics->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        sta::ParasiticNode* n2 = parasitics->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
-        } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-
-          // Reduce resistance if the net has NDR with increased width
-          odb::dbTechNonDefaultRule* ndr
-              = db_network_->staToDb(net)->getNonDefaultRule();
-          if (ndr) {
-            std::vector<odb::dbTechLayerRule*> layer_rules;
-            ndr->getLayerRules(layer_rules);
-            float ratio = (float) layer_rules.at(0)->getWidth()
-                          / layer_rules.at(0)->getLayer()->getWidth();
-            res /= ratio;
-          }
+  NetRcTree rc_tree;
+  initNetRcTree(drvr_pin, net, rc_tree);
+  makeNetRcTree(rc_tree);
+  installNetRcTree(rc_tree, spef_writer);
+}
 
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     EST,
-                     "estimate_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics->name(n2));
-          parasitics->incrCap(n1, cap / 2.0);
-          parasitics->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics->incrCap(n2, cap / 2.0);
+void EstimateParasitics::initNetRcTree(const sta::Pin* drvr_pin,
+                                       const sta::Net* net,
+                                       NetRcTree& rc_tree) const
+{
+  rc_tree.drvr_pin = drvr_pin;
+  rc_tree.net = net;
+  rc_tree.is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+  for (sta::Scene* corner : sta_->scenes()) {
+    if (!sta_->isIdealClock(drvr_pin, corner->mode())) {
+      rc_tree.scenes.push_back(corner);
+    }
+  }
+}
+
+// Only reads the netlist, placement and wire RC tables so it may run
+// concurrently for different nets.
+void EstimateParasitics::makeNetRcTree(NetRcTree& rc_tree)
+{
+  const sta::Net* net = rc_tree.net;
+  SteinerTree* tree = makeSteinerTree(rc_tree.drvr_pin);
+  if (tree == nullptr) {
+    return;
+  }
+  debugPrint(logger_,
+             EST,
+             "estimate_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+
+  // Reduce resistance if the net has NDR with increased width
+  float ndr_ratio = 1.0;
+  odb::dbTechNonDefaultRule* ndr
+      = db_network_->staToDb(net)->getNonDefaultRule();
+  if (ndr) {
+    std::vector<odb::dbTechLayerRule*> layer_rules;
+    ndr->getLayerRules(layer_rules);
+    ndr_ratio = (float) layer_rules.at(0)->getWidth()
+                / layer_rules.at(0)->getLayer()->getWidth();
+  }
+
+  const bool is_clk = rc_tree.is_clk;
+  rc_tree.elements.resize(rc_tree.scenes.size());
+  for (size_t scene_idx = 0; scene_idx < rc_tree.scenes.size(); scene_idx++) {
+    sta::Scene* corner = rc_tree.scenes[scene_idx];
+    std::vector<RcElement>& elements = rc_tree.elements[scene_idx];
+    std::set<const Pin*> connected_pins;
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    const int branch_count = tree->branchCount();
+    int max_node_index = tree->getMaxIndex();
+    for (int i = 0; i < branch_count; i++) {
+      odb::Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
+        } else {
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitics,
-                                 parasitic,
-                                 n1,
-                                 tree,
-                                 steiner_pt1,
-                                 resistor_id,
-                                 corner,
-                                 connected_pins,
-                                 net,
-                                 max_node_index,
-                                 is_clk);
-        parasiticNodeConnectPins(parasitics,
-                                 parasitic,
-                                 n2,
-                                 tree,
-                                 steiner_pt2,
-                                 resistor_id,
-                                 corner,
-                                 connected_pins,
-                                 net,
-                                 max_node_index,
-                                 is_clk);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      if (spef_writer) {
-        spef_writer->writeNet(corner, net, parasitic, parasitics);
+      const RcNode n1{.pin = nullptr, .index = steiner_pt1};
+      const RcNode n2{.pin = nullptr, .index = steiner_pt2};
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        elements.push_back(RcElement::resistor(n1, n2, 1.0e-3));
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap;
+        double res = length * wire_res / ndr_ratio;
+
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   EST,
+                   "estimate_parasitics",
+                   2,
+                   " pi {}:{} l={} c2={} rpi={} c1={} {}:{}",
+                   sdc_network_->pathName(net),
+                   steiner_pt1,
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   sdc_network_->pathName(net),
+                   steiner_pt2);
+        elements.push_back(RcElement::capacitor(n1, cap / 2.0));
+        elements.push_back(RcElement::resistor(n1, n2, res));
+        elements.push_back(RcElement::capacitor(n2, cap / 2.0));
       }
+      connectPinsRc(tree,
+                    steiner_pt1,
+                    n1,
+                    corner,
+                    connected_pins,
+                    max_node_index,
+                    is_clk,
+                    elements);
+      connectPinsRc(tree,
+                    steiner_pt2,
+                    n2,
+                    corner,
+                    connected_pins,
+                    max_node_index,
+                    is_clk,
+                    elements);
+    }
+  }
+  delete tree;
+}
 
-      if (arc_delay_calc_->reduceSupported()) {
-        arc_delay_calc_->reduceParasitic(
-            parasitic, net, corner, sta::MinMaxAll::all());
-        parasitics->deleteParasiticNetwork(net);
+void EstimateParasitics::installNetRcTree(const NetRcTree& rc_tree,
+                                          sta::SpefWriter* spef_writer)
+{
+  const sta::Net* net = rc_tree.net;
+  for (size_t scene_idx = 0; scene_idx < rc_tree.elements.size();
+       scene_idx++) {
+    sta::Scene* corner = rc_tree.scenes[scene_idx];
+    Parasitics* parasitics = corner->parasitics(max_);
+    Parasitic* parasitic = parasitics->makeParasiticNetwork(net, false);
+    auto ensure_node = [&](const RcNode& node) {
+      if (node.pin != nullptr) {
+        return parasitics->ensureParasiticNode(parasitic, node.pin, network_);
+      }
+      return parasitics->ensureParasiticNode(
+          parasitic, net, node.index, network_);
+    };
+    size_t resistor_id = 1;
+    for (const RcElement& element : rc_tree.elements[scene_idx]) {
+      sta::ParasiticNode* n1 = ensure_node(element.n1);
+      if (element.is_resistor) {
+        sta::ParasiticNode* n2 = ensure_node(element.n2);
+        parasitics->makeResistor(
+            parasitic, resistor_id++, element.value, n1, n2);
+      } else {
+        parasitics->incrCap(n1, element.value);
       }
     }
-    delete tree;
+    if (spef_writer) {
+      spef_writer->writeNet(corner, net, parasitic, parasitics);
+    }
+
+    if (arc_delay_calc_->reduceSupported()) {
+      arc_delay_calc_->reduceParasitic(
+          parasitic, net, corner, sta::MinMaxAll::all());
+      parasitics->deleteParasiticNetwork(net);
+    }
   }
 }
 
@@ -1015,18 +1174,14 @@ double EstimateParasitics::computeAverageCutResistance(sta::Scene* scene)
   return count > 0 ? total_resistance / count : 0.0;
 }
 
-void EstimateParasitics::parasiticNodeConnectPins(
-    sta::Parasitics* parasitics,
-    sta::Parasitic* parasitic,
-    sta::ParasiticNode* node,
-    SteinerTree* tree,
-    SteinerPt pt,
-    size_t& resistor_id,
-    sta::Scene* corner,
-    std::set<const Pin*>& connected_pins,
-    const sta::Net* net,
-    int& max_node_index,
-    const bool is_clk)
+void EstimateParasitics::connectPinsRc(SteinerTree* tree,
+                                       SteinerPt pt,
+                                       const RcNode& node,
+                                       sta::Scene* corner,
+                                       std::set<const Pin*>& connected_pins,
+                                       int& max_node_index,
+                                       const bool is_clk,
+                                       std::vector<RcElement>& elements)
 {
   const sta::PinSeq* pins = tree->pins(pt);
   if (pins) {
@@ -1035,26 +1190,21 @@ void EstimateParasitics::parasiticNodeConnectPins(
     odb::dbTechLayer* tree_layer = layers.empty() ? nullptr : layers[0];
 
     for (const sta::Pin* pin : *pins) {
-      sta::ParasiticNode* pin_node
-          = parasitics->ensureParasiticNode(parasitic, pin, network_);
+      const RcNode pin_node{.pin = pin, .index = 0};
       if (connected_pins.find(pin) == connected_pins.end()) {
         if (tree_layer != nullptr && !layer_res_.empty()) {
           odb::dbTechLayer* pin_layer = getPinLayer(pin);
           insertViaResistances(pin_layer,
                                tree_layer,
-                               parasitics,
-                               parasitic,
                                pin_node,
                                node,
-                               resistor_id,
                                corner,
-                               net,
-                               max_node_index);
+                               max_node_index,
+                               elements);
         } else {
           double cut_res
               = std::max(computeAverageCutResistance(corner), 1.0e-3);
-          parasitics->makeResistor(
-              parasitic, resistor_id++, cut_res, node, pin_node);
+          elements.push_back(RcElement::resistor(node, pin_node, cut_res));
         }
         connected_pins.insert(pin);
       }
@@ -1064,16 +1214,13 @@ void EstimateParasitics::parasiticNodeConnectPins(
 
 void EstimateParasitics::insertViaResistances(odb::dbTechLayer* pin_layer,
                                               odb::dbTechLayer* tree_layer,
-                                              sta::Parasitics* parasitics,
-                                              sta::Parasitic* parasitic,
-                                              sta::ParasiticNode* pin_node,
-                                              sta::ParasiticNode* node,
-                                              size_t& resistor_id,
+                                              const RcNode& pin_node,
+                                              const RcNode& node,
                                               sta::Scene* corner,
-                                              const sta::Net* net,
-                                              int& max_node_index)
+                                              int& max_node_index,
+                                              std::vector<RcElement>& elements)
 {
-  sta::ParasiticNode* prev_node = nullptr;
+  std::optional<RcNode> prev_node;
 
   odb::dbTech* tech = pin_layer->getTech();
   const int pin_layer_idx = pin_layer->getNumber();
@@ -1089,11 +1236,11 @@ void EstimateParasitics::insertViaResistances(odb::dbTechLayer* pin_layer,
       layerRC(cut_layer, corner, res, cap);
     }
     const double cut_res = std::max(res, 1.0e-3);
-    parasitics->makeResistor(parasitic, resistor_id++, cut_res, pin_node, node);
+    elements.push_back(RcElement::resistor(pin_node, node, cut_res));
   } else if (pin_layer_idx == tree_layer_idx) {
     // Add a small resistor between the pin node and tree node to keep
     // connectivity
-    parasitics->makeResistor(parasitic, resistor_id++, 1.0e-3, pin_node, node);
+    elements.push_back(RcElement::resistor(pin_node, node, 1.0e-3));
   } else {
     const auto [start_idx, end_idx]
         = std::minmax(pin_layer_idx, tree_layer_idx);
@@ -1113,8 +1260,8 @@ void EstimateParasitics::insertViaResistances(odb::dbTechLayer* pin_layer,
       // resistor connects directly to the pin or tree anchor; pre-allocating
       // a mid_node here would create a floating ParasiticNode (singular row
       // in the conductance matrix for Prima/CCS).
-      sta::ParasiticNode* from_node = prev_node;
-      sta::ParasiticNode* to_node = nullptr;
+      std::optional<RcNode> from_node = prev_node;
+      std::optional<RcNode> to_node;
       bool need_new_mid = true;
       if (pin_is_below) {
         if (layer_idx - 1 == pin_layer_idx) {
@@ -1134,17 +1281,15 @@ void EstimateParasitics::insertViaResistances(odb::dbTechLayer* pin_layer,
         }
       }
 
-      sta::ParasiticNode* mid_node = nullptr;
+      std::optional<RcNode> mid_node;
       if (need_new_mid) {
-        mid_node = parasitics->ensureParasiticNode(
-            parasitic, net, ++max_node_index, network_);
+        mid_node = RcNode{.pin = nullptr, .index = ++max_node_index};
         to_node = mid_node;
       }
 
-      parasitics->makeResistor(
-          parasitic, resistor_id++, cut_res, from_node, to_node);
+      elements.push_back(RcElement::resistor(*from_node, *to_node, cut_res));
 
-      // On the terminal iteration mid_node is nullptr and prev_node is unused
+      // On the terminal iteration mid_node is empty and prev_node is unused
       // by the next iteration (there is none); on every other iteration we
       // chain through the freshly allocated mid_node.
       prev_node = mid_node;
@@ -1301,10 +1446,41 @@ void EstimateParasitics::parasiticsInvalid(const sta::Net* net)
                2,
                "parasitics invalid {}",
                network_->pathName(net));
-    parasitics_invalid_.insert(db_network_->dbToSta(db_net));
+    incremental_stats_.invalidations++;
+    if (!parasitics_invalid_.insert(db_network_->dbToSta(db_net)).second) {
+      // Already pending since the last update; it is estimated once.
+      incremental_stats_.repeated++;
+    }
   }
 }
 
+void EstimateParasitics::reportIncrementalStats(
+    const IncrementalParasiticsStats& begin) const
+{
+  const int64_t updates = incremental_stats_.updates - begin.updates;
+  const int64_t invalidations
+      = incremental_stats_.invalidations - begin.invalidations;
+  const int64_t repeated = incremental_stats_.repeated - begin.repeated;
+  const int64_t estimated = incremental_stats_.estimated - begin.estimated;
+  const int64_t skipped = incremental_stats_.skipped - begin.skipped;
+  debugPrint(logger_,
+             EST,
+             "estimate_parasitics",
+             1,
+             "incremental parasitics: {} updates {} invalidations {} "
+             "repeated {} estimated {} skipped",
+             updates,
+             invalidations,
+             repeated,
+             estimated,
+             skipped);
+  logger_->metric("est__incremental__updates", updates);
+  logger_->metric("est__incremental__invalidations", invalidations);
+  logger_->metric("est__incremental__repeated", repeated);
+  logger_->metric("est__incremental__estimated", estimated);
+  logger_->metric("est__incremental__skipped", skipped);
+}
+
 void EstimateParasitics::parasiticsInvalid(const odb::dbNet* net)
 {
   parasiticsInvalid(db_network_->dbToSta(net));
@@ -1513,6 +1689,7 @@ IncrementalParasiticsGuard::IncrementalParasiticsGuard(
     estimate_parasitics_->setIncrementalParasiticsEnabled(true);
     estimate_parasitics_->setDbCbkOwner(estimate_parasitics_->getBlock());
     need_unregister_ = true;
+    stats_begin_ = estimate_parasitics_->incrementalStats();
   }
 }
 
@@ -1527,6 +1704,7 @@ IncrementalParasiticsGuard::~IncrementalParasiticsGuard()
     try {
       estimate_parasitics_->removeDbCbkOwner();
       estimate_parasitics_->updateParasitics();
+      estimate_parasitics_->reportIncrementalStats(stats_begin_);
     } catch (const std::exception& e) {
       // Exceptions must not escape destructors (implicitly noexcept).
       // Log and continue with cleanup.
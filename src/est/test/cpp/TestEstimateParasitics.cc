@@ -1,6 +1,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2026, The OpenROAD Authors
 
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
 #include "db_sta/dbNetwork.hh"
 #include "est/EstimateParasitics.h"
 #include "gtest/gtest.h"
@@ -412,4 +418,116 @@ TEST_F(TestEstimateParasitics, WireRcPerTech)
   EXPECT_DOUBLE_EQ(ep_.wireSignalVResistance(scene), 2.0e3);
 }
 
+// Verifies that estimating the whole design with several threads annotates
+// the same reduced parasitics as a single-threaded run.
+TEST_F(TestEstimateParasitics, ParallelEstimateMatchesSerial)
+{
+  readVerilogAndSetup("TestEstimateParasitics.v");
+  placeDesign();
+
+  auto pi_models = [this]() {
+    std::vector<std::array<float, 3>> models;
+    sta::Parasitics* par
+        = sta_->scenes().front()->parasitics(sta::MinMax::max());
+    for (odb::dbNet* db_net : block_->getNets()) {
+      sta::PinSet* drivers
+          = db_network_->drivers(db_network_->dbToSta(db_net));
+      if (drivers == nullptr || drivers->empty()) {
+        continue;
+      }
+      std::array<float, 3> model{0.0, 0.0, 0.0};
+      sta::Parasitic* pi = par->findPiElmore(
+          *drivers->begin(), sta::RiseFall::rise(), sta::MinMax::max());
+      if (pi != nullptr) {
+        par->piModel(pi, model[0], model[1], model[2]);
+      }
+      models.push_back(model);
+    }
+    return models;
+  };
+
+  sta_->setThreadCount(1);
+  ep_.estimateWireParasitics();
+  const std::vector<std::array<float, 3>> serial = pi_models();
+
+  sta_->setThreadCount(4);
+  ep_.estimateWireParasitics();
+  EXPECT_EQ(pi_models(), serial);
+  sta_->setThreadCount(1);
+}
+
+// Verifies that a net invalidated several times before updateParasitics() is
+// re-estimated once and that the repeated invalidations are counted.
+TEST_F(TestEstimateParasitics, RepeatedInvalidationIsEstimatedOnce)
+{
+  readVerilogAndSetup("TestEstimateParasitics.v");
+  placeDesign();
+  ep_.estimateWireParasitics();
+
+  sta::Net* q0_net = flatNet(findTopPin("q0"));
+  ASSERT_NE(q0_net, nullptr);
+  sta_->scenes().front()->parasitics(sta::MinMax::max())->deleteParasitics();
+  ASSERT_FALSE(hasPi(q0_net));
+
+  const IncrementalParasiticsStats before = ep_.incrementalStats();
+  ep_.setParasiticsSrc(ParasiticsSrc::kPlacement);
+  ep_.setIncrementalParasiticsEnabled(true);
+  ep_.parasiticsInvalid(q0_net);
+  ep_.parasiticsInvalid(q0_net);
+  ep_.parasiticsInvalid(q0_net);
+  ep_.updateParasitics();
+
+  const IncrementalParasiticsStats& after = ep_.incrementalStats();
+  EXPECT_TRUE(hasPi(q0_net));
+  EXPECT_EQ(after.invalidations - before.invalidations, 3);
+  EXPECT_EQ(after.repeated - before.repeated, 2);
+  EXPECT_EQ(after.estimated - before.estimated, 1);
+  EXPECT_EQ(after.updates - before.updates, 1);
+  ep_.setIncrementalParasiticsEnabled(false);
+}
+
+// Verifies that a guard writes the counters of its own scope to the metrics
+// when it is released.
+TEST_F(TestEstimateParasitics, GuardReportsIncrementalMetrics)
+{
+  readVerilogAndSetup("TestEstimateParasitics.v");
+  placeDesign();
+  ep_.setParasiticsSrc(ParasiticsSrc::kPlacement);
+  ep_.estimateWireParasitics();
+
+  sta::Net* q0_net = flatNet(findTopPin("q0"));
+  ASSERT_NE(q0_net, nullptr);
+
+  // Counters from before the guard must not show up in its metrics.
+  ep_.setIncrementalParasiticsEnabled(true);
+  ep_.parasiticsInvalid(q0_net);
+  ep_.updateParasitics();
+  ep_.setIncrementalParasiticsEnabled(false);
+
+  const std::string metrics_file = "est_incremental_metrics.json";
+  logger_.addMetricsSink(metrics_file.c_str());
+  {
+    IncrementalParasiticsGuard guard(&ep_);
+    ep_.parasiticsInvalid(q0_net);
+    ep_.parasiticsInvalid(q0_net);
+  }
+  logger_.removeMetricsSink(metrics_file.c_str());
+
+  std::ifstream file(metrics_file);
+  ASSERT_TRUE(file.good());
+  const std::string content((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  EXPECT_NE(content.find("\"est__incremental__updates\": 1"),
+            std::string::npos);
+  EXPECT_NE(content.find("\"est__incremental__invalidations\": 2"),
+            std::string::npos);
+  EXPECT_NE(content.find("\"est__incremental__repeated\": 1"),
+            std::string::npos);
+  EXPECT_NE(content.find("\"est__incremental__estimated\": 1"),
+            std::string::npos);
+  EXPECT_NE(content.find("\"est__incremental__skipped\": 0"),
+            std::string::npos);
+  removeFile(metrics_file);
+}
+
 }  // namespace est
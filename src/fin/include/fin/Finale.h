@@ -16,14 +16,19 @@ class Finale
  public:
   Finale(odb::dbDatabase* db, utl::Logger* logger);
 
-  void densityFill(const char* rules_filename, const odb::Rect& fill_area);
+  void densityFill(const char* rules_filename,
+                   const odb::Rect& fill_area,
+                   int num_threads = 1);
 
   void setDebug();
+  // Layers are filled in square tiles of this size.
+  void setTileSize(int microns);
 
  private:
   odb::dbDatabase* db_ = nullptr;
   utl::Logger* logger_ = nullptr;
   bool debug_ = false;
+  int tile_size_microns_ = 500;
 };
 
 }  // namespace fin
@@ -5,8 +5,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -20,6 +23,10 @@
 #include "odb/geom.h"
 #include "polygon.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
+#include "utl/Trace.h"
+#include "utl/mem_stats.h"
+#include "utl/timer.h"
 
 namespace fin {
 
@@ -64,6 +71,26 @@ struct DensityFillLayerConfig
   DensityFillShapesConfig non_opc;
 };
 
+// A fill shape waiting to be created in the db
+struct FillShape
+{
+  Rect rect;
+  int mask;
+};
+
+// A part of the fill area on a layer that is filled independently of the
+// other tiles.
+struct FillTile
+{
+  Rect bounds;
+  // Non-fill shapes near the tile; released once merged
+  std::vector<Rect> non_fill;
+  int non_opc_areas = 0;
+  int opc_areas = 0;
+  std::vector<FillShape> non_opc_fills;
+  std::vector<FillShape> opc_fills;
+};
+
 // Make a boost polygon representing a rectangle
 static Polygon90 makeRect(int x_lo, int y_lo, int x_hi, int y_hi)
 {
@@ -196,10 +223,10 @@ void DensityFill::loadConfig(const char* cfg_filename, dbTech* tech)
   readAndExpandLayers(tech, tree);
 }
 
-// Insert into polygon_set any part of given shape on the given layer (shape may
+// Append to rects any part of given shape on the given layer (shape may
 // be a via)
 static void insertShape(const dbShape& shape,
-                        Polygon90Set& polygon_set,
+                        std::vector<Rect>& rects,
                         dbTechLayer* layer)
 {
   auto type = shape.getType();
@@ -225,34 +252,29 @@ static void insertShape(const dbShape& shape,
       dbShape::getViaBoxes(shape, boxes);
       for (auto& box : boxes) {
         if (box.getTechLayer() == layer) {
-          polygon_set.insert(
-              makeRect(box.xMin(), box.yMin(), box.xMax(), box.yMax()));
+          rects.emplace_back(box.xMin(), box.yMin(), box.xMax(), box.yMax());
         }
       }
       break;
     }
     case dbShape::SEGMENT:
-      if (shape.getTechLayer() == layer) {
-        polygon_set.insert(
-            makeRect(shape.xMin(), shape.yMin(), shape.xMax(), shape.yMax()));
-      }
-      break;
     case dbShape::TECH_VIA_BOX:
     case dbShape::VIA_BOX:
       if (shape.getTechLayer() == layer) {
-        polygon_set.insert(
-            makeRect(shape.xMin(), shape.yMin(), shape.xMax(), shape.yMax()));
+        rects.emplace_back(
+            shape.xMin(), shape.yMin(), shape.xMax(), shape.yMax());
       }
       break;
   }
 }
 
-// Build a polygon set out of all the non-fill shape on the given layer
-// including wires, special wires, and instances' pins & OBS
-static Polygon90Set orNonFills(dbBlock* block, dbTechLayer* layer)
+// Collect the non-fill shapes on the given layer including wires, special
+// wires, and instances' pins & OBS.  They are kept as plain rectangles and
+// only merged per tile.
+static std::vector<Rect> collectNonFills(dbBlock* block, dbTechLayer* layer)
 {
-  Polygon90Set non_fill;  // The result
-  dbShape shape;          // Shared temp
+  std::vector<Rect> non_fill;  // The result
+  dbShape shape;               // Shared temp
 
   // Get shapes from regular wires
   dbWireShapeItr shapes;
@@ -280,8 +302,7 @@ static Polygon90Set orNonFills(dbBlock* block, dbTechLayer* layer)
             insertShape(via_shape, non_fill, layer);
           }
         } else if (sbox->getTechLayer() == layer) {
-          non_fill.insert(
-              makeRect(sbox->xMin(), sbox->yMin(), sbox->xMax(), sbox->yMax()));
+          non_fill.push_back(sbox->getBox());
         }
       }
     }
@@ -335,15 +356,15 @@ static void prune(Polygon90Set& fill_area,
 }
 
 // Fill a polygon (area) on the given layer using the given configuration.
-// Num_masks is used to color the generated fills.
+// Num_masks is used to color the generated fills which are appended to
+// fills_out.
 // filled_area, if given, is an OR of the generated fills without bloating
 static void fillPolygon(const Polygon90& area,
                         dbTechLayer* layer,
-                        dbBlock* block,
                         const DensityFillShapesConfig& cfg,
                         int num_masks,
-                        bool needs_opc,
                         Graphics* graphics,
+                        std::vector<FillShape>& fills_out,
                         Polygon90Set* filled_area = nullptr)
 {
   // Convert the area polygon to a polygon set as we will remove areas
@@ -408,7 +429,7 @@ static void fillPolygon(const Polygon90& area,
       Polygon90Set tmp_fills(fills);
       all_iter_fills += bloat(tmp_fills, space_x, space_x, space_y, space_y);
 
-      // Insert fills into the db
+      // Record the fills for insertion into the db
       std::vector<Rectangle> polygons;
       fills.get_rectangles(polygons);
       const int num_mask = std::max(num_masks, 1);
@@ -424,7 +445,7 @@ static void fillPolygon(const Polygon90& area,
         auto y_lo = yl(f);
         auto x_hi = xh(f);
         auto y_hi = yh(f);
-        dbFill::create(block, needs_opc, mask, layer, x_lo, y_lo, x_hi, y_hi);
+        fills_out.push_back({Rect(x_lo, y_lo, x_hi, y_hi), mask});
         if (filled_area) {
           *filled_area += makeRect(x_lo, y_lo, x_hi, y_hi);
         }
@@ -435,21 +456,24 @@ static void fillPolygon(const Polygon90& area,
   }
 }
 
-// Fill the given layer
-void DensityFill::fillLayer(dbBlock* block,
-                            dbTechLayer* layer,
-                            const odb::Rect& fill_bounds_rect)
+// Fill the area of one tile.  Only reads the db so tiles may be filled
+// concurrently.
+static void fillTile(FillTile& tile,
+                     dbTechLayer* layer,
+                     const DensityFillLayerConfig& cfg,
+                     Graphics* graphics)
 {
-  logger_->info(FIN, 3, "Filling layer {}.", layer->getConstName());
-
-  Polygon90Set non_fill = orNonFills(block, layer);
-
-  auto fill_bounds = makeRect(fill_bounds_rect.xMin(),
-                              fill_bounds_rect.yMin(),
-                              fill_bounds_rect.xMax(),
-                              fill_bounds_rect.yMax());
+  Polygon90Set non_fill;
+  for (const Rect& rect : tile.non_fill) {
+    non_fill.insert(
+        makeRect(rect.xMin(), rect.yMin(), rect.xMax(), rect.yMax()));
+  }
+  // The merged set replaces the rectangles
+  tile.non_fill = std::vector<Rect>();
 
-  const DensityFillLayerConfig& cfg = layers_[layer];
+  const Rect& bounds = tile.bounds;
+  auto fill_bounds
+      = makeRect(bounds.xMin(), bounds.yMin(), bounds.xMax(), bounds.yMax());
 
   std::vector<Polygon90> polygons;
 
@@ -457,28 +481,26 @@ void DensityFill::fillLayer(dbBlock* block,
   Polygon90Set fill_area
       = fill_bounds - (non_fill + cfg.non_opc.space_to_non_fill);
 
-  if (graphics_) {
-    graphics_->status("Non-OPC Area");
-    graphics_->drawPolygon90Set(fill_area);
+  if (graphics) {
+    graphics->status("Non-OPC Area");
+    graphics->drawPolygon90Set(fill_area);
   }
 
-  prune(fill_area, layer, cfg.non_opc, graphics_.get());
+  prune(fill_area, layer, cfg.non_opc, graphics);
 
   fill_area.get(polygons);
-  logger_->info(FIN, 9, "Filling {} areas with non-OPC fill.", polygons.size());
+  tile.non_opc_areas = polygons.size();
 
   Polygon90Set non_opc_fill_area;
   for (auto& polygon : polygons) {
     fillPolygon(polygon,
                 layer,
-                block,
                 cfg.non_opc,
                 cfg.num_masks,
-                false,
-                graphics_.get(),
+                graphics,
+                tile.non_opc_fills,
                 &non_opc_fill_area);
   }
-  logger_->info(FIN, 4, "Total fills: {}.", block->getFills().size());
 
   if (!cfg.has_opc) {
     return;
@@ -488,32 +510,183 @@ void DensityFill::fillLayer(dbBlock* block,
       = fill_bounds - (non_fill + cfg.opc.space_to_non_fill)
         - (non_opc_fill_area + cfg.non_opc.space_to_fill);
 
-  if (graphics_) {
-    graphics_->status("OPC Area");
-    graphics_->drawPolygon90Set(opc_fill_area);
+  if (graphics) {
+    graphics->status("OPC Area");
+    graphics->drawPolygon90Set(opc_fill_area);
   }
 
-  prune(opc_fill_area, layer, cfg.opc, graphics_.get());
+  prune(opc_fill_area, layer, cfg.opc, graphics);
 
   polygons.clear();
   opc_fill_area.get(polygons);
-  logger_->info(FIN, 5, "Filling {} areas with OPC fill.", polygons.size());
+  tile.opc_areas = polygons.size();
   for (auto& polygon : polygons) {
     fillPolygon(
-        polygon, layer, block, cfg.opc, cfg.num_masks, true, graphics_.get());
+        polygon, layer, cfg.opc, cfg.num_masks, graphics, tile.opc_fills);
   }
 
-  logger_->info(FIN, 6, "Total fills: {}.", block->getFills().size());
+  if (graphics) {
+    graphics->status("OPC Area");
+    graphics->drawPolygon90Set(opc_fill_area);
+  }
+}
 
-  if (graphics_) {
-    graphics_->status("OPC Area");
-    graphics_->drawPolygon90Set(opc_fill_area);
+// Split the fill bounds into tiles that are filled independently.
+// Interior tile edges are pulled in by half the largest fill spacing so
+// fills in neighboring tiles remain legal, and each tile receives the
+// non-fill shapes that are within the non-fill spacing of it.
+static std::vector<FillTile> makeTiles(const Rect& fill_bounds,
+                                       const int tile_size,
+                                       dbTechLayer* layer,
+                                       const DensityFillLayerConfig& cfg,
+                                       const std::vector<Rect>& non_fill)
+{
+  auto [space_x, space_y] = getSpacing(layer, cfg.non_opc);
+  int halo = cfg.non_opc.space_to_non_fill;
+  if (cfg.has_opc) {
+    auto [opc_space_x, opc_space_y] = getSpacing(layer, cfg.opc);
+    space_x = std::max(space_x, opc_space_x);
+    space_y = std::max(space_y, opc_space_y);
+    halo = std::max(halo, cfg.opc.space_to_non_fill);
   }
+  const int margin_x = (space_x + 1) / 2;
+  const int margin_y = (space_y + 1) / 2;
+
+  const int64_t dx = fill_bounds.dx();
+  const int64_t dy = fill_bounds.dy();
+  const int num_x = std::max<int64_t>(1, (dx + tile_size - 1) / tile_size);
+  const int num_y = std::max<int64_t>(1, (dy + tile_size - 1) / tile_size);
+  auto tile_x = [&](const int i) {
+    return static_cast<int>(fill_bounds.xMin() + dx * i / num_x);
+  };
+  auto tile_y = [&](const int i) {
+    return static_cast<int>(fill_bounds.yMin() + dy * i / num_y);
+  };
+
+  std::vector<FillTile> tiles(static_cast<size_t>(num_x) * num_y);
+  for (int iy = 0; iy < num_y; iy++) {
+    for (int ix = 0; ix < num_x; ix++) {
+      const int x_lo = tile_x(ix) + (ix > 0 ? margin_x : 0);
+      const int x_hi = tile_x(ix + 1) - (ix < num_x - 1 ? margin_x : 0);
+      const int y_lo = tile_y(iy) + (iy > 0 ? margin_y : 0);
+      const int y_hi = tile_y(iy + 1) - (iy < num_y - 1 ? margin_y : 0);
+      tiles[iy * num_x + ix].bounds = Rect(x_lo, y_lo, x_hi, y_hi);
+    }
+  }
+
+  auto index_x = [&](const int64_t x) {
+    const int64_t i = dx == 0 ? 0 : (x - fill_bounds.xMin()) * num_x / dx;
+    return static_cast<int>(std::clamp<int64_t>(i, 0, num_x - 1));
+  };
+  auto index_y = [&](const int64_t y) {
+    const int64_t i = dy == 0 ? 0 : (y - fill_bounds.yMin()) * num_y / dy;
+    return static_cast<int>(std::clamp<int64_t>(i, 0, num_y - 1));
+  };
+  for (const Rect& rect : non_fill) {
+    if (rect.xMax() + halo < fill_bounds.xMin()
+        || rect.xMin() - halo > fill_bounds.xMax()
+        || rect.yMax() + halo < fill_bounds.yMin()
+        || rect.yMin() - halo > fill_bounds.yMax()) {
+      continue;
+    }
+    const int ix_hi = index_x(int64_t{rect.xMax()} + halo);
+    const int iy_hi = index_y(int64_t{rect.yMax()} + halo);
+    for (int iy = index_y(int64_t{rect.yMin()} - halo); iy <= iy_hi; iy++) {
+      for (int ix = index_x(int64_t{rect.xMin()} - halo); ix <= ix_hi; ix++) {
+        tiles[iy * num_x + ix].non_fill.push_back(rect);
+      }
+    }
+  }
+
+  return tiles;
+}
+
+// Fill the given layer
+void DensityFill::fillLayer(dbBlock* block,
+                            dbTechLayer* layer,
+                            const odb::Rect& fill_bounds)
+{
+  logger_->info(FIN, 3, "Filling layer {}.", layer->getConstName());
+  utl::Timer timer;
+  const size_t start_rss = utl::getCurrentRSS();
+
+  const DensityFillLayerConfig& cfg = layers_[layer];
+  const int tile_size = tile_size_microns_ * block->getDbUnitsPerMicron();
+  std::vector<FillTile> tiles = makeTiles(
+      fill_bounds, tile_size, layer, cfg, collectNonFills(block, layer));
+
+  if (graphics_ || num_threads_ <= 1 || tiles.size() == 1) {
+    for (FillTile& tile : tiles) {
+      fillTile(tile, layer, cfg, graphics_.get());
+    }
+  } else {
+    std::vector<int> tile_indices(tiles.size());
+    std::iota(tile_indices.begin(), tile_indices.end(), 0);
+    utl::ThreadPool pool(num_threads_);
+    pool.parallelFor(tile_indices, [&](const int index) {
+      fillTile(tiles[index], layer, cfg, nullptr);
+    });
+  }
+
+  // Create the fills serially in tile order so the result does not depend
+  // on the thread count.
+  auto create_fills = [&](std::vector<FillShape> FillTile::*fills,
+                          const bool needs_opc) {
+    for (const FillTile& tile : tiles) {
+      for (const FillShape& fill : tile.*fills) {
+        const Rect& rect = fill.rect;
+        dbFill::create(block,
+                       needs_opc,
+                       fill.mask,
+                       layer,
+                       rect.xMin(),
+                       rect.yMin(),
+                       rect.xMax(),
+                       rect.yMax());
+      }
+    }
+  };
+
+  int non_opc_areas = 0;
+  int opc_areas = 0;
+  for (const FillTile& tile : tiles) {
+    non_opc_areas += tile.non_opc_areas;
+    opc_areas += tile.opc_areas;
+  }
+
+  logger_->info(FIN, 9, "Filling {} areas with non-OPC fill.", non_opc_areas);
+  create_fills(&FillTile::non_opc_fills, false);
+  logger_->info(FIN, 4, "Total fills: {}.", block->getFills().size());
+
+  if (cfg.has_opc) {
+    logger_->info(FIN, 5, "Filling {} areas with OPC fill.", opc_areas);
+    create_fills(&FillTile::opc_fills, true);
+    logger_->info(FIN, 6, "Total fills: {}.", block->getFills().size());
+  }
+
+  debugPrint(logger_,
+             FIN,
+             "density_fill",
+             1,
+             "Layer {}: {} tiles in {:.2f}s, RSS grew {:.1f} MB, process "
+             "peak RSS {:.1f} MB.",
+             layer->getConstName(),
+             tiles.size(),
+             timer.elapsed(),
+             (static_cast<double>(utl::getCurrentRSS()) - start_rss)
+                 / (1024.0 * 1024.0),
+             utl::getPeakRSS() / (1024.0 * 1024.0));
 }
 
 // Fill the design according to the given cfg file
-void DensityFill::fill(const char* cfg_filename, const odb::Rect& fill_area)
+void DensityFill::fill(const char* cfg_filename,
+                       const odb::Rect& fill_area,
+                       const int num_threads,
+                       const int tile_size_microns)
 {
+  utl::TraceScope trace("fin::densityFill");
+  num_threads_ = num_threads;
+  tile_size_microns_ = tile_size_microns;
   dbTech* tech = db_->getTech();
   loadConfig(cfg_filename, tech);
 
@@ -33,7 +33,10 @@ class DensityFill
   DensityFill(const DensityFill&&) = delete;
   DensityFill& operator=(const DensityFill&&) = delete;
 
-  void fill(const char* cfg_filename, const odb::Rect& fill_area);
+  void fill(const char* cfg_filename,
+            const odb::Rect& fill_area,
+            int num_threads,
+            int tile_size_microns);
 
  private:
   void loadConfig(const char* cfg_filename, odb::dbTech* tech);
@@ -47,6 +50,9 @@ class DensityFill
   odb::PtrMap<odb::dbTechLayer, DensityFillLayerConfig> layers_;
   std::unique_ptr<Graphics> graphics_;
   utl::Logger* logger_;
+  int num_threads_ = 1;
+  // Layers are filled in square tiles of this size
+  int tile_size_microns_ = 500;
 };
 
 }  // namespace fin
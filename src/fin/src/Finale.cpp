@@ -22,10 +22,17 @@ void Finale::setDebug()
   debug_ = true;
 }
 
-void Finale::densityFill(const char* rules_filename, const odb::Rect& fill_area)
+void Finale::setTileSize(const int microns)
+{
+  tile_size_microns_ = microns;
+}
+
+void Finale::densityFill(const char* rules_filename,
+                         const odb::Rect& fill_area,
+                         const int num_threads)
 {
   DensityFill filler(db_, logger_, debug_);
-  filler.fill(rules_filename, fill_area);
+  filler.fill(rules_filename, fill_area, num_threads, tile_size_microns_);
 }
 
 }  // namespace fin
@@ -18,12 +18,20 @@ set_density_fill_debug_cmd()
   finale->setDebug();
 }
 
+void
+set_density_fill_tile_size_cmd(int microns)
+{
+  auto *finale = ord::OpenRoad::openRoad()->getFinale();
+  finale->setTileSize(microns);
+}
+
 void
 density_fill_cmd(const char* rules_filename,
                  const odb::Rect& fill_area)
 {
   auto *finale = ord::OpenRoad::openRoad()->getFinale();
-  finale->densityFill(rules_filename, fill_area);
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  finale->densityFill(rules_filename, fill_area, num_threads);
 }
 
 %} // inline
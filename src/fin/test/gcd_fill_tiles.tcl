@@ -0,0 +1,43 @@
+# Fills gcd in tiles much smaller than the design so that the tile
+# margins, the non-fill halo and the threaded fill are exercised, and
+# expects the same fills from one and several threads.  A tile larger
+# than the design reproduces the untiled fill.
+source helpers.tcl
+set test_name gcd_fill_tiles
+
+read_lef sky130hd/sky130hd.tlef
+read_lef sky130hd/sky130_fd_sc_hd_merged.lef
+read_def gcd_prefill.def
+
+proc remove_fills { } {
+  foreach fill [[ord::get_db_block] getFills] {
+    odb::dbFill_destroy $fill
+  }
+}
+
+proc fill_and_write { tile_size threads file_name } {
+  fin::set_density_fill_tile_size_cmd $tile_size
+  set_thread_count $threads
+  density_fill -rules fill.json
+  set fill_count [llength [[ord::get_db_block] getFills]]
+  if { $fill_count == 0 } {
+    error "No fills with $tile_size um tiles and $threads threads"
+  }
+  set def_file [make_result_file $file_name]
+  write_def $def_file
+  remove_fills
+  return $def_file
+}
+
+set def_file [fill_and_write 1000 4 ${test_name}_untiled.def]
+if { [diff_files $def_file gcd_fill.defok] } {
+  error "Untiled fill with 4 threads differs from gcd_fill.defok"
+}
+
+set serial_def [fill_and_write 50 1 ${test_name}_1.def]
+set parallel_def [fill_and_write 50 4 ${test_name}_4.def]
+if { [diff_files $serial_def $parallel_def] } {
+  error "Tiled fill differs between 1 and 4 threads"
+}
+
+puts pass
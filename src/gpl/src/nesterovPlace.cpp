@@ -24,6 +24,7 @@
 #include "routeBase.h"
 #include "timingBase.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 
 namespace gpl {
 using utl::GPL;
@@ -1239,6 +1240,7 @@ void NesterovPlace::updateNextIter(int iter)
 
   average_overflow_ = total_sum_overflow_ / nbVec_.size();
   average_overflow_unscaled_ = total_sum_overflow_unscaled_ / nbVec_.size();
+  utl::traceCounter("gpl_overflow", average_overflow_unscaled_);
 
   // For coefficient, using average regions' overflow
   updateWireLengthCoef(average_overflow_);
@@ -29,6 +29,7 @@
 #include "sta/StaState.hh"
 #include "timingBase.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/timer.h"
 #include "utl/validation.h"
 
@@ -137,6 +138,7 @@ void Replace::checkPlaceIosSupported(const PlaceOptions& options)
 
 void Replace::doIncrementalPlace(const int threads, const PlaceOptions& options)
 {
+  utl::TraceScope trace("gpl::incrementalPlace");
   checkHasCoreRows();
   log_->info(GPL, 83, "Execute incremental mode global placement.");
   int placed_cnt = 0;
@@ -229,6 +231,7 @@ void Replace::doPlace(const int threads, const PlaceOptions& options)
 
 void Replace::doInitialPlace(const int threads, const PlaceOptions& options)
 {
+  utl::TraceScope trace("gpl::initialPlace");
   checkHasCoreRows();
   checkPlaceIosSupported(options);
   if (pbc_ == nullptr) {
@@ -392,6 +395,7 @@ int Replace::doNesterovPlace(const int threads,
                              const PlaceOptions& options,
                              const int start_iter)
 {
+  utl::TraceScope trace("gpl::nesterovPlace");
   checkHasCoreRows();
   checkPlaceIosSupported(options);
 
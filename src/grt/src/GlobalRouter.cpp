@@ -61,6 +61,7 @@
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
 #include "utl/ServiceRegistry.h"
+#include "utl/Trace.h"
 #include "utl/algorithms.h"
 #include "utl/timer.h"
 
@@ -488,6 +489,7 @@ void GlobalRouter::reportIncrementalCongestion()
 
 void GlobalRouter::globalRoute(bool save_guides)
 {
+  utl::TraceScope trace("grt::globalRoute");
   utl::Timer timer;
   bool has_routable_nets = false;
 
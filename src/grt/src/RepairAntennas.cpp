@@ -87,6 +87,13 @@ bool RepairAntennas::checkAntennaViolations(
     odb::dbNet* db_net = nets_to_repair[i];
     checkNetViolations(db_net, diode_mterm, ratio_margin);
   }
+  debugPrint(logger_,
+             GRT,
+             "repair_antennas",
+             1,
+             "antenna check cache: {} hits, {} misses",
+             arc_->getNetCacheHits(),
+             arc_->getNetCacheMisses());
 
   if (destroy_wires) {
     destroyNetWires(nets_to_repair);
@@ -24,6 +24,7 @@
 #include "odb/geom.h"
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/timer.h"
 
 namespace grt {
@@ -2257,6 +2258,7 @@ NetRouteMap FastRouteCore::run()
 
       int last_cong = past_cong;
       past_cong = getOverflow2Dmaze(&maxOverflow, &tUsage);
+      utl::traceCounter("grt_overflow", past_cong);
 
       if (minofl > past_cong) {
         minofl = past_cong;
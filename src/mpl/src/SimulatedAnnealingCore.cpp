@@ -121,6 +121,24 @@ template <class T>
 void SimulatedAnnealingCore<T>::setNets(const BundledNetList& nets)
 {
   nets_ = nets;
+
+  nets_weight_sum_ = 0.0;
+  for (const auto& net : nets_) {
+    nets_weight_sum_ += net.weight;
+  }
+
+  macro_to_nets_.assign(macros_.size(), {});
+  for (int net_index = 0; net_index < nets_.size(); net_index++) {
+    const auto& [source, target] = nets_[net_index].terminals;
+    macro_to_nets_[source].push_back(net_index);
+    if (target != source) {
+      macro_to_nets_[target].push_back(net_index);
+    }
+  }
+
+  net_wirelengths_.clear();
+  pin_locations_.clear();
+  macro_bboxes_.clear();
 }
 
 template <class T>
@@ -274,7 +292,16 @@ void SimulatedAnnealingCore<T>::calWirelength()
     return;
   }
 
-  wirelength_ = computeNetsWireLength(nets_);
+  float nets_wire_length = 0.0;
+  if (nets_weight_sum_ != 0.0) {
+    updateNetWirelengths();
+    for (const float net_wire_length : net_wirelengths_) {
+      nets_wire_length += net_wire_length;
+    }
+    nets_wire_length = nets_wire_length / nets_weight_sum_
+                       / (outline_.dx() + outline_.dy());
+  }
+  wirelength_ = nets_wire_length;
 
   if (graphics_) {
     graphics_->setWirelengthPenalty({.name = "Wire Length",
@@ -284,41 +311,64 @@ void SimulatedAnnealingCore<T>::calWirelength()
   }
 }
 
+// A perturbation usually moves or resizes only part of the macros, so only
+// the nets of macros whose pin or bbox changed since the previous call are
+// recomputed.  The bbox is compared too because the cost of a net to a
+// cluster of unplaced IO pins depends on the macro lying in the outline.
+// This also covers restored states as the restored macros differ from the
+// ones seen last.
 template <class T>
-float SimulatedAnnealingCore<T>::computeNetsWireLength(
-    const BundledNetList& nets) const
+void SimulatedAnnealingCore<T>::updateNetWirelengths()
 {
-  float nets_wire_length = 0.0;
-  float nets_weight_sum = 0.0;
+  if (pin_locations_.empty()) {
+    pin_locations_.reserve(macros_.size());
+    macro_bboxes_.reserve(macros_.size());
+    for (const T& macro : macros_) {
+      pin_locations_.emplace_back(macro.getPinX(), macro.getPinY());
+      macro_bboxes_.push_back(macro.getBBox());
+    }
 
-  for (const auto& net : nets_) {
-    nets_weight_sum += net.weight;
+    net_wirelengths_.reserve(nets_.size());
+    for (const auto& net : nets_) {
+      net_wirelengths_.push_back(computeNetWireLength(net));
+    }
+    return;
   }
 
-  if (nets_weight_sum != 0.0) {
-    for (const auto& net : nets) {
-      const T& source = macros_[net.terminals.first];
-      const T& target = macros_[net.terminals.second];
-
-      if (target.isClusterOfUnplacedIOPins()) {
-        nets_wire_length
-            += computeWLForClusterOfUnplacedIOPins(source, target, net.weight);
-      } else {
-        const int x1 = source.getPinX();
-        const int y1 = source.getPinY();
-        const int x2 = target.getPinX();
-        const int y2 = target.getPinY();
+  for (int macro_id = 0; macro_id < macros_.size(); macro_id++) {
+    const T& macro = macros_[macro_id];
+    const odb::Point pin_location(macro.getPinX(), macro.getPinY());
+    const odb::Rect bbox = macro.getBBox();
+    if (pin_location == pin_locations_[macro_id]
+        && bbox == macro_bboxes_[macro_id]) {
+      continue;
+    }
 
-        nets_wire_length
-            += net.weight * (std::abs(x2 - x1) + std::abs(y2 - y1));
-      }
+    pin_locations_[macro_id] = pin_location;
+    macro_bboxes_[macro_id] = bbox;
+    for (const int net_index : macro_to_nets_[macro_id]) {
+      net_wirelengths_[net_index] = computeNetWireLength(nets_[net_index]);
     }
+  }
+}
+
+template <class T>
+float SimulatedAnnealingCore<T>::computeNetWireLength(
+    const BundledNet& net) const
+{
+  const T& source = macros_[net.terminals.first];
+  const T& target = macros_[net.terminals.second];
 
-    nets_wire_length
-        = nets_wire_length / nets_weight_sum / (outline_.dx() + outline_.dy());
+  if (target.isClusterOfUnplacedIOPins()) {
+    return computeWLForClusterOfUnplacedIOPins(source, target, net.weight);
   }
 
-  return nets_wire_length;
+  const int x1 = source.getPinX();
+  const int y1 = source.getPinY();
+  const int x2 = target.getPinX();
+  const int y2 = target.getPinY();
+
+  return net.weight * (std::abs(x2 - x1) + std::abs(y2 - y1));
 }
 
 template <class T>
@@ -448,75 +498,63 @@ void SimulatedAnnealingCore<T>::calGuidancePenalty()
 template <class T>
 void SimulatedAnnealingCore<T>::packFloorplan()
 {
-  // Each index corresponds to a macro id whose pair is:
-  // <Position in Positive Sequence , Position in Negative Sequence>
-  std::vector<std::pair<int, int>> sequence_pair_pos(pos_seq_.size());
-
-  // calculate X position
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    sequence_pair_pos[pos_seq_[i]].first = i;
-    sequence_pair_pos[neg_seq_[i]].second = i;
+  // The buffers are kept across calls as packing runs once per
+  // perturbation.
+  const int num_macros = static_cast<int>(pos_seq_.size());
+  neg_seq_positions_.resize(macros_.size());
+  for (int i = 0; i < num_macros; i++) {
+    neg_seq_positions_[neg_seq_[i]] = i;
   }
 
-  std::vector<int> accumulated_length(pos_seq_.size(), 0);
+  // calculate X position
+  accumulated_length_.assign(num_macros, 0);
   for (int macro_id : pos_seq_) {
-    const int neg_seq_pos = sequence_pair_pos[macro_id].second;
+    const int neg_seq_pos = neg_seq_positions_[macro_id];
 
     T& macro = macros_[macro_id];
 
     if (!macro.isFixed()) {
-      macro.setX(accumulated_length[neg_seq_pos]);
+      macro.setX(accumulated_length_[neg_seq_pos]);
     }
 
     const int current_length = macro.getX() + macro.getWidth();
 
-    for (int j = neg_seq_pos; j < neg_seq_.size(); j++) {
-      if (current_length > accumulated_length[j]) {
-        accumulated_length[j] = current_length;
+    for (int j = neg_seq_pos; j < num_macros; j++) {
+      if (current_length > accumulated_length_[j]) {
+        accumulated_length_[j] = current_length;
       } else {
         break;
       }
     }
   }
 
-  width_ = accumulated_length[pos_seq_.size() - 1];
+  width_ = accumulated_length_[num_macros - 1];
 
-  // calulate Y position
-  std::vector<int> reversed_pos_seq(pos_seq_.size());
-  for (int i = 0; i < reversed_pos_seq.size(); i++) {
-    reversed_pos_seq[i] = pos_seq_[reversed_pos_seq.size() - 1 - i];
-  }
-
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    sequence_pair_pos[reversed_pos_seq[i]].first = i;
-    sequence_pair_pos[neg_seq_[i]].second = i;
-
-    // This is actually the accumulated height, but we use the same vector
-    // to avoid more allocation.
-    accumulated_length[i] = 0;
-  }
-
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    const int macro_id = reversed_pos_seq[i];
-    const int neg_seq_pos = sequence_pair_pos[macro_id].second;
+  // calulate Y position walking the positive sequence backwards.
+  // This is actually the accumulated height, but we use the same vector
+  // to avoid more allocation.
+  std::ranges::fill(accumulated_length_, 0);
+  for (int i = num_macros - 1; i >= 0; i--) {
+    const int macro_id = pos_seq_[i];
+    const int neg_seq_pos = neg_seq_positions_[macro_id];
     T& macro = macros_[macro_id];
 
     if (!macro.isFixed()) {
-      macro.setY(accumulated_length[neg_seq_pos]);
+      macro.setY(accumulated_length_[neg_seq_pos]);
     }
 
     const int current_height = macro.getY() + macro.getHeight();
 
-    for (int j = neg_seq_pos; j < neg_seq_.size(); j++) {
-      if (current_height > accumulated_length[j]) {
-        accumulated_length[j] = current_height;
+    for (int j = neg_seq_pos; j < num_macros; j++) {
+      if (current_height > accumulated_length_[j]) {
+        accumulated_length_[j] = current_height;
       } else {
         break;
       }
     }
   }
 
-  height_ = accumulated_length[pos_seq_.size() - 1];
+  height_ = accumulated_length_[num_macros - 1];
 
   if (graphics_) {
     graphics_->saStep(macros_);
@@ -40,6 +40,8 @@ class Graphics;
 template <class T>
 class SimulatedAnnealingCore
 {
+  friend class SACoreTestPeer;
+
  public:
   SimulatedAnnealingCore(PhysicalHierarchy* tree,
                          const odb::Rect& outline,
@@ -118,7 +120,8 @@ class SimulatedAnnealingCore
   virtual void calPenalty() = 0;
   void calOutlinePenalty();
   void calWirelength();
-  float computeNetsWireLength(const BundledNetList& nets) const;
+  void updateNetWirelengths();
+  float computeNetWireLength(const BundledNet& net) const;
   int64_t computeWLForClusterOfUnplacedIOPins(const T& macro,
                                               const T& unplaced_ios,
                                               float net_weight) const;
@@ -155,6 +158,13 @@ class SimulatedAnnealingCore
   int number_of_sequence_pair_macros_ = 0;
 
   BundledNetList nets_;
+  float nets_weight_sum_ = 0.0;
+  // Incremental wirelength state: the nets of each macro, the weighted
+  // length of each net and the macro pins and bboxes it was computed with.
+  std::vector<std::vector<int>> macro_to_nets_;
+  std::vector<float> net_wirelengths_;
+  std::vector<odb::Point> pin_locations_;
+  std::vector<odb::Rect> macro_bboxes_;
   std::map<int, odb::Rect> fences_;  // Macro Id -> Fence
   std::map<int, odb::Rect> guides_;  // Macro Id -> Guide
 
@@ -180,6 +190,10 @@ class SimulatedAnnealingCore
   std::vector<int> pre_neg_seq_;
   std::vector<T> pre_macros_;  // here the macros can be HardMacro or SoftMacro
   int macro_id_ = -1;          // the macro changed in the perturb
+
+  // packFloorplan buffers
+  std::vector<int> neg_seq_positions_;
+  std::vector<int> accumulated_length_;
   int action_id_ = -1;         // the action_id of current step
 
   // metrics
@@ -346,7 +346,7 @@ void ClusteringEngine::createRoot()
 
   // Associate all instances to root
   for (odb::dbInst* inst : block_->getInsts()) {
-    tree_->maps.inst_to_cluster_id[inst] = id_;
+    setInstClusterId(inst, id_);
   }
 }
 
@@ -452,13 +452,12 @@ void ClusteringEngine::createIOClusters()
   for (odb::dbBTerm* bterm : block_->getBTerms()) {
     if (bterm->getFirstPinPlacementStatus().isFixed()) {
       const int io_bundle_id = findAssociatedBundledIOId(bterm);
-      tree_->maps.bterm_to_cluster_id[bterm] = io_bundle_id;
+      setBTermClusterId(bterm, io_bundle_id);
       is_empty_io_bundle.at(io_bundle_id) = false;
     } else {
       Cluster* same_constraint_cluster = findIOClusterWithSameConstraint(bterm);
       if (same_constraint_cluster) {
-        tree_->maps.bterm_to_cluster_id[bterm]
-            = same_constraint_cluster->getId();
+        setBTermClusterId(bterm, same_constraint_cluster->getId());
       } else {
         createClusterOfUnplacedIOs(bterm);
       }
@@ -636,7 +635,7 @@ void ClusteringEngine::createClusterOfUnplacedIOs(odb::dbBTerm* bterm)
       constraint_shape.dy(),
       is_cluster_of_unconstrained_io_pins);
 
-  tree_->maps.bterm_to_cluster_id[bterm] = id_;
+  setBTermClusterId(bterm, id_);
   tree_->maps.id_to_cluster[id_++] = cluster.get();
   tree_->root->addChild(std::move(cluster));
 }
@@ -651,7 +650,7 @@ void ClusteringEngine::createIOPadClusters()
 void ClusteringEngine::createIOPadCluster(odb::dbInst* pad)
 {
   auto cluster = std::make_unique<Cluster>(id_, pad->getName(), logger_);
-  tree_->maps.inst_to_cluster_id[pad] = id_;
+  setInstClusterId(pad, id_);
   tree_->maps.id_to_cluster[id_++] = cluster.get();
 
   const odb::Rect& pad_bbox = pad->getBBox()->getBox();
@@ -684,14 +683,6 @@ bool ClusteringEngine::isIgnoredInst(odb::dbInst* inst)
   return master->isPad() || master->isCover() || master->isEndCap();
 }
 
-void ClusteringEngine::connect(Cluster* a,
-                               Cluster* b,
-                               const float connection_weight) const
-{
-  a->addConnection(b, connection_weight);
-  b->addConnection(a, connection_weight);
-}
-
 void ClusteringEngine::treatEachMacroAsSingleCluster()
 {
   odb::dbModule* module = block_->getTopModule();
@@ -752,7 +743,7 @@ void ClusteringEngine::updateInstancesAssociation(Cluster* cluster)
         continue;
       }
 
-      tree_->maps.inst_to_cluster_id[inst] = cluster_id;
+      setInstClusterId(inst, cluster_id);
     }
   }
 
@@ -762,7 +753,7 @@ void ClusteringEngine::updateInstancesAssociation(Cluster* cluster)
         continue;
       }
 
-      tree_->maps.inst_to_cluster_id[inst] = cluster_id;
+      setInstClusterId(inst, cluster_id);
     }
   }
 
@@ -793,7 +784,7 @@ void ClusteringEngine::updateInstancesAssociation(odb::dbModule* module,
       continue;
     }
 
-    tree_->maps.inst_to_cluster_id[inst] = cluster_id;
+    setInstClusterId(inst, cluster_id);
   }
 
   for (odb::dbModInst* child_module_inst : module->getChildren()) {
@@ -1312,8 +1303,7 @@ void ClusteringEngine::mergeChildrenBelowThresholds(
 
   int num_small_children = static_cast<int>(small_children.size());
   while (true) {
-    clearConnections();
-    buildNetListConnections();
+    rebuildConnections();
 
     std::vector<int> cluster_class(num_small_children, -1);  // merge flag
     std::vector<int> small_children_ids;                     // store cluster id
@@ -1594,75 +1584,171 @@ bool ClusteringEngine::attemptMerge(Cluster* receiver, Cluster* incomer)
   return false;
 }
 
+// Only nets with an instance or bterm that changed cluster since the last
+// call are re-evaluated; the cluster connection maps are then refreshed
+// from the maintained counts.
 void ClusteringEngine::rebuildConnections()
 {
-  clearConnections();
-  buildNetListConnections();
-}
+  if (!nets_cached_) {
+    cacheNets();
+  }
+
+  for (const int net_index : dirty_nets_) {
+    NetPins& net = nets_[net_index];
+    updateConnectionCounts(net.clusters, -1);
+    net.clusters = buildNet(net);
+    updateConnectionCounts(net.clusters, 1);
+    net_is_dirty_[net_index] = false;
+  }
+  dirty_nets_.clear();
 
-void ClusteringEngine::clearConnections()
-{
   for (auto& [cluster_id, cluster] : tree_->maps.id_to_cluster) {
     cluster->initConnection();
+
+    auto counts = connection_counts_.find(cluster_id);
+    if (counts == connection_counts_.end()) {
+      continue;
+    }
+
+    for (const auto& [other_cluster_id, count] : counts->second) {
+      cluster->addConnection(tree_->maps.id_to_cluster.at(other_cluster_id),
+                             static_cast<float>(count));
+    }
   }
 }
 
-void ClusteringEngine::buildNetListConnections()
+void ClusteringEngine::setInstClusterId(odb::dbInst* inst,
+                                        const int cluster_id)
 {
-  for (odb::dbNet* db_net : block_->getNets()) {
-    if (!isValidNet(db_net)) {
-      continue;
+  int& current_id = tree_->maps.inst_to_cluster_id[inst];
+  if (current_id == cluster_id) {
+    return;
+  }
+  current_id = cluster_id;
+
+  if (nets_cached_) {
+    for (odb::dbITerm* iterm : inst->getITerms()) {
+      markNetDirty(iterm->getNet());
     }
+  }
+}
 
-    Net net = buildNet(db_net);
-    connectClusters(net);
+void ClusteringEngine::setBTermClusterId(odb::dbBTerm* bterm,
+                                         const int cluster_id)
+{
+  int& current_id = tree_->maps.bterm_to_cluster_id[bterm];
+  if (current_id == cluster_id) {
+    return;
+  }
+  current_id = cluster_id;
+
+  if (nets_cached_) {
+    markNetDirty(bterm->getNet());
   }
 }
 
-ClusteringEngine::Net ClusteringEngine::buildNet(odb::dbNet* db_net) const
+void ClusteringEngine::markNetDirty(odb::dbNet* db_net)
 {
-  Net net;
+  if (db_net == nullptr) {
+    return;
+  }
 
-  for (odb::dbITerm* iterm : db_net->getITerms()) {
-    odb::dbInst* inst = iterm->getInst();
-    const int cluster_id = tree_->maps.inst_to_cluster_id.at(inst);
+  auto itr = net_index_.find(db_net);
+  if (itr == net_index_.end()) {
+    return;
+  }
 
-    if (iterm->getIoType() == odb::dbIoType::OUTPUT) {
-      net.driver_id = cluster_id;
-    } else {
-      net.loads_ids.push_back(cluster_id);
-    }
+  const int net_index = itr->second;
+  if (!net_is_dirty_[net_index]) {
+    net_is_dirty_[net_index] = true;
+    dirty_nets_.push_back(net_index);
   }
+}
 
-  if (tree_->io_pads.empty()) {
-    for (odb::dbBTerm* bterm : db_net->getBTerms()) {
-      const int cluster_id = tree_->maps.bterm_to_cluster_id.at(bterm);
+void ClusteringEngine::cacheNets()
+{
+  for (odb::dbNet* db_net : block_->getNets()) {
+    if (!isValidNet(db_net)) {
+      continue;
+    }
 
-      if (bterm->getIoType() == odb::dbIoType::INPUT) {
-        net.driver_id = cluster_id;
+    NetPins net;
+    for (odb::dbITerm* iterm : db_net->getITerms()) {
+      if (iterm->getIoType() == odb::dbIoType::OUTPUT) {
+        net.driver_inst = iterm->getInst();
       } else {
-        net.loads_ids.push_back(cluster_id);
+        net.load_insts.push_back(iterm->getInst());
       }
     }
+
+    if (tree_->io_pads.empty()) {
+      for (odb::dbBTerm* bterm : db_net->getBTerms()) {
+        if (bterm->getIoType() == odb::dbIoType::INPUT) {
+          net.driver_bterm = bterm;
+        } else {
+          net.load_bterms.push_back(bterm);
+        }
+      }
+    }
+
+    const int net_index = static_cast<int>(nets_.size());
+    net_index_[db_net] = net_index;
+    nets_.push_back(std::move(net));
+    net_is_dirty_.push_back(true);
+    dirty_nets_.push_back(net_index);
   }
 
-  return net;
+  nets_cached_ = true;
 }
 
-void ClusteringEngine::connectClusters(const Net& net)
+ClusteringEngine::Net ClusteringEngine::buildNet(const NetPins& net) const
+{
+  Net clusters;
+
+  // A bterm driver takes precedence over an instance driver.
+  if (net.driver_bterm != nullptr) {
+    clusters.driver_id = tree_->maps.bterm_to_cluster_id.at(net.driver_bterm);
+  } else if (net.driver_inst != nullptr) {
+    clusters.driver_id = tree_->maps.inst_to_cluster_id.at(net.driver_inst);
+  }
+
+  clusters.loads_ids.reserve(net.load_insts.size() + net.load_bterms.size());
+  for (odb::dbInst* inst : net.load_insts) {
+    clusters.loads_ids.push_back(tree_->maps.inst_to_cluster_id.at(inst));
+  }
+  for (odb::dbBTerm* bterm : net.load_bterms) {
+    clusters.loads_ids.push_back(tree_->maps.bterm_to_cluster_id.at(bterm));
+  }
+
+  return clusters;
+}
+
+void ClusteringEngine::updateConnectionCounts(const Net& net, const int delta)
 {
   if (net.driver_id == -1 || net.loads_ids.empty()
       || net.loads_ids.size() >= tree_->large_net_threshold) {
     return;
   }
 
-  const float connection_weight = 1.0;
-  Cluster* driver = tree_->maps.id_to_cluster.at(net.driver_id);
-
   for (const int load_cluster_id : net.loads_ids) {
     if (load_cluster_id != net.driver_id) {
-      Cluster* load = tree_->maps.id_to_cluster.at(load_cluster_id);
-      connect(driver, load, connection_weight);
+      addConnectionCount(net.driver_id, load_cluster_id, delta);
+      addConnectionCount(load_cluster_id, net.driver_id, delta);
+    }
+  }
+}
+
+void ClusteringEngine::addConnectionCount(const int a,
+                                          const int b,
+                                          const int delta)
+{
+  std::map<int, int>& counts = connection_counts_[a];
+  int& count = counts[b];
+  count += delta;
+  if (count == 0) {
+    counts.erase(b);
+    if (counts.empty()) {
+      connection_counts_.erase(a);
     }
   }
 }
@@ -1739,8 +1825,7 @@ void ClusteringEngine::breakMixedLeaf(Cluster* mixed_leaf)
   std::vector<Cluster*> macro_clusters;
   createOneClusterForEachMacro(parent, hard_macros, macro_clusters);
 
-  clearConnections();
-  buildNetListConnections();
+  rebuildConnections();
 
   std::vector<HardMacro*> movable_hard_macros;
   std::vector<Cluster*> movable_macro_clusters;
@@ -43,11 +43,16 @@ using PathInsts = std::vector<std::set<odb::dbInst*>>;
 struct PhysicalHierarchyMaps
 {
   std::map<int, Cluster*> id_to_cluster;
-  std::unordered_map<odb::dbInst*, int> inst_to_cluster_id;
-  std::unordered_map<odb::dbBTerm*, int> bterm_to_cluster_id;
 
   InstToHardMap inst_to_hard;
   ModuleToMetricsMap module_to_metrics;
+
+ private:
+  // Only written through ClusteringEngine::setInstClusterId and
+  // setBTermClusterId, which keep the cached net connections in sync.
+  friend class ClusteringEngine;
+  std::unordered_map<odb::dbInst*, int> inst_to_cluster_id;
+  std::unordered_map<odb::dbBTerm*, int> bterm_to_cluster_id;
 };
 
 struct PhysicalHierarchy
@@ -139,6 +144,18 @@ class ClusteringEngine
     std::vector<int> loads_ids;
   };
 
+  // A valid net reduced to the instances and bterms whose clusters it
+  // connects.  The clusters it was counted with at the last rebuild are
+  // kept so that the rebuild only revisits nets of re-clustered objects.
+  struct NetPins
+  {
+    odb::dbInst* driver_inst{nullptr};
+    odb::dbBTerm* driver_bterm{nullptr};
+    std::vector<odb::dbInst*> load_insts;
+    std::vector<odb::dbBTerm*> load_bterms;
+    Net clusters;
+  };
+
   void init();
   Metrics* computeModuleMetrics(odb::dbModule* module);
   std::vector<odb::dbInst*> getUnfixedMacros();
@@ -217,11 +234,13 @@ class ClusteringEngine
   void replaceByStdCellCluster(Cluster* mixed_leaf,
                                std::vector<int>& virtual_conn_clusters);
 
-  void clearConnections();
-  void buildNetListConnections();
-  Net buildNet(odb::dbNet* db_net) const;
-  void connectClusters(const Net& net);
-  void connect(Cluster* a, Cluster* b, float connection_weight) const;
+  void setInstClusterId(odb::dbInst* inst, int cluster_id);
+  void setBTermClusterId(odb::dbBTerm* bterm, int cluster_id);
+  void markNetDirty(odb::dbNet* db_net);
+  void cacheNets();
+  Net buildNet(const NetPins& net) const;
+  void updateConnectionCounts(const Net& net, int delta);
+  void addConnectionCount(int a, int b, int delta);
 
   void printPhysicalHierarchyTree(Cluster* parent, int level);
   int64_t computeArea(odb::dbInst* inst);
@@ -259,6 +278,17 @@ class ClusteringEngine
   int first_io_bundle_id_{-1};
   IOBundleSpans io_bundle_spans_;
 
+  // Netlist connectivity maintained across rebuildConnections() calls.
+  // The netlist itself does not change while clustering, only the
+  // cluster each instance or bterm belongs to.
+  bool nets_cached_{false};
+  std::vector<NetPins> nets_;
+  std::unordered_map<odb::dbNet*, int> net_index_;
+  std::vector<int> dirty_nets_;
+  std::vector<bool> net_is_dirty_;
+  // cluster id -> connected cluster id -> number of connections
+  std::unordered_map<int, std::map<int, int>> connection_counts_;
+
   std::unordered_set<odb::dbInst*> ignorable_macros_;
 
   HardMacro::Halo base_halo_;
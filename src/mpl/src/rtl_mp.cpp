@@ -14,6 +14,7 @@
 #include "odb/geom.h"
 #include "snapper.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/timer.h"
 
 namespace mpl {
@@ -58,6 +59,7 @@ bool MacroPlacer::place(const int num_threads,
                         const bool keep_clustering_data,
                         const bool use_full_halo)
 {
+  utl::TraceScope trace("mpl::place");
   utl::Timer timer;
   hier_rtlmp_->init();
   hier_rtlmp_->setClusterSize(
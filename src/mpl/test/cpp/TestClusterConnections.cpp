@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../src/clusterEngine.h"
+#include "../../src/object.h"
+#include "MplTest.h"
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/dbTypes.h"
+
+namespace mpl {
+namespace {
+
+using ConnectionSnapshot = std::map<int, ConnectionsMap>;
+
+class TestClusterConnections : public MplTest
+{
+ protected:
+  void SetUp() override
+  {
+    MplTest::SetUp();
+
+    odb::dbLib* lib = db_->findLib("lib");
+    odb::dbMaster* master = odb::dbMaster::create(lib, "cell");
+    master->setType(odb::dbMasterType::CORE);
+    master->setWidth(1000);
+    master->setHeight(1000);
+    odb::dbMTerm::create(master, "A", odb::dbIoType::INPUT);
+    odb::dbMTerm::create(master, "B", odb::dbIoType::INPUT);
+    odb::dbMTerm::create(master, "Z", odb::dbIoType::OUTPUT);
+    master->setFrozen();
+
+    for (int i = 0; i < kNumInsts; i++) {
+      const std::string name = "i" + std::to_string(i);
+      insts_.push_back(odb::dbInst::create(block(), master, name.c_str()));
+    }
+    // Each instance drives one net with two loads spread over the design.
+    for (int i = 0; i < kNumInsts; i++) {
+      odb::dbNet* net
+          = odb::dbNet::create(block(), ("n" + std::to_string(i)).c_str());
+      insts_[i]->findITerm("Z")->connect(net);
+      insts_[(i + 1) % kNumInsts]->findITerm("A")->connect(net);
+      insts_[(i * 7 + 3) % kNumInsts]->findITerm("B")->connect(net);
+    }
+
+    tree_.large_net_threshold = 100;
+    for (int id = 0; id < kNumClusters; id++) {
+      auto cluster = std::make_unique<Cluster>(
+          id, "cluster" + std::to_string(id), &logger_);
+      cluster->setClusterType(StdCellCluster);
+      tree_.maps.id_to_cluster[id] = cluster.get();
+      clusters_.push_back(std::move(cluster));
+    }
+
+    engine_ = std::make_unique<ClusteringEngine>(
+        block(), &logger_, nullptr, nullptr);
+    engine_->setTree(&tree_);
+    for (int i = 0; i < kNumInsts; i++) {
+      moveInst(i, i % kNumClusters);
+    }
+  }
+
+  odb::dbBlock* block() { return db_->getChip()->getBlock(); }
+
+  void moveInst(const int inst, const int cluster_id)
+  {
+    Cluster* cluster = clusters_[cluster_id].get();
+    cluster->addLeafStdCell(insts_[inst]);
+    engine_->updateInstancesAssociation(cluster);
+  }
+
+  static ConnectionSnapshot snapshot(const PhysicalHierarchy& tree)
+  {
+    ConnectionSnapshot connections;
+    for (const auto& [id, cluster] : tree.maps.id_to_cluster) {
+      connections[id] = cluster->getConnectionsMap();
+    }
+    return connections;
+  }
+
+  // Rebuilds the connections with the long-lived engine, which only
+  // revisits the nets of moved instances, and with a new engine, which
+  // walks the whole netlist, and expects the same weights.
+  void expectIncrementalMatchesFull()
+  {
+    engine_->rebuildConnections();
+    const ConnectionSnapshot incremental = snapshot(tree_);
+
+    ClusteringEngine full_engine(block(), &logger_, nullptr, nullptr);
+    full_engine.setTree(&tree_);
+    full_engine.rebuildConnections();
+    const ConnectionSnapshot full = snapshot(tree_);
+
+    EXPECT_EQ(incremental, full);
+  }
+
+  static constexpr int kNumInsts = 40;
+  static constexpr int kNumClusters = 5;
+
+  PhysicalHierarchy tree_;
+  std::vector<odb::dbInst*> insts_;
+  std::vector<std::unique_ptr<Cluster>> clusters_;
+  std::unique_ptr<ClusteringEngine> engine_;
+};
+
+TEST_F(TestClusterConnections, InitialBuild)
+{
+  expectIncrementalMatchesFull();
+  EXPECT_FALSE(clusters_[0]->getConnectionsMap().empty());
+}
+
+TEST_F(TestClusterConnections, MovedInstances)
+{
+  expectIncrementalMatchesFull();
+
+  for (int round = 1; round <= 3; round++) {
+    for (int i = round; i < kNumInsts; i += 3 + round) {
+      moveInst(i, (i + round) % kNumClusters);
+    }
+    expectIncrementalMatchesFull();
+  }
+}
+
+TEST_F(TestClusterConnections, MergedCluster)
+{
+  expectIncrementalMatchesFull();
+
+  // Merge the last cluster into the first one, as a merge round does.
+  const int merged_id = kNumClusters - 1;
+  for (int i = merged_id; i < kNumInsts; i += kNumClusters) {
+    moveInst(i, 0);
+  }
+  tree_.maps.id_to_cluster.erase(merged_id);
+  expectIncrementalMatchesFull();
+  EXPECT_EQ(clusters_[0]->getConnectionsMap().count(merged_id), 0);
+}
+
+}  // namespace
+}  // namespace mpl
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../src/SACoreSoftMacro.h"
+#include "../../src/SimulatedAnnealingCore.h"
+#include "../../src/clusterEngine.h"
+#include "../../src/mpl-util.h"
+#include "../../src/object.h"
+#include "../../src/shapes.h"
+#include "MplTest.h"
+#include "gtest/gtest.h"
+#include "odb/geom.h"
+
+namespace mpl {
+
+// Drives the annealing steps of a core one by one.
+class SACoreTestPeer
+{
+ public:
+  using Core = SimulatedAnnealingCore<SoftMacro>;
+
+  static void start(Core& core)
+  {
+    core.initSequencePair();
+    core.packFloorplan();
+    core.calPenalty();
+  }
+
+  static void perturb(Core& core) { core.perturb(); }
+  static void saveState(Core& core) { core.saveState(); }
+  static void restoreState(Core& core) { core.restoreState(); }
+  static void calWirelength(Core& core) { core.calWirelength(); }
+  static std::vector<SoftMacro>& macros(Core& core) { return core.macros_; }
+
+  // Sums every net from scratch, as calWirelength did before it was made
+  // incremental.
+  static float fullWirelength(const Core& core)
+  {
+    float wirelength = 0.0;
+    for (const BundledNet& net : core.nets_) {
+      wirelength += core.computeNetWireLength(net);
+    }
+    return wirelength / core.nets_weight_sum_
+           / (core.outline_.dx() + core.outline_.dy());
+  }
+};
+
+namespace {
+
+class TestSACoreWirelength : public MplTest
+{
+ protected:
+  void SetUp() override
+  {
+    MplTest::SetUp();
+
+    tree_.die_area = odb::Rect(0, 0, die_width_, die_height_);
+    tree_.available_regions_for_unconstrained_pins.emplace_back(
+        odb::Line(0, 0, 0, die_height_), Boundary::L);
+
+    io_cluster_ = std::make_unique<Cluster>(kNumClusters, "io", &logger_);
+    io_cluster_->setAsClusterOfUnplacedIOPins(
+        {0, 0}, 0, die_height_, /* unconstrained */ true);
+
+    std::vector<SoftMacro> macros;
+    for (int id = 0; id < kNumClusters; id++) {
+      auto cluster = std::make_unique<Cluster>(
+          id, "cluster" + std::to_string(id), &logger_);
+      cluster->setClusterType(StdCellCluster);
+      SoftMacro macro(cluster.get());
+      macro.setShapes({Interval(20000, 80000)}, int64_t{20000} * 80000);
+      macros.push_back(macro);
+      clusters_.push_back(std::move(cluster));
+    }
+    macros.emplace_back(
+        odb::Point(0, 0), "io", 0, die_height_, io_cluster_.get());
+
+    // Every cluster talks to the unplaced IOs and to its neighbor.
+    BundledNetList nets;
+    for (int id = 0; id < kNumClusters; id++) {
+      nets.emplace_back(id, kNumClusters, 1.0f + id);
+      nets.emplace_back(id, (id + 1) % kNumClusters, 2.0f);
+    }
+
+    const SACoreWeights core_weights{
+        .area = 1.0f, .outline = 1.0f, .wirelength = 1.0f};
+    core_ = std::make_unique<SACoreSoftMacro>(&tree_,
+                                              outline_,
+                                              macros,
+                                              core_weights,
+                                              SASoftWeights{},
+                                              0.0f,
+                                              0.0f,
+                                              0.2f,
+                                              0.2f,
+                                              0.2f,
+                                              0.2f,
+                                              0.2f,
+                                              0.9f,
+                                              10,
+                                              10,
+                                              0,
+                                              nullptr,
+                                              &logger_,
+                                              nullptr);
+    core_->setNumberOfSequencePairMacros(kNumClusters);
+    core_->setNets(nets);
+    SACoreTestPeer::start(*core_);
+  }
+
+  static constexpr int kNumClusters = 6;
+
+  // Small enough that some packings spill out of the outline.
+  const odb::Rect outline_{0, 0, 150000, 150000};
+  PhysicalHierarchy tree_;
+  std::unique_ptr<Cluster> io_cluster_;
+  std::vector<std::unique_ptr<Cluster>> clusters_;
+  std::unique_ptr<SACoreSoftMacro> core_;
+};
+
+TEST_F(TestSACoreWirelength, PerturbAndRestore)
+{
+  EXPECT_EQ(core_->getWirelength(), SACoreTestPeer::fullWirelength(*core_));
+
+  for (int step = 0; step < 500; step++) {
+    SACoreTestPeer::saveState(*core_);
+    SACoreTestPeer::perturb(*core_);
+    EXPECT_EQ(core_->getWirelength(), SACoreTestPeer::fullWirelength(*core_))
+        << "step " << step;
+
+    if (step % 3 == 0) {
+      SACoreTestPeer::restoreState(*core_);
+      SACoreTestPeer::calWirelength(*core_);
+      EXPECT_EQ(core_->getWirelength(),
+                SACoreTestPeer::fullWirelength(*core_))
+          << "restored step " << step;
+    }
+  }
+}
+
+TEST_F(TestSACoreWirelength, ResizeInPlace)
+{
+  std::vector<SoftMacro>& macros = SACoreTestPeer::macros(*core_);
+  for (int id = 0; id < kNumClusters; id++) {
+    SoftMacro& macro = macros[id];
+    // Grow by one unit so that the bbox changes but the pin may not.
+    macro.setWidth(macro.getWidth() + 1);
+    SACoreTestPeer::calWirelength(*core_);
+    EXPECT_EQ(core_->getWirelength(), SACoreTestPeer::fullWirelength(*core_))
+        << macro.getName();
+
+    // Stretch it out of the outline.
+    macro.setWidth(80000);
+    macro.setX(outline_.dx() - 1000);
+    SACoreTestPeer::calWirelength(*core_);
+    EXPECT_EQ(core_->getWirelength(), SACoreTestPeer::fullWirelength(*core_))
+        << macro.getName();
+  }
+}
+
+}  // namespace
+}  // namespace mpl
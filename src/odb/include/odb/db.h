@@ -789,6 +789,12 @@ class dbBlock : public dbObject
   ///
   dbInst* findInst(const char* name);
 
+  ///
+  /// Size the instance name table for num_insts instances so bulk creation
+  /// does not repeatedly rehash it.
+  ///
+  void reserveInsts(uint32_t num_insts);
+
   ///
   /// Find a specific module in this block.
   /// Returns nullptr if the object was not found.
@@ -894,6 +900,12 @@ class dbBlock : public dbObject
   ///
   dbNet* findNet(const char* name) const;
 
+  ///
+  /// Size the net name table for num_nets nets so bulk creation does not
+  /// repeatedly rehash it.
+  ///
+  void reserveNets(uint32_t num_nets);
+
   ///
   /// Find a specific mod net of this block.
   /// Returns nullptr if the object was not found.
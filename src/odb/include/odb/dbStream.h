@@ -31,6 +31,15 @@ class _dbDatabase;
 
 inline constexpr size_t kTemplateRecursionLimit = 16;
 
+// Kinds of names written with dbOStream::writeSharedPrefixName.  Each kind
+// is compressed against the previous name of the same kind.
+enum class SharedPrefixName
+{
+  kInst,
+  kNet,
+  kCount
+};
+
 class dbOStream
 {
  public:
@@ -120,6 +129,28 @@ class dbOStream
     return *this;
   }
 
+  // Writes the length of the prefix `name` shares with the previous name of
+  // the same kind followed by the rest of it.  Flattened hierarchical names
+  // written in table order mostly differ only in their last component.
+  void writeSharedPrefixName(const char* name, const SharedPrefixName kind)
+  {
+    if (name == nullptr) {
+      *this << 0u;
+      *this << name;
+      return;
+    }
+    std::string& prev = prev_names_[static_cast<size_t>(kind)];
+    const std::string_view cur(name);
+    uint32_t shared = 0;
+    while (shared < prev.size() && shared < cur.size()
+           && prev[shared] == cur[shared]) {
+      ++shared;
+    }
+    *this << shared;
+    *this << cur.substr(shared);
+    prev.assign(cur);
+  }
+
   template <class T1, class T2>
   dbOStream& operator<<(const std::pair<T1, T2>& p)
   {
@@ -244,6 +275,8 @@ class dbOStream
   double lef_area_factor_;
   double lef_dist_factor_;
   std::vector<Scope> scopes_;
+  std::array<std::string, static_cast<size_t>(SharedPrefixName::kCount)>
+      prev_names_;
   static constexpr size_t kBufferSize = 65536;
   std::array<char, kBufferSize> buffer_;
   size_t buffer_pos_ = 0;
@@ -303,6 +336,25 @@ class dbIStream
     return *this;
   }
 
+  // Reads a name written by dbOStream::writeSharedPrefixName.  Names of one
+  // kind must be read in the order they were written.
+  void readSharedPrefixName(char*& name, const SharedPrefixName kind)
+  {
+    std::string& prev = prev_names_[static_cast<size_t>(kind)];
+    uint32_t shared;
+    *this >> shared;
+    uint32_t len;
+    *this >> len;
+    if (len == 0) {
+      name = nullptr;
+      return;
+    }
+    name = (char*) malloc(shared + len);
+    std::memcpy(name, prev.data(), shared);
+    f_.read(name + shared, len);
+    prev.assign(name, shared + len - 1);
+  }
+
   template <class T1, class T2>
   dbIStream& operator>>(std::pair<T1, T2>& p)
   {
@@ -450,6 +502,8 @@ class dbIStream
   _dbDatabase* db_;
   double lef_area_factor_;
   double lef_dist_factor_;
+  std::array<std::string, static_cast<size_t>(SharedPrefixName::kCount)>
+      prev_names_;
 };
 
 }  // namespace odb
@@ -179,11 +179,24 @@ class dbWireEncoder
   ///
   dbWireEncoder();
 
+  ///
+  /// Encoders can be moved to hand a finished encoding to another owner.
+  ///
+  dbWireEncoder(dbWireEncoder&&) = default;
+  dbWireEncoder& operator=(dbWireEncoder&&) = default;
+
   ///
   /// Begin a new encoding.
   ///
   void begin(dbWire* wire);
 
+  ///
+  /// Begin a new encoding that is not bound to a wire yet. The result is
+  /// applied with end(dbWire*). Nothing in the database is modified until
+  /// then, so nets of one block can be encoded by concurrent encoders.
+  ///
+  void begin(dbBlock* block);
+
   ///
   /// Append to encoding.
   ///
@@ -400,6 +413,12 @@ class dbWireEncoder
   ///
   void end();
 
+  ///
+  /// End an encoding started with begin(dbBlock*) and apply the result to
+  /// the wire.
+  ///
+  void end(dbWire* wire);
+
   ///
   /// Clear the encoder, no changes are applied to current wire. You can call
   /// this to abort an encoding run.
@@ -11,6 +11,8 @@ namespace odb {
 
 class dbBlock;
 
-void orderWires(utl::Logger* logger, dbBlock* b);
+// Rebuilds the wires of the block's signal nets that are not wire ordered
+// yet as connected paths.  Nets are ordered on num_threads threads.
+void orderWires(utl::Logger* logger, dbBlock* b, int num_threads = 1);
 
 }  // namespace odb
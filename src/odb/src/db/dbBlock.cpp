@@ -1955,6 +1955,12 @@ dbInst* dbBlock::findInst(const char* name)
   return (dbInst*) block->inst_hash_.find(name);
 }
 
+void dbBlock::reserveInsts(const uint32_t num_insts)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->inst_hash_.reserve(num_insts);
+}
+
 dbModule* dbBlock::findModule(const char* name)
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -2082,6 +2088,12 @@ dbNet* dbBlock::findNet(const char* name) const
   return (dbNet*) block->net_hash_.find(name);
 }
 
+void dbBlock::reserveNets(const uint32_t num_nets)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->net_hash_.reserve(num_nets);
+}
+
 dbModNet* dbBlock::findModNet(const char* hierarchical_name) const
 {
   if (hierarchical_name == nullptr || hierarchical_name[0] == '\0') {
@@ -74,6 +74,7 @@
 #include "odb/dbObject.h"
 #include "odb/dbStream.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 // User Code End Includes
 namespace odb {
 template class dbTable<_dbDatabase>;
@@ -925,6 +926,7 @@ bool dbDatabase::hasHierarchy() const
 
 void dbDatabase::read(std::istream& file)
 {
+  utl::TraceScope trace("odb::read");
   _dbDatabase* db = (_dbDatabase*) this;
   dbIStream stream(db, file);
   stream >> *db;
@@ -933,6 +935,7 @@ void dbDatabase::read(std::istream& file)
 
 void dbDatabase::write(std::ostream& file)
 {
+  utl::TraceScope trace("odb::write");
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
   stream << *db;
@@ -50,7 +50,10 @@ namespace odb {
 inline constexpr uint32_t kSchemaMajor = 0;  // Not used...
 inline constexpr uint32_t kSchemaInitial = 57;
 
-inline constexpr uint32_t kSchemaMinor = 139;  // Current revision number
+inline constexpr uint32_t kSchemaMinor = 140;  // Current revision number
+
+// Revision where dbInst and dbNet names are stored prefix compressed
+inline constexpr uint32_t kSchemaSharedPrefixNames = 140;
 
 // Revision where dbTech::extraction_rules_file_ was removed
 inline constexpr uint32_t kSchemaRemoveTechExtractionRulesFile = 139;
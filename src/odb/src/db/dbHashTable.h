@@ -30,6 +30,7 @@ class dbHashTable
  public:
   void growTable();
   void shrinkTable();
+  void reserve(uint32_t num_entries);
 
   dbHashTable();
   dbHashTable(const dbHashTable<T, page_size>& table);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "dbCore.h"
 #include "dbHashTable.h"
@@ -23,6 +24,29 @@ inline unsigned int hash_string(const char* str)
   return hash;
 }
 
+// Objects that cache hash_string(name_) in a name_hash_ member are rehashed
+// and compared without walking their names again.
+template <class T>
+inline uint32_t hash_name(const T* object)
+{
+  if constexpr (requires { object->name_hash_; }) {
+    return object->name_hash_;
+  } else {
+    return hash_string(object->name_);
+  }
+}
+
+template <class T>
+inline bool name_equal(const T* object, const char* name, const uint32_t hash)
+{
+  if constexpr (requires { object->name_hash_; }) {
+    if (object->name_hash_ != hash) {
+      return false;
+    }
+  }
+  return strcmp(object->name_, name) == 0;
+}
+
 template <class T, uint32_t page_size>
 dbHashTable<T, page_size>::dbHashTable()
 {
@@ -85,7 +109,7 @@ void dbHashTable<T, page_size>::growTable()
   while (cur != 0) {
     T* entry = obj_tbl_->getPtr(cur);
     dbId<T> next = entry->next_entry_;
-    uint32_t hid = hash_string(entry->name_) & sz;
+    uint32_t hid = hash_name(entry) & sz;
     dbId<T>& e = hash_tbl_[hid];
     entry->next_entry_ = e;
     e = entry->getOID();
@@ -131,7 +155,7 @@ void dbHashTable<T, page_size>::shrinkTable()
   while (cur != 0) {
     T* entry = obj_tbl_->getPtr(cur);
     dbId<T> next = entry->next_entry_;
-    uint32_t hid = hash_string(entry->name_) & sz;
+    uint32_t hid = hash_name(entry) & sz;
     dbId<T>& e = hash_tbl_[hid];
     entry->next_entry_ = e;
     e = entry->getOID();
@@ -139,6 +163,21 @@ void dbHashTable<T, page_size>::shrinkTable()
   }
 }
 
+// Grow the table up front so inserting num_entries objects in total does not
+// rehash the existing entries along the way.
+template <class T, uint32_t page_size>
+void dbHashTable<T, page_size>::reserve(const uint32_t num_entries)
+{
+  if (hash_tbl_.size() == 0) {
+    dbId<T> nullId;
+    hash_tbl_.push_back(nullId);
+  }
+
+  while (num_entries / hash_tbl_.size() > kChainLength) {
+    growTable();
+  }
+}
+
 template <class T, uint32_t page_size>
 void dbHashTable<T, page_size>::insert(T* object)
 {
@@ -158,7 +197,7 @@ void dbHashTable<T, page_size>::insert(T* object)
     }
   }
 
-  uint32_t hid = hash_string(object->name_) & (sz - 1);
+  uint32_t hid = hash_name(object) & (sz - 1);
   dbId<T>& e = hash_tbl_[hid];
   object->next_entry_ = e;
   e = object->getOID();
@@ -173,13 +212,14 @@ T* dbHashTable<T, page_size>::find(const char* name)
     return nullptr;
   }
 
-  uint32_t hid = hash_string(name) & (sz - 1);
+  const uint32_t hash = hash_string(name);
+  uint32_t hid = hash & (sz - 1);
   dbId<T> cur = hash_tbl_[hid];
 
   while (cur != 0) {
     T* entry = obj_tbl_->getPtr(cur);
 
-    if (strcmp(entry->name_, name) == 0) {
+    if (name_equal(entry, name, hash)) {
       return entry;
     }
 
@@ -198,13 +238,14 @@ int dbHashTable<T, page_size>::hasMember(const char* name)
     return false;
   }
 
-  uint32_t hid = hash_string(name) & (sz - 1);
+  const uint32_t hash = hash_string(name);
+  uint32_t hid = hash & (sz - 1);
   dbId<T> cur = hash_tbl_[hid];
 
   while (cur != 0) {
     T* entry = obj_tbl_->getPtr(cur);
 
-    if (strcmp(entry->name_, name) == 0) {
+    if (name_equal(entry, name, hash)) {
       return true;
     }
 
@@ -218,7 +259,7 @@ template <class T, uint32_t page_size>
 void dbHashTable<T, page_size>::remove(T* object)
 {
   uint32_t sz = hash_tbl_.size();
-  uint32_t hid = hash_string(object->name_) & (sz - 1);
+  uint32_t hid = hash_name(object) & (sz - 1);
   dbId<T> cur = hash_tbl_[hid];
   dbId<T> prev;
 
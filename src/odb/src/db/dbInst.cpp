@@ -22,6 +22,7 @@
 #include "dbCore.h"
 #include "dbDatabase.h"
 #include "dbGroup.h"
+#include "dbHashTable.hpp"
 #include "dbHier.h"
 #include "dbITerm.h"
 #include "dbITermItr.h"
@@ -102,6 +103,7 @@ _dbInst::_dbInst(_dbDatabase*)
   flags_.source = dbSourceType::NONE;
   // flags_._spare_bits = 0;
   flags_.level = 0;
+  name_hash_ = 0;
   name_ = nullptr;
   x_ = 0;
   y_ = 0;
@@ -111,6 +113,7 @@ _dbInst::_dbInst(_dbDatabase*)
 
 _dbInst::_dbInst(_dbDatabase*, const _dbInst& i)
     : flags_(i.flags_),
+      name_hash_(i.name_hash_),
       name_(nullptr),
       x_(i.x_),
       y_(i.y_),
@@ -149,7 +152,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbInst& inst)
 {
   uint32_t* bit_field = (uint32_t*) &inst.flags_;
   stream << *bit_field;
-  stream << inst.name_;
+  stream.writeSharedPrefixName(inst.name_, SharedPrefixName::kInst);
   stream << inst.x_;
   stream << inst.y_;
   stream << inst.weight_;
@@ -177,7 +180,12 @@ dbIStream& operator>>(dbIStream& stream, _dbInst& inst)
 {
   uint32_t* bit_field = (uint32_t*) &inst.flags_;
   stream >> *bit_field;
-  stream >> inst.name_;
+  if (inst.getDatabase()->isSchema(kSchemaSharedPrefixNames)) {
+    stream.readSharedPrefixName(inst.name_, SharedPrefixName::kInst);
+  } else {
+    stream >> inst.name_;
+  }
+  inst.name_hash_ = inst.name_ ? hash_string(inst.name_) : 0;
   stream >> inst.x_;
   stream >> inst.y_;
   stream >> inst.weight_;
@@ -382,6 +390,7 @@ bool dbInst::rename(const char* name)
   block->inst_hash_.remove(inst);
   free((void*) inst->name_);
   inst->name_ = safe_strdup(name);
+  inst->name_hash_ = hash_string(inst->name_);
   block->inst_hash_.insert(inst);
 
   for (dbBlockCallBackObj* cb : block->callbacks_) {
@@ -1367,6 +1376,7 @@ dbInst* dbInst::create(dbBlock* block_,
   }
 
   inst_impl->name_ = safe_strdup(name_);
+  inst_impl->name_hash_ = hash_string(inst_impl->name_);
   inst_impl->inst_hdr_ = inst_hdr->getOID();
   block->inst_hash_.insert(inst_impl);
   inst_hdr->inst_cnt_++;
@@ -64,6 +64,8 @@ class _dbInst : public _dbObject
   static void setInstBBox(_dbInst* inst);
 
   _dbInstFlags flags_;
+  // NON PERSISTANT: hash_string(name_), kept for inst_hash_ lookups
+  uint32_t name_hash_;
   char* name_;
   int x_;
   int y_;
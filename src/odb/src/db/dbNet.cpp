@@ -14,6 +14,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "boost/container/small_vector.hpp"
@@ -31,6 +32,7 @@
 #include "dbGroup.h"
 #include "dbGuide.h"
 #include "dbGuideItr.h"
+#include "dbHashTable.hpp"
 #include "dbITerm.h"
 #include "dbITermItr.h"
 #include "dbInsertBuffer.h"
@@ -91,6 +93,7 @@ _dbNet::_dbNet(_dbDatabase* db, const _dbNet& n)
     name_ = safe_strdup(n.name_);
   }
   driving_iterm_ = -1;
+  name_hash_ = n.name_hash_;
 }
 
 _dbNet::_dbNet(_dbDatabase* db)
@@ -119,6 +122,7 @@ _dbNet::_dbNet(_dbDatabase* db)
   flags_.block_rule = 0;
   flags_.has_jumpers = 0;
   name_ = nullptr;
+  name_hash_ = 0;
   gndc_calibration_factor_ = 1.0;
   cc_calibration_factor_ = 1.0;
   weight_ = 1;
@@ -139,7 +143,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbNet& net)
 {
   uint32_t* bit_field = (uint32_t*) &net.flags_;
   stream << *bit_field;
-  stream << net.name_;
+  stream.writeSharedPrefixName(net.name_, SharedPrefixName::kNet);
   stream << net.gndc_calibration_factor_;
   stream << net.cc_calibration_factor_;
   stream << net.next_entry_;
@@ -165,7 +169,13 @@ dbIStream& operator>>(dbIStream& stream, _dbNet& net)
 {
   uint32_t* bit_field = (uint32_t*) &net.flags_;
   stream >> *bit_field;
-  stream >> net.name_;
+  _dbDatabase* db = net.getImpl()->getDatabase();
+  if (db->isSchema(kSchemaSharedPrefixNames)) {
+    stream.readSharedPrefixName(net.name_, SharedPrefixName::kNet);
+  } else {
+    stream >> net.name_;
+  }
+  net.name_hash_ = net.name_ ? hash_string(net.name_) : 0;
   stream >> net.gndc_calibration_factor_;
   stream >> net.cc_calibration_factor_;
   stream >> net.next_entry_;
@@ -183,7 +193,6 @@ dbIStream& operator>>(dbIStream& stream, _dbNet& net)
   stream >> net.cc_adjust_order_;
   stream >> net.groups_;
   stream >> net.guides_;
-  _dbDatabase* db = net.getImpl()->getDatabase();
   if (db->isSchema(kSchemaNetTracks)) {
     stream >> net.tracks_;
   }
@@ -420,6 +429,7 @@ bool dbNet::rename(const char* name)
   block->net_hash_.remove(net);
   free((void*) net->name_);
   net->name_ = safe_strdup(name);
+  net->name_hash_ = hash_string(net->name_);
   block->net_hash_.insert(net);
 
   return true;
@@ -462,6 +472,7 @@ void dbNet::swapNetNames(dbNet* source, bool ok_to_journal)
   // swap names without copy, just swap the pointers
   dest_net->name_ = source_name_ptr;
   source_net->name_ = dest_name_ptr;
+  std::swap(dest_net->name_hash_, source_net->name_hash_);
 
   block->net_hash_.insert(dest_net);
   block->net_hash_.insert(source_net);
@@ -2201,6 +2212,7 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
   }
 
   net->name_ = safe_strdup(name_);
+  net->name_hash_ = hash_string(net->name_);
   block->net_hash_.insert(net);
 
   debugPrint(block->getImpl()->getLogger(),
@@ -129,6 +129,8 @@ class _dbNet : public _dbObject
   uint32_t cc_adjust_order_;
   // NON PERSISTANT-MEMBERS
   int driving_iterm_;
+  // hash_string(name_), kept for net_hash_ lookups
+  uint32_t name_hash_;
 };
 
 dbOStream& operator<<(dbOStream& stream, const _dbNet& net);
@@ -77,7 +77,7 @@ inline unsigned char dbWireEncoder::getWireType(dbWireType type)
       break;
 
     case dbWireType::SHIELD: {
-      utl::Logger* logger = wire_->getImpl()->getLogger();
+      utl::Logger* logger = block_->getImpl()->getLogger();
       logger->error(
           utl::ODB, 1113, "Shield type should not occur on a wire segment");
     } break;
@@ -155,6 +155,13 @@ void dbWireEncoder::begin(dbWire* wire)
   tech_ = block_->getTech();
 }
 
+void dbWireEncoder::begin(dbBlock* block)
+{
+  clear();
+  block_ = block;
+  tech_ = block_->getTech();
+}
+
 void dbWireEncoder::clear()
 {
   wire_ = nullptr;
@@ -603,12 +610,18 @@ void dbWireEncoder::end()
   }
 }
 
+void dbWireEncoder::end(dbWire* wire)
+{
+  wire_ = (_dbWire*) wire;
+  end();
+}
+
 void dbWireEncoder::setColor(uint8_t mask_color)
 {
   // LEF/DEF says 3 is the max number of supported masks per layer.
   // 0 is also not a valid mask.
   if (mask_color < 1 || mask_color > 3) {
-    utl::Logger* logger = wire_->getImpl()->getLogger();
+    utl::Logger* logger = block_->getImpl()->getLogger();
     logger->error(utl::ODB,
                   1102,
                   "Mask color: {}, but must be between 1 and 3",
@@ -632,7 +645,7 @@ void dbWireEncoder::setViaColor(uint8_t bottom_color,
   // 0 is also not a valid mask.
   for (const auto color : {bottom_color, cut_color, top_color}) {
     if (color > 3) {
-      utl::Logger* logger = wire_->getImpl()->getLogger();
+      utl::Logger* logger = block_->getImpl()->getLogger();
       logger->error(
           utl::ODB, 1103, "Mask color: {}, but must be between 0 and 3", color);
     }
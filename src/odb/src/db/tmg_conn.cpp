@@ -8,6 +8,7 @@
 #include <cstdlib>
 #include <memory>
 #include <tuple>
+#include <utility>
 
 #include "odb/db.h"
 #include "odb/dbSet.h"
@@ -67,6 +68,8 @@ tmg_conn::tmg_conn(utl::Logger* logger) : logger_(logger)
   csNV_.reserve(1024);
   shortV_.reserve(1024);
   need_short_wire_id_ = false;
+  convert_ = false;
+  encoded_ = false;
   first_for_clear_ = nullptr;
 }
 
@@ -1331,6 +1334,18 @@ int tmg_conn::getStartNode()
 
 void tmg_conn::analyzeNet(dbNet* net)
 {
+  tmg_net_order order;
+  orderNet(net, order);
+  commitNet(order);
+}
+
+void tmg_conn::orderNet(dbNet* net, tmg_net_order& order)
+{
+  order.net = net;
+  order.ignored = false;
+  order.destroy_swires = false;
+  order.create_wire = false;
+  order.encoded = false;
   if (net->isWireOrdered()) {
     net_ = net;
     checkConnOrdered();
@@ -1339,21 +1354,45 @@ void tmg_conn::analyzeNet(dbNet* net)
     if (net->getWire()) {
       loadWire(net->getWire());
     }
-    if (ptV_.empty()) {
-      // ignoring this net
-      net->setDisconnected(false);
-      net->setWireOrdered(false);
+    order.ignored = ptV_.empty();
+    if (order.ignored) {
       return;
     }
     findConnections();
     bool noConvert = false;
-    if (hasSWire_) {
-      net->destroySWires();
-    }
+    order.destroy_swires = hasSWire_;
     relocateShorts();
     treeReorder(noConvert);
+    order.create_wire = convert_;
+    order.encoded = encoded_;
+    if (encoded_) {
+      std::swap(order.encoder, encoder_);
+    }
+  }
+  order.connected = connected_;
+}
+
+void tmg_conn::commitNet(tmg_net_order& order)
+{
+  dbNet* net = order.net;
+  if (order.ignored) {
+    net->setDisconnected(false);
+    net->setWireOrdered(false);
+    return;
+  }
+  if (order.destroy_swires) {
+    net->destroySWires();
+  }
+  if (order.create_wire) {
+    dbWire* wire = net->getWire();
+    if (!wire) {
+      wire = dbWire::create(net);
+    }
+    if (order.encoded) {
+      order.encoder.end(wire);
+    }
   }
-  net->setDisconnected(!connected_);
+  net->setDisconnected(!order.connected);
   net->setWireOrdered(true);
 }
 
@@ -1450,14 +1489,11 @@ void tmg_conn::treeReorder(const bool no_convert)
   if (ptV_.empty()) {
     return;
   }
-  newWire_ = nullptr;
+  convert_ = !no_convert;
+  encoded_ = false;
   last_id_ = -1;
-  if (!no_convert) {
-    newWire_ = net_->getWire();
-    if (!newWire_) {
-      newWire_ = dbWire::create(net_);
-    }
-    encoder_.begin(newWire_);
+  if (convert_) {
+    encoder_.begin(net_->getBlock());
     for (tmg_rcpt& pt : ptV_) {
       pt.dbwire_id = -1;
     }
@@ -1585,9 +1621,7 @@ void tmg_conn::treeReorder(const bool no_convert)
   }
 
   checkVisited();
-  if (!no_convert) {
-    encoder_.end();
-  }
+  encoded_ = convert_;
 }
 
 int tmg_conn::getExtension(const int ipt, const tmg_rc* rc)
@@ -1659,7 +1693,7 @@ void tmg_conn::addToWire(const int fr,
                          const bool is_short,
                          const bool is_loop)
 {
-  if (!newWire_) {
+  if (!convert_) {
     return;
   }
 
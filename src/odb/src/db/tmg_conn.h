@@ -149,12 +149,32 @@ struct tmg_connect_shape
   int rtlev;
 };
 
+// The database edits tmg_conn::orderNet computed for one net.
+struct tmg_net_order
+{
+  dbNet* net{nullptr};
+  // The net has no shapes; its ordered and disconnected flags are cleared.
+  bool ignored{false};
+  bool destroy_swires{false};
+  bool connected{true};
+  // A wire is created for the net if it has none.
+  bool create_wire{false};
+  // The encoder holds a complete path for the wire.
+  bool encoded{false};
+  dbWireEncoder encoder;
+};
+
 class tmg_conn
 {
  public:
   tmg_conn(utl::Logger* logger);
   ~tmg_conn();
   void analyzeNet(dbNet* net);
+  // Orders the wires of net into order without modifying the database, so
+  // nets of one block can be ordered concurrently with a tmg_conn per
+  // thread.  commitNet applies the result and must run on one thread.
+  void orderNet(dbNet* net, tmg_net_order& order);
+  static void commitNet(tmg_net_order& order);
   void loadNet(dbNet* net);
   void loadWire(dbWire* wire);
   void loadSWire(dbNet* net);
@@ -228,7 +248,8 @@ class tmg_conn
   bool hasSWire_;
   bool connected_;
   dbWireEncoder encoder_;
-  dbWire* newWire_;
+  bool convert_;
+  bool encoded_;
   dbTechNonDefaultRule* net_rule_;
   dbTechNonDefaultRule* path_rule_;
   bool need_short_wire_id_;
@@ -60,7 +60,6 @@ void tmg_conn::checkConnOrdered()
     }
   }
   if (!connected_) {
-    net_->setDisconnected(true);
     logger_->info(utl::ODB, 15, "disconnected net {}", net_->getName());
   }
 }
@@ -3,20 +3,58 @@
 
 #include "odb/wOrder.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include "odb/db.h"
 #include "tmg_conn.h"
+#include "utl/ThreadPool.h"
 
 namespace odb {
 
-void orderWires(utl::Logger* logger, dbBlock* block)
+void orderWires(utl::Logger* logger, dbBlock* block, const int num_threads)
 {
-  tmg_conn conn(logger);
-
+  std::vector<dbNet*> nets;
   for (auto net : block->getNets()) {
     if (net->getSigType().isSupply() || net->isWireOrdered()) {
       continue;
     }
-    conn.analyzeNet(net);
+    nets.push_back(net);
+  }
+
+  if (num_threads <= 1 || nets.size() <= 1) {
+    tmg_conn conn(logger);
+    for (dbNet* net : nets) {
+      conn.analyzeNet(net);
+    }
+    return;
+  }
+
+  // Nets are ordered and encoded concurrently and then committed in block
+  // order, which only creates wires and copies the encoded paths.  Batches
+  // bound the memory held by encoded paths waiting to be committed.
+  constexpr size_t kBatchSize = 16384;
+  const size_t chunk_count = static_cast<size_t>(num_threads) * 4;
+  utl::ThreadPool pool(num_threads);
+  std::vector<tmg_net_order> orders(std::min(kBatchSize, nets.size()));
+  for (size_t batch = 0; batch < nets.size(); batch += kBatchSize) {
+    const size_t batch_size = std::min(kBatchSize, nets.size() - batch);
+    const size_t chunk_size = (batch_size + chunk_count - 1) / chunk_count;
+    std::vector<size_t> chunk_begins;
+    for (size_t begin = 0; begin < batch_size; begin += chunk_size) {
+      chunk_begins.push_back(begin);
+    }
+    pool.parallelFor(chunk_begins, [&](const size_t begin) {
+      tmg_conn conn(logger);
+      const size_t end = std::min(begin + chunk_size, batch_size);
+      for (size_t i = begin; i < end; ++i) {
+        conn.orderNet(nets[batch + i], orders[i]);
+      }
+    });
+    for (size_t i = 0; i < batch_size; ++i) {
+      tmg_conn::commitNet(orders[i]);
+    }
   }
 }
 
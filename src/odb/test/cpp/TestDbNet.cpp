@@ -315,4 +315,26 @@ TEST_F(TestDbNet, FlatNetNameCollisionWithBareModBTermThrows)
                std::runtime_error);
 }
 
+TEST_F(TestDbNet, ReservedNamesAreFound)
+{
+  dbNet::create(block_, "before");
+  block_->reserveNets(1000);
+  block_->reserveInsts(1000);
+
+  auto* inv1_master = db_->findMaster("INV_X1");
+  for (int i = 0; i < 1000; ++i) {
+    const std::string name = "n" + std::to_string(i);
+    dbNet::create(block_, name.c_str());
+    dbInst::create(block_, inv1_master, name.c_str());
+  }
+
+  EXPECT_NE(block_->findNet("before"), nullptr);
+  for (int i = 0; i < 1000; ++i) {
+    const std::string name = "n" + std::to_string(i);
+    EXPECT_NE(block_->findNet(name.c_str()), nullptr);
+    EXPECT_NE(block_->findInst(name.c_str()), nullptr);
+  }
+  EXPECT_EQ(block_->findNet("missing"), nullptr);
+}
+
 }  // namespace odb
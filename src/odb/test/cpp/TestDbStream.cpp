@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <map>
 #include <sstream>
@@ -206,5 +207,56 @@ TEST_F(DbStreamTest, ContainerTypes)
   EXPECT_EQ(variant2, variant2_in);
 }
 
+/// Tests that prefix compressed names round trip per kind and that later
+/// names only store what differs from the previous one.
+TEST_F(DbStreamTest, SharedPrefixNames)
+{
+  std::stringstream ss;
+  dbOStream out(reinterpret_cast<_dbDatabase*>(getDb()), ss);
+
+  const std::vector<std::string> insts
+      = {"core/alu/add_0", "core/alu/add_1", "core/alu/sub_0", "io/pad", ""};
+  const std::vector<std::string> nets = {"core/alu/n1", "core/alu/n2"};
+
+  for (size_t i = 0; i < insts.size(); i++) {
+    out.writeSharedPrefixName(insts[i].c_str(), SharedPrefixName::kInst);
+    if (i < nets.size()) {
+      out.writeSharedPrefixName(nets[i].c_str(), SharedPrefixName::kNet);
+    }
+  }
+  out.writeSharedPrefixName(nullptr, SharedPrefixName::kInst);
+  out.flush();
+
+  dbIStream in(reinterpret_cast<_dbDatabase*>(getDb()), ss);
+  for (size_t i = 0; i < insts.size(); i++) {
+    char* name;
+    in.readSharedPrefixName(name, SharedPrefixName::kInst);
+    ASSERT_NE(name, nullptr);
+    EXPECT_EQ(insts[i], name);
+    free(name);
+    if (i < nets.size()) {
+      in.readSharedPrefixName(name, SharedPrefixName::kNet);
+      ASSERT_NE(name, nullptr);
+      EXPECT_EQ(nets[i], name);
+      free(name);
+    }
+  }
+  char* null_name;
+  in.readSharedPrefixName(null_name, SharedPrefixName::kInst);
+  EXPECT_EQ(null_name, nullptr);
+
+  // "core/alu/add_1" after "core/alu/add_0" stores a shared length of 13
+  // and the one character suffix.
+  std::stringstream single;
+  dbOStream counted(reinterpret_cast<_dbDatabase*>(getDb()), single);
+  counted.writeSharedPrefixName("core/alu/add_0", SharedPrefixName::kInst);
+  counted.flush();
+  const size_t first_size = single.str().size();
+  counted.writeSharedPrefixName("core/alu/add_1", SharedPrefixName::kInst);
+  counted.flush();
+  EXPECT_EQ(single.str().size() - first_size,
+            sizeof(uint32_t) + sizeof(uint32_t) + 2);
+}
+
 }  // namespace
 }  // namespace odb
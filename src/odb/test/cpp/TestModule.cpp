@@ -295,6 +295,34 @@ TEST_F(ModuleFixture, test_default)
   EXPECT_EQ(parent_mod->getInsts().size(), 0);
 }
 
+// Modules and bterms hash their names on the fly, unlike insts and nets
+// which cache the hash.  Enough of them are created to grow the tables.
+TEST_F(ModuleFixture, hashed_names_without_cached_hash)
+{
+  constexpr int kCount = 300;
+  dbNet* net = dbNet::create(block_, "hash_net");
+  for (int i = 0; i < kCount; i++) {
+    const std::string suffix = std::to_string(i);
+    ASSERT_NE(dbModule::create(block_, ("hash_mod_" + suffix).c_str()),
+              nullptr);
+    ASSERT_NE(dbBTerm::create(net, ("hash_port_" + suffix).c_str()), nullptr);
+  }
+  for (int i = 0; i < kCount; i++) {
+    const std::string suffix = std::to_string(i);
+    dbModule* module = block_->findModule(("hash_mod_" + suffix).c_str());
+    ASSERT_NE(module, nullptr);
+    EXPECT_EQ(std::string(module->getName()), "hash_mod_" + suffix);
+    dbBTerm* bterm = block_->findBTerm(("hash_port_" + suffix).c_str());
+    ASSERT_NE(bterm, nullptr);
+    EXPECT_EQ(bterm->getName(), "hash_port_" + suffix);
+  }
+
+  dbBTerm::destroy(block_->findBTerm("hash_port_7"));
+  EXPECT_EQ(block_->findBTerm("hash_port_7"), nullptr);
+  EXPECT_NE(block_->findBTerm("hash_port_8"), nullptr);
+  EXPECT_EQ(block_->findModule("hash_mod_missing"), nullptr);
+}
+
 TEST_F(ModuleFixture, test_find_modinst)
 {
   auto top = block_->getTopModule();
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2026, The OpenROAD Authors
 
+#include <string>
+
 #include "gtest/gtest.h"
 #include "odb/db.h"
 #include "odb/dbWireCodec.h"
@@ -121,4 +123,54 @@ TEST_F(TestOrderWires, InputBumpNetWithPatchAtTheBeginning)
   EXPECT_EQ(decoder.next(), dbWireDecoder::END_DECODE);
 }
 
+TEST_F(TestOrderWires, MultiThreadedMatchesSerial)
+{
+  dbTechLayer* metal1 = db_->getTech()->findLayer("metal1");
+  dbMaster* inv = db_->findMaster("INV_X1");
+  constexpr int kNets = 16;
+  for (int i = 0; i < kNets; i++) {
+    const std::string net_name = "n" + std::to_string(i);
+    dbInst* driver = makeInst(block_,
+                              inv,
+                              ("drv" + std::to_string(i)).c_str(),
+                              {.location = {10000, 10000 + i * 5000},
+                               .status = dbPlacementStatus::PLACED,
+                               .iterms = {{net_name.c_str(), "ZN"}}});
+    dbInst* load = makeInst(block_,
+                            inv,
+                            ("load" + std::to_string(i)).c_str(),
+                            {.location = {50000, 10000 + i * 5000},
+                             .status = dbPlacementStatus::PLACED,
+                             .iterms = {{net_name.c_str(), "A"}}});
+    int x0, y0, x1, y1;
+    driver->findITerm("ZN")->getAvgXY(&x0, &y0);
+    load->findITerm("A")->getAvgXY(&x1, &y1);
+
+    // Written from the load to the driver so that ordering has to flip it.
+    dbWireEncoder encoder;
+    encoder.begin(dbWire::create(block_->findNet(net_name.c_str())));
+    encoder.newPath(metal1, dbWireType::ROUTED);
+    encoder.addPoint(x1, y1);
+    encoder.addPoint(x1, y0);
+    encoder.addPoint(x0, y0);
+    encoder.end();
+  }
+
+  orderWires(&logger_, block_, 4);
+
+  for (int i = 0; i < kNets; i++) {
+    dbNet* net = block_->findNet(("n" + std::to_string(i)).c_str());
+    EXPECT_TRUE(net->isWireOrdered());
+    EXPECT_FALSE(net->isDisconnected());
+
+    dbWireDecoder decoder;
+    decoder.begin(net->getWire());
+    EXPECT_EQ(decoder.next(), dbWireDecoder::PATH);
+    EXPECT_EQ(decoder.next(), dbWireDecoder::POINT);
+    EXPECT_EQ(decoder.next(), dbWireDecoder::ITERM);
+    EXPECT_EQ(decoder.getITerm()->getInst()->getName(),
+              "drv" + std::to_string(i));
+  }
+}
+
 }  // namespace odb
@@ -103,6 +103,7 @@ class ICeWall
                 float turn_penalty = 2.0,
                 int max_iterations = 10);
   void routeRDLDebugGUI(bool enable);
+  void setNumThreads(int threads) { num_threads_ = threads; }
   void routeRDLDebugNet(const char* net);
   void routeRDLDebugPin(const char* pin);
 
@@ -144,6 +145,7 @@ class ICeWall
   std::unique_ptr<RDLGui> router_gui_;
   odb::dbNet* rdl_net_debug_ = nullptr;
   odb::dbITerm* rdl_pin_debug_ = nullptr;
+  int num_threads_ = 1;
 
   constexpr static const char* kFakeLibraryName = "FAKE_IO";
   constexpr static const char* kRowNorth = "IO_NORTH";
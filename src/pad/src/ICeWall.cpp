@@ -1466,6 +1466,7 @@ void ICeWall::routeRDL(odb::dbTechLayer* layer,
                                         max_iterations);
   router_->setRDLDebugNet(rdl_net_debug_);
   router_->setRDLDebugPin(rdl_pin_debug_);
+  router_->setNumThreads(num_threads_);
   if (router_gui_ != nullptr) {
     router_gui_->setRouter(router_.get());
   }
@@ -1518,6 +1519,7 @@ void ICeWall::routeRDLDebugPin(const char* pin)
 
   if (router_ != nullptr) {
     router_->setRDLDebugPin(rdl_pin_debug_);
+  router_->setNumThreads(num_threads_);
   }
 }
 
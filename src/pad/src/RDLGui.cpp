@@ -4,10 +4,7 @@
 #include "RDLGui.h"
 
 #include <cstddef>
-#include <map>
 #include <string>
-#include <tuple>
-#include <vector>
 
 #include "RDLNet.h"
 #include "RDLRouter.h"
@@ -46,8 +43,6 @@ void RDLGui::drawObjects(gui::Painter& painter)
 
   const odb::Rect box = painter.getBounds();
 
-  const auto& vertex_map = router_->getVertexMap();
-
   odb::PtrMap<odb::dbITerm, RDLSegment*> routes;
   for (const auto& route : router_->getRoutes()) {
     for (const auto& segment : route->getSegments()) {
@@ -69,27 +64,10 @@ void RDLGui::drawObjects(gui::Painter& painter)
   const bool draw_vertex = draw_detail && checkDisplayControl(kDrawVertex);
   const bool draw_edge = draw_detail && checkDisplayControl(kDrawEdge);
 
-  std::vector<GridGraph::vertex_descriptor> vertex;
-  if (draw_vertex || draw_edge) {
-    GridGraph::vertex_iterator v, vend;
-    for (boost::tie(v, vend) = boost::vertices(router_->getGraph()); v != vend;
-         ++v) {
-      const auto find_pt = vertex_map.find(*v);
-      if (find_pt == vertex_map.end()) {
-        continue;
-      }
-      const odb::Point& pt = find_pt->second;
-      if (box.contains({pt, pt})) {
-        vertex.push_back(*v);
-      }
-    }
-  }
-
   if (draw_vertex) {
     painter.setPenAndBrush(gui::Painter::kRed, true);
 
-    for (const auto& v : vertex) {
-      const odb::Point& pt = vertex_map.at(v);
+    for (const auto& pt : router_->getGridPoints(box)) {
       painter.drawCircle(pt.x(), pt.y(), 100);
     }
   }
@@ -99,14 +77,8 @@ void RDLGui::drawObjects(gui::Painter& painter)
   if (draw_edge) {
     painter.setPenAndBrush(edge_color, true);
 
-    for (const auto& v : vertex) {
-      GridGraph::out_edge_iterator eit, eend;
-      std::tie(eit, eend) = boost::out_edges(v, router_->getGraph());
-      for (; eit != eend; eit++) {
-        const odb::Point& pt0 = vertex_map.at(eit->m_source);
-        const odb::Point& pt1 = vertex_map.at(eit->m_target);
-        painter.drawLine(pt0, pt1);
-      }
+    for (const auto& [pt0, pt1] : router_->getGridEdges(box)) {
+      painter.drawLine(pt0, pt1);
     }
   }
 
@@ -4,13 +4,15 @@
 #include "RDLRouter.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <list>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <string>
@@ -25,8 +27,6 @@
 #include "Utilities.h"
 #include "boost/geometry/geometries/point_xy.hpp"
 #include "boost/geometry/geometry.hpp"
-#include "boost/graph/astar_search.hpp"
-#include "boost/graph/lookup_edge.hpp"
 #include "boost/polygon/polygon.hpp"
 #include "odb/PtrSetMap.h"
 #include "odb/db.h"
@@ -37,6 +37,7 @@
 #include "odb/geom_boost.h"
 #include "pad/ICeWall.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 namespace pad {
 
@@ -77,85 +78,6 @@ bool compareRouteTargets(const RouteTarget& lhs, const RouteTarget& rhs)
 
 }  // namespace
 
-class RDLRouterDistanceHeuristic
-    : public boost::astar_heuristic<GridGraph, int64_t>
-{
- public:
-  RDLRouterDistanceHeuristic(
-      const std::unordered_map<GridGraphVertex, odb::Point>& vertex_map,
-      const std::vector<GridGraphVertex>& predecessor,
-      const GridGraphVertex& start_vertex,
-      const odb::Point& goal,
-      float turn_penalty)
-      : vertex_map_(vertex_map),
-        predecessor_(predecessor),
-        start_vertex_(start_vertex),
-        goal_(goal),
-        turn_penalty_(turn_penalty)
-  {
-  }
-  int64_t operator()(GridGraphVertex vt_next)
-  {
-    const auto& pt_next = vertex_map_.at(vt_next);
-
-    const int64_t distance = RDLRouter::distance(goal_, pt_next);
-
-    const auto& vt_curr = predecessor_[vt_next];
-    if (start_vertex_ == vt_curr) {
-      return distance;
-    }
-
-    const auto& vt_prev = predecessor_[vt_curr];
-    if (start_vertex_ == vt_prev) {
-      return distance;
-    }
-
-    const auto& pt_curr = vertex_map_.at(vt_curr);
-    const auto& pt_prev = vertex_map_.at(vt_prev);
-
-    const odb::Point incoming_vec(pt_curr.x() - pt_prev.x(),
-                                  pt_curr.y() - pt_prev.y());
-    const odb::Point outgoing_vec(pt_next.x() - pt_curr.x(),
-                                  pt_next.y() - pt_curr.y());
-
-    int64_t penalty = 0;
-    if (incoming_vec != outgoing_vec) {
-      penalty = turn_penalty_ * RDLRouter::distance(pt_prev, pt_curr);
-    }
-
-    return distance + penalty;
-  }
-
- private:
-  const std::unordered_map<GridGraphVertex, odb::Point>& vertex_map_;
-  const std::vector<GridGraphVertex>& predecessor_;
-  const GridGraphVertex& start_vertex_;
-  odb::Point goal_;
-  const float turn_penalty_;
-};
-
-struct RDLRouterGoalFound
-{
-};  // exception for termination
-
-// visitor that terminates when we find the goal
-template <class Vertex>
-class RDLRouterGoalVisitor : public boost::default_astar_visitor
-{
- public:
-  explicit RDLRouterGoalVisitor(GridGraphVertex goal) : goal_(goal) {}
-  template <class Graph>
-  void examine_vertex(Vertex u, Graph& g)
-  {
-    if (u == goal_) {
-      throw RDLRouterGoalFound();
-    }
-  }
-
- private:
-  GridGraphVertex goal_;
-};
-
 //////////////////////////////////////////////////////////////
 
 RDLRouter::RDLRouter(
@@ -453,125 +375,118 @@ void RDLRouter::route(const std::vector<odb::dbNet*>& nets)
     }
   }
 
-  while (!route_queue.empty()) {
-    RDLSegment* segment = route_queue.top();
-    odb::dbITerm* src = segment->getTerminal();
-    route_queue.pop();
-
-    segment->markRouting();
-
-    odb::dbNet* net = src->getNet();
-
-    auto& net_targets = routing_targets_[net];
+  // Segments of different nets are searched concurrently when threads are
+  // available.  The routes are committed in queue order and a search which
+  // read an area changed by a route committed ahead of it in the batch is
+  // repeated, so the result matches routing one segment at a time.
+  const bool parallel = num_threads_ > 1 && gui_ == nullptr;
+  std::unique_ptr<utl::ThreadPool> pool;
+  if (parallel) {
+    pool = std::make_unique<utl::ThreadPool>(num_threads_);
+  }
+  const std::size_t max_batch_size = parallel ? num_threads_ : 1;
 
-    // get the next destination
-    odb::dbITerm* dst = segment->getNextDestinationTerminal();
-    if (dst != nullptr) {
-      // create ordered set of iterm targets
-      std::vector<TargetPair> targets;
-      for (const auto& src_target : net_targets[src]) {
-        for (const auto& dst_target : net_targets[dst]) {
-          targets.push_back(TargetPair{&src_target, &dst_target});
-        }
+  while (!route_queue.empty()) {
+    std::vector<RDLSegment*> batch;
+    odb::PtrSet<odb::dbNet> batch_nets;
+    while (!route_queue.empty() && batch.size() < max_batch_size) {
+      RDLSegment* segment = route_queue.top();
+      // the next destination of a segment depends on the routes of its net
+      if (!batch_nets.insert(segment->getNet()).second) {
+        break;
       }
+      batch.push_back(segment);
+      route_queue.pop();
+    }
 
-      std::ranges::stable_sort(targets, [](const auto& lhs, const auto& rhs) {
-        const auto lhs_dist = distance(lhs);
-        const auto rhs_dist = distance(rhs);
-        if (lhs_dist != rhs_dist) {
-          return lhs_dist < rhs_dist;
-        }
-        if (lhs.target0->center.x() != rhs.target0->center.x()) {
-          return lhs.target0->center.x() < rhs.target0->center.x();
-        }
-        if (lhs.target0->center.y() != rhs.target0->center.y()) {
-          return lhs.target0->center.y() < rhs.target0->center.y();
-        }
-        if (lhs.target1->center.x() != rhs.target1->center.x()) {
-          return lhs.target1->center.x() < rhs.target1->center.x();
-        }
-        return lhs.target1->center.y() < rhs.target1->center.y();
+    std::vector<RouteAttempt> attempts(batch.size());
+    if (batch.size() > 1) {
+      std::vector<std::size_t> batch_idx(batch.size());
+      std::iota(batch_idx.begin(), batch_idx.end(), 0);
+      pool->parallelFor(batch_idx, [&](const std::size_t idx) {
+        RDLSegment* segment = batch[idx];
+        attempts[idx] = findRoute(getTargetPairs(
+            segment->getTerminal(), segment->peakNextDestinationTerminal()));
       });
+    }
 
-      debugPrint(
-          logger_,
-          utl::PAD,
-          "Router",
-          2,
-          "Routing {} -> {} ({}): ({:.3f}um) / {} target pairs / {} priority",
-          src->getName(),
-          dst->getName(),
-          net->getName(),
-          distance(src->getBBox().center(), dst->getBBox().center()) / dbus,
-          targets.size(),
-          segment->getPriority());
-
-      for (auto& points : targets) {
-        debugPrint(logger_,
-                   utl::PAD,
-                   "Router",
-                   3,
-                   "Routing {} ({:.3f}um, {:.3f}um) -> ({:.3f}um, {:.3f}um) : "
-                   "({:.3f}um)",
-                   net->getName(),
-                   points.target0->center.x() / dbus,
-                   points.target0->center.y() / dbus,
-                   points.target1->center.x() / dbus,
-                   points.target1->center.y() / dbus,
-                   distance(points) / dbus);
-
-        const TerminalAccess access0
-            = insertTerminalAccess(*points.target0, *points.target1);
-        const TerminalAccess access1
-            = insertTerminalAccess(*points.target1, *points.target0);
-
-        auto route_vextex = run(points.target0->center, points.target1->center);
-
-        if (!route_vextex.empty()) {
-          debugPrint(logger_,
-                     utl::PAD,
-                     "Router",
-                     3,
-                     "Route segments {}",
-                     route_vextex.size());
-          const auto route_edges = commitRoute(route_vextex);
-          segment->setRoute(vertex_point_map_,
-                            route_vextex,
-                            route_edges,
-                            points.target0,
-                            points.target1,
-                            access0,
-                            access1);
+    std::vector<odb::Rect> committed;
+    bool requeued = false;
+    for (std::size_t idx = 0; idx < batch.size() && !requeued; idx++) {
+      RDLSegment* segment = batch[idx];
+      odb::dbITerm* src = segment->getTerminal();
+
+      segment->markRouting();
+
+      odb::dbNet* net = src->getNet();
+
+      // get the next destination
+      odb::dbITerm* dst = segment->getNextDestinationTerminal();
+      if (dst != nullptr) {
+        const std::vector<TargetPair> targets = getTargetPairs(src, dst);
+
+        debugPrint(
+            logger_,
+            utl::PAD,
+            "Router",
+            2,
+            "Routing {} -> {} ({}): ({:.3f}um) / {} target pairs / {} "
+            "priority",
+            src->getName(),
+            dst->getName(),
+            net->getName(),
+            distance(src->getBBox().center(), dst->getBBox().center()) / dbus,
+            targets.size(),
+            segment->getPriority());
+
+        RouteAttempt& attempt = attempts[idx];
+        if (batch.size() == 1
+            || std::ranges::any_of(committed, [&](const odb::Rect& rect) {
+                 return rect.intersects(attempt.footprint);
+               })) {
+          attempt = findRoute(targets);
         }
 
-        removeTerminalAccess(access0);
-        removeTerminalAccess(access1);
-
-        if (segment->isRouted()) {
-          break;
+        if (!attempt.route.empty()) {
+          const auto route_edges = commitRoute(attempt.route);
+          if (batch.size() > 1) {
+            committed.push_back(
+                getCommitFootprint(attempt.route, route_edges));
+          }
+          segment->setRoute(
+              attempt.route, route_edges, attempt.source, attempt.target);
         }
       }
-    }
 
-    if (!segment->isRouted()) {
-      if (segment->hasNextTerminal()) {
-        route_queue.push(segment);
+      if (!segment->isRouted()) {
+        if (segment->hasNextTerminal()) {
+          route_queue.push(segment);
+          // the rest of the batch goes back so the queue picks the next
+          // segment as it would have without the batch
+          requeued = true;
+          for (std::size_t next = idx + 1; next < batch.size(); next++) {
+            route_queue.push(batch[next]);
+          }
+        }
       }
-    }
 
-    if (gui_ != nullptr
-        && (logger_->debugCheck(utl::PAD, "Router", 3) || isDebugNet(net))) {
-      const bool use_timeout = segment->isRouted() && !isDebugNet(net);
-      gui_->pause(
-          fmt::format("{} {} on {} ({} route(s) left in the queue)",
-                      segment->isRouted() ? "routed" : "failed to route",
-                      src->getName(),
-                      net->getName(),
-                      route_queue.size()),
-          use_timeout);
+      if (gui_ != nullptr
+          && (logger_->debugCheck(utl::PAD, "Router", 3)
+              || isDebugNet(net))) {
+        const bool use_timeout = segment->isRouted() && !isDebugNet(net);
+        gui_->pause(
+            fmt::format("{} {} on {} ({} route(s) left in the queue)",
+                        segment->isRouted() ? "routed" : "failed to route",
+                        src->getName(),
+                        net->getName(),
+                        route_queue.size()),
+            use_timeout);
+      }
     }
 
     if (route_queue.empty() && iteration_count < max_router_iterations_) {
+      odb::dbNet* net = batch.back()->getNet();
+
       // at the end of the queue, should check for failures and retry
       iteration_count++;
 
@@ -713,19 +628,101 @@ void RDLRouter::route(const std::vector<odb::dbNet*>& nets)
   }
 }
 
-void RDLRouter::removeTerminalAccess(const TerminalAccess& access)
+std::vector<RDLRouter::TargetPair> RDLRouter::getTargetPairs(
+    odb::dbITerm* src,
+    odb::dbITerm* dst) const
 {
-  for (const auto& [pt0, pt1] : access.added_edges) {
-    boost::remove_edge(point_vertex_map_[pt0], point_vertex_map_[pt1], graph_);
+  std::vector<TargetPair> targets;
+  if (dst == nullptr) {
+    return targets;
+  }
+
+  const auto net_targets = routing_targets_.find(src->getNet());
+  if (net_targets == routing_targets_.end()) {
+    return targets;
+  }
+  const auto src_targets = net_targets->second.find(src);
+  const auto dst_targets = net_targets->second.find(dst);
+  if (src_targets == net_targets->second.end()
+      || dst_targets == net_targets->second.end()) {
+    return targets;
   }
 
-  for (const auto& pt : access.added_points) {
-    removeGraphVertex(pt);
+  // create ordered set of iterm targets
+  for (const auto& src_target : src_targets->second) {
+    for (const auto& dst_target : dst_targets->second) {
+      targets.push_back(TargetPair{&src_target, &dst_target});
+    }
+  }
+
+  std::ranges::stable_sort(targets, [](const auto& lhs, const auto& rhs) {
+    const auto lhs_dist = distance(lhs);
+    const auto rhs_dist = distance(rhs);
+    if (lhs_dist != rhs_dist) {
+      return lhs_dist < rhs_dist;
+    }
+    if (lhs.target0->center.x() != rhs.target0->center.x()) {
+      return lhs.target0->center.x() < rhs.target0->center.x();
+    }
+    if (lhs.target0->center.y() != rhs.target0->center.y()) {
+      return lhs.target0->center.y() < rhs.target0->center.y();
+    }
+    if (lhs.target1->center.x() != rhs.target1->center.x()) {
+      return lhs.target1->center.x() < rhs.target1->center.x();
+    }
+    return lhs.target1->center.y() < rhs.target1->center.y();
+  });
+
+  return targets;
+}
+
+RDLRouter::RouteAttempt RDLRouter::findRoute(
+    const std::vector<TargetPair>& targets) const
+{
+  const double dbus = block_->getDbUnitsPerMicron();
+
+  RouteAttempt attempt;
+  attempt.footprint.mergeInit();
+
+  for (const auto& points : targets) {
+    debugPrint(logger_,
+               utl::PAD,
+               "Router",
+               3,
+               "Routing {} ({:.3f}um, {:.3f}um) -> ({:.3f}um, {:.3f}um) : "
+               "({:.3f}um)",
+               points.target0->terminal->getNet()->getName(),
+               points.target0->center.x() / dbus,
+               points.target0->center.y() / dbus,
+               points.target1->center.x() / dbus,
+               points.target1->center.y() / dbus,
+               distance(points) / dbus);
+
+    TerminalAccess access;
+    insertTerminalAccess(*points.target0, access, attempt.footprint);
+    insertTerminalAccess(*points.target1, access, attempt.footprint);
+
+    auto route = run(points.target0->center,
+                     points.target1->center,
+                     access,
+                     attempt.footprint);
+
+    if (!route.empty()) {
+      debugPrint(
+          logger_, utl::PAD, "Router", 3, "Route segments {}", route.size());
+      attempt.route = std::move(route);
+      attempt.source = points.target0;
+      attempt.target = points.target1;
+      break;
+    }
   }
 
-  for (const auto& [pt0, pt1, weight] : access.removed_edges) {
-    addGraphEdge(pt0, pt1, weight, true, true);
+  if (!attempt.footprint.isInverted()) {
+    // covers the spacing checks of the access points and edges
+    attempt.footprint.bloat(width_ + spacing_, attempt.footprint);
   }
+
+  return attempt;
 }
 
 std::set<odb::Point> RDLRouter::generateTerminalAccessPoints(
@@ -791,8 +788,12 @@ void RDLRouter::cleanupGraphEdges(
   for (const auto& pt : remove_pts) {
     auto find_pt = edges.find(pt);
     if (find_pt != edges.end()) {
-      for (const auto& edge : find_pt->second) {
-        boost::remove_edge(edge, graph_);
+      for (const auto& [v0, v1] : find_pt->second) {
+        GridGraphVertex owner;
+        uint8_t bit;
+        if (getGridEdgeBit(v0, v1, owner, bit)) {
+          grid_edges_[owner] &= ~bit;
+        }
       }
     }
   }
@@ -845,44 +846,58 @@ void RDLRouter::populateTerminalAccessPoints(
   //   intersects another edge
   for (auto snap_itr = snap_pts.begin(); snap_itr != snap_pts.end();) {
     const odb::Line line(target.center, *snap_itr);
-    bool erase = obstructions_.qbegin(boost::geometry::index::intersects(line)
-                                      && boost::geometry::index::satisfies(
-                                          [&target](const ObsValue& value) {
-                                            return std::get<3>(value)
-                                                   != target.terminal;
-                                          }))
-                 != obstructions_.qend();
+    // the boxes of diagonal routes are much larger than the routes, so
+    // check the polygon too
+    bool erase
+        = obstructions_.qbegin(
+              boost::geometry::index::intersects(line)
+              && boost::geometry::index::satisfies(
+                  [&target, &line](const ObsValue& value) {
+                    return std::get<3>(value) != target.terminal
+                           && boost::geometry::intersects(line,
+                                                          std::get<1>(value));
+                  }))
+          != obstructions_.qend();
 
     if (!erase) {
-      for (auto itr
-           = vertex_grid_tree_.qbegin(boost::geometry::index::intersects(line));
-           itr != vertex_grid_tree_.qend();
-           itr++) {
-        const odb::Point& pt = vertex_point_map_.at(itr->second);
-        if (pt.x() == snap_itr->x() || pt.y() == snap_itr->y()) {
-          continue;
-        }
-
-        for (const auto& edge : getVertexEdges(itr->second)) {
-          const odb::Point& pt0 = vertex_point_map_.at(edge.m_source);
-          if (pt0 == line.pt0() || pt0 == line.pt1()) {
-            // lines will connect, so keep
+      const odb::Rect line_box(line.pt0(), line.pt1());
+      std::size_t x_begin, x_end, y_begin, y_end;
+      getGridRange(line_box, x_begin, x_end, y_begin, y_end);
+      std::vector<GridGraphVertex> neighbors;
+      for (std::size_t i = x_begin; i < x_end; i++) {
+        for (std::size_t j = y_begin; j < y_end; j++) {
+          const GridGraphVertex vertex = i * y_grid_.size() + j;
+          const odb::Point pt0 = getGridPoint(vertex);
+          // the line is axis aligned, so only vertices inside its box are on
+          // the line
+          if (!line_box.intersects(pt0)) {
             continue;
           }
-          const odb::Point& pt1 = vertex_point_map_.at(edge.m_target);
-          if (pt1 == line.pt0() || pt1 == line.pt1()) {
+          if (pt0.x() == snap_itr->x() || pt0.y() == snap_itr->y()) {
+            continue;
+          }
+          if (pt0 == line.pt0() || pt0 == line.pt1()) {
             // lines will connect, so keep
             continue;
           }
-          const odb::Line edge_line(pt0, pt1);
-
-          if (boost::geometry::intersects(line, edge_line)) {
-            // if edge is 45degree mark is for removal and keep snap point
-            if (is45DegreeEdge(pt0, pt1)) {
-              edges[*snap_itr].insert(edge);
-            } else {
-              erase = true;
-              break;
+
+          neighbors.clear();
+          getGridNeighbors(vertex, neighbors);
+          for (const GridGraphVertex other : neighbors) {
+            const odb::Point pt1 = getGridPoint(other);
+            if (pt1 == line.pt0() || pt1 == line.pt1()) {
+              // lines will connect, so keep
+              continue;
+            }
+            const odb::Line edge_line(pt0, pt1);
+
+            if (boost::geometry::intersects(line, edge_line)) {
+              // if edge is 45degree mark is for removal and keep snap point
+              if (is45DegreeEdge(pt0, pt1)) {
+                edges[*snap_itr].insert(std::minmax(vertex, other));
+              } else {
+                erase = true;
+              }
             }
           }
         }
@@ -994,16 +1009,16 @@ void RDLRouter::cleanupTerminalAccessPoints(
   }
 }
 
-RDLRouter::TerminalAccess RDLRouter::insertTerminalAccess(
-    const RouteTarget& target,
-    const RouteTarget& source)
+void RDLRouter::insertTerminalAccess(const RouteTarget& target,
+                                     TerminalAccess& access,
+                                     odb::Rect& footprint) const
 {
-  TerminalAccess access;
-
   // Remove snap points that would cause a violation
   //   intersects another route
   std::set<odb::Point> snap_pts = target.grid_access;
   for (auto snap_itr = snap_pts.begin(); snap_itr != snap_pts.end();) {
+    footprint.merge(*snap_itr);
+
     bool erase = false;
 
     for (const auto& route : routes_) {
@@ -1045,61 +1060,76 @@ RDLRouter::TerminalAccess RDLRouter::insertTerminalAccess(
   }
 
   // prepare routing graph
-  if (point_vertex_map_.find(target.center) == point_vertex_map_.end()) {
-    if (addGraphVertex(target.center)) {
-      access.added_points.insert(target.center);
-    }
-  }
+  footprint.merge(target.center);
+  addAccessVertex(target.center, access);
 
+  const std::size_t nx = x_grid_.size();
+  const std::size_t ny = y_grid_.size();
+  std::vector<GridGraphVertex> neighbors;
   for (const odb::Point& snap : snap_pts) {
+    // grid vertices next to the snap point on its grid line
     std::vector<GridGraphVertex> vertex_to_modify;
-
-    // remove intersecting edges
-    for (auto itr
-         = vertex_grid_tree_.qbegin(boost::geometry::index::intersects(snap));
-         itr != vertex_grid_tree_.qend();
-         itr++) {
-      const auto& pt = vertex_point_map_[itr->second];
-      if (pt.x() == snap.x() || pt.y() == snap.y()) {
-        vertex_to_modify.push_back(itr->second);
+    const auto x_itr = std::ranges::lower_bound(x_grid_, snap.x());
+    const auto y_itr = std::ranges::lower_bound(y_grid_, snap.y());
+    const std::size_t i = std::distance(x_grid_.begin(), x_itr);
+    const std::size_t j = std::distance(y_grid_.begin(), y_itr);
+    const bool on_x = x_itr != x_grid_.end() && *x_itr == snap.x();
+    const bool on_y = y_itr != y_grid_.end() && *y_itr == snap.y();
+    if (on_x && on_y) {
+      const GridGraphVertex vertex = i * ny + j;
+      vertex_to_modify.push_back(vertex);
+      if (j + 1 < ny) {
+        vertex_to_modify.push_back(vertex + 1);
+      }
+      if (j > 0) {
+        vertex_to_modify.push_back(vertex - 1);
+      }
+      if (i > 0) {
+        vertex_to_modify.push_back(vertex - ny);
+      }
+      if (i + 1 < nx) {
+        vertex_to_modify.push_back(vertex + ny);
+      }
+    } else if (on_x) {
+      if (j > 0 && j < ny) {
+        vertex_to_modify.push_back(i * ny + j - 1);
+        vertex_to_modify.push_back(i * ny + j);
+      }
+    } else if (on_y) {
+      if (i > 0 && i < nx) {
+        vertex_to_modify.push_back((i - 1) * ny + j);
+        vertex_to_modify.push_back(i * ny + j);
       }
     }
 
-    for (const auto& vertex : vertex_to_modify) {
-      for (const auto& edge : getVertexEdges(vertex)) {
-        if (std::ranges::find(vertex_to_modify, edge.m_source)
-                != vertex_to_modify.end()
-            && std::ranges::find(vertex_to_modify, edge.m_target)
-                   != vertex_to_modify.end()) {
-          access.removed_edges.push_back(removeGraphEdge(edge));
-        }
+    // remove intersecting edges
+    for (std::size_t v0 = 0; v0 < vertex_to_modify.size(); v0++) {
+      for (std::size_t v1 = v0 + 1; v1 < vertex_to_modify.size(); v1++) {
+        removeAccessEdge(vertex_to_modify[v0], vertex_to_modify[v1], access);
       }
     }
 
     // add new edges
-    if (addGraphVertex(snap)) {
-      access.added_points.insert(snap);
-    }
+    addAccessVertex(snap, access);
 
     // target to new
-    if (addGraphEdge(snap, target.center, 1.0, false)) {
-      access.added_edges.push_back(Edge{snap, target.center});
-    }
+    addAccessEdge(snap, target.center, false, access);
 
     for (const auto& vertex : vertex_to_modify) {
-      const odb::Point& pt = vertex_point_map_[vertex];
-      if (addGraphEdge(snap, pt)) {
-        access.added_edges.push_back(Edge{snap, pt});
-      }
+      const odb::Point pt = getGridPoint(vertex);
+      footprint.merge(pt);
+      addAccessEdge(snap, pt, true, access);
 
       if (allow45_) {
         // remove accute edges
-        for (const auto& edge : getVertexEdges(vertex)) {
-          bool remove = false;
-
-          const auto other
-              = edge.m_source == vertex ? edge.m_target : edge.m_source;
-          const odb::Point& other_pt = vertex_point_map_[other];
+        neighbors.clear();
+        getGridNeighbors(vertex, neighbors);
+        for (const GridGraphVertex other : neighbors) {
+          const odb::Point other_pt = getGridPoint(other);
+          footprint.merge(other_pt);
+          if (access.hidden_edges.contains(std::minmax(vertex, other))) {
+            continue;
+          }
           if (other_pt == snap) {
             continue;
           }
@@ -1113,6 +1143,7 @@ RDLRouter::TerminalAccess RDLRouter::insertTerminalAccess(
           const int edge_dx = pt.x() - other_pt.x();
           const int edge_dy = pt.y() - other_pt.y();
 
+          bool remove = false;
           if (snap_dy == 0) {
             if ((snap_dx < 0 && edge_dx < 0) || (snap_dx > 0 && edge_dx > 0)) {
               remove = true;
@@ -1124,7 +1155,7 @@ RDLRouter::TerminalAccess RDLRouter::insertTerminalAccess(
           }
 
           if (remove) {
-            access.removed_edges.push_back(removeGraphEdge(edge));
+            removeAccessEdge(vertex, other, access);
           }
         }
       }
@@ -1139,20 +1170,22 @@ RDLRouter::TerminalAccess RDLRouter::insertTerminalAccess(
     gui_->zoomToSnap(false);
     gui_->pause(
         fmt::format("terminal access for {} is inserted into the "
-                    "routing graph, {} edge(s) removed",
+                    "routing graph, {} edge(s) hidden",
                     target.terminal->getName(),
-                    access.removed_edges.size()),
+                    access.hidden_edges.size()),
         !isDebugNet(target.terminal->getNet()) && !isDebugPin(target.terminal));
     gui_->clearSnap();
   }
-
-  return access;
 }
 
-void RDLRouter::uncommitRoute(const std::vector<RDLRouter::GridEdge>& route)
+void RDLRouter::uncommitRoute(const std::vector<GridGraphEdge>& edges)
 {
-  for (const auto& [p0, p1, weight] : route) {
-    addGraphEdge(p0, p1, weight, false, false);
+  for (const auto& [v0, v1] : edges) {
+    GridGraphVertex owner;
+    uint8_t bit;
+    if (getGridEdgeBit(v0, v1, owner, bit)) {
+      grid_edges_[owner] |= bit;
+    }
   }
 }
 
@@ -1175,115 +1208,107 @@ bool RDLRouter::is45DegreeEdge(const odb::Point& pt0,
   return RDLSegment::is45DegreeEdge(pt0, pt1);
 }
 
-GridGraphEdgeSet RDLRouter::getVertexEdges(const GridGraphVertex& vertex) const
+std::vector<GridGraphEdge> RDLRouter::commitRoute(
+    const std::vector<odb::Point>& route)
 {
   GridGraphEdgeSet edges;
 
-  // The graph is undirected, so out_edges already yields every incident edge.
-  GridGraph::out_edge_iterator oit, oend;
-  std::tie(oit, oend) = boost::out_edges(vertex, graph_);
-  for (; oit != oend; oit++) {
-    edges.insert(*oit);
-  }
-
-  return edges;
-}
-
-std::vector<RDLRouter::GridEdge> RDLRouter::commitRoute(
-    const std::vector<GridGraphVertex>& route)
-{
-  GridGraphEdgeSet edges;
-  for (const auto& v : route) {
-    const auto v_edges = getVertexEdges(v);
-    edges.insert(v_edges.begin(), v_edges.end());
-  }
-
   // remove intersecting edges
-  auto handle_rect_edge
-      = [this, &edges](const odb::Rect& rect, const GridGraphEdge& edge) {
-          const odb::Point& lpt0 = vertex_point_map_[edge.m_source];
-          const odb::Point& lpt1 = vertex_point_map_[edge.m_target];
-          if (boost::geometry::intersects(rect, odb::Line(lpt0, lpt1))) {
-            edges.insert(edge);
+  auto remove_edges = [this, &edges](const odb::Rect& box,
+                                     const auto& intersects) {
+    const std::size_t ny = y_grid_.size();
+    std::size_t x_begin, x_end, y_begin, y_end;
+    getGridRange(box, x_begin, x_end, y_begin, y_end);
+    for (std::size_t i = x_begin; i < x_end; i++) {
+      for (std::size_t j = y_begin; j < y_end; j++) {
+        const GridGraphVertex vertex = i * ny + j;
+        const uint8_t bits = grid_edges_[vertex];
+        if (bits == 0) {
+          continue;
+        }
+        const odb::Point pt = getGridPoint(vertex);
+        const std::pair<uint8_t, GridGraphVertex> owned_edges[]
+            = {{kEast, vertex + ny},
+               {kNorth, vertex + 1},
+               {kNorthEast, vertex + ny + 1},
+               {kSouthEast, vertex + ny - 1}};
+        for (const auto& [bit, other] : owned_edges) {
+          if ((bits & bit) != 0
+              && intersects(odb::Line(pt, getGridPoint(other)))) {
+            edges.emplace(vertex, other);
           }
-        };
-
-  for (const auto& v : route) {
-    const odb::Point& pt = vertex_point_map_[v];
-
-    const odb::Rect check_box = getPointObstruction(pt);
-
-    for (auto itr = vertex_grid_tree_.qbegin(
-             boost::geometry::index::intersects(check_box));
-         itr != vertex_grid_tree_.qend();
-         itr++) {
-      for (const auto& edge : getVertexEdges(itr->second)) {
-        handle_rect_edge(check_box, edge);
+        }
       }
     }
+  };
+
+  for (const auto& pt : route) {
+    const odb::Rect check_box = getPointObstruction(pt);
+    remove_edges(check_box, [&check_box](const odb::Line& line) {
+      return boost::geometry::intersects(check_box, line);
+    });
   }
 
   if (allow45_) {
     // remove intersecting edges on 45 degrees
-    auto handle_poly_edge
-        = [this, &edges](const odb::Polygon& poly, const GridGraphEdge& edge) {
-            const odb::Point& lpt0 = vertex_point_map_[edge.m_source];
-            const odb::Point& lpt1 = vertex_point_map_[edge.m_target];
-            if (boost::geometry::intersects(poly, odb::Line(lpt0, lpt1))) {
-              edges.insert(edge);
-            }
-          };
-
     for (std::size_t i = 2; i < route.size(); i++) {
-      const odb::Point& pt0 = vertex_point_map_[route[i - 1]];
-      const odb::Point& pt1 = vertex_point_map_[route[i]];
+      const odb::Point& pt0 = route[i - 1];
+      const odb::Point& pt1 = route[i];
 
       if (!is45DegreeEdge(pt0, pt1)) {
         continue;
       }
 
       const odb::Polygon check_poly = getEdgeObstruction(pt0, pt1);
-
-      for (auto itr = vertex_grid_tree_.qbegin(
-               boost::geometry::index::intersects(check_poly));
-           itr != vertex_grid_tree_.qend();
-           itr++) {
-        for (const auto& edge : getVertexEdges(itr->second)) {
-          handle_poly_edge(check_poly, edge);
-        }
-      }
+      remove_edges(check_poly.getEnclosingRect(),
+                   [&check_poly](const odb::Line& line) {
+                     return boost::geometry::intersects(check_poly, line);
+                   });
     }
   }
 
-  std::vector<GridEdge> removed_edges;
-  removed_edges.reserve(edges.size());
-  for (const auto& edge : edges) {
-    removed_edges.push_back(removeGraphEdge(edge));
+  std::vector<GridGraphEdge> removed_edges(edges.begin(), edges.end());
+  for (const auto& [v0, v1] : removed_edges) {
+    GridGraphVertex owner;
+    uint8_t bit;
+    if (getGridEdgeBit(v0, v1, owner, bit)) {
+      grid_edges_[owner] &= ~bit;
+    }
   }
   return removed_edges;
 }
 
-RDLRouter::GridEdge RDLRouter::removeGraphEdge(const GridGraphEdge& edge)
+odb::Rect RDLRouter::getCommitFootprint(
+    const std::vector<odb::Point>& route,
+    const std::vector<GridGraphEdge>& edges) const
 {
-  const float weight = graph_weight_[edge];
-  boost::remove_edge(edge, graph_);
-
-  return {vertex_point_map_[edge.m_source],
-          vertex_point_map_[edge.m_target],
-          weight
-              / distance(vertex_point_map_[edge.m_source],
-                         vertex_point_map_[edge.m_target])};
+  odb::Rect footprint;
+  footprint.mergeInit();
+  for (const auto& pt : route) {
+    footprint.merge(pt);
+  }
+  for (const auto& [v0, v1] : edges) {
+    footprint.merge(getGridPoint(v0));
+    footprint.merge(getGridPoint(v1));
+  }
+  if (!footprint.isInverted()) {
+    // covers the spacing checks against the route
+    footprint.bloat(width_ + spacing_, footprint);
+  }
+  return footprint;
 }
 
-std::vector<GridGraphVertex> RDLRouter::run(const odb::Point& source,
-                                            const odb::Point& dest)
+std::vector<odb::Point> RDLRouter::run(const odb::Point& source,
+                                       const odb::Point& dest,
+                                       const TerminalAccess& access,
+                                       odb::Rect& footprint) const
 {
-  const int num_vertices = boost::num_vertices(graph_);
-  std::vector<GridGraphVertex> p(num_vertices);
-  std::vector<int64_t> d(num_vertices);
-
-  const GridGraphVertex& start = point_vertex_map_[source];
-  const GridGraphVertex& goal = point_vertex_map_[dest];
+  GridGraphVertex start = 0;
+  GridGraphVertex goal = 0;
+  if (!findGraphVertex(source, access, start)
+      || !findGraphVertex(dest, access, goal)) {
+    return {};
+  }
 
   debugPrint(logger_,
              utl::PAD,
@@ -1295,31 +1320,126 @@ std::vector<GridGraphVertex> RDLRouter::run(const odb::Point& source,
              dest.x(),
              dest.y());
 
-  try {
-    // call astar named parameter interface
-    boost::astar_search_tree(
-        graph_,
-        start,
-        RDLRouterDistanceHeuristic(
-            vertex_point_map_, p, start, dest, turn_penalty_),
-        boost::predecessor_map(
-            boost::make_iterator_property_map(
-                p.begin(), boost::get(boost::vertex_index, graph_)))
-            .distance_map(boost::make_iterator_property_map(
-                d.begin(), boost::get(boost::vertex_index, graph_)))
-            .visitor(RDLRouterGoalVisitor<GridGraphVertex>(goal)));
-  } catch (const RDLRouterGoalFound&) {  // found a path to the goal
-    std::list<GridGraphVertex> shortest_path;
-    for (GridGraphVertex v = goal;; v = p[v]) {
-      shortest_path.push_front(v);
-      if (p[v] == v) {
-        break;
+  // An edge costs at least its longest side, and an orthogonal edge at
+  // least its length, so the estimate never exceeds the remaining cost.
+  auto estimate = [this, &dest](const odb::Point& pt) -> int64_t {
+    const int64_t dx = std::abs(dest.x() - pt.x());
+    const int64_t dy = std::abs(dest.y() - pt.y());
+    if (allow45_) {
+      return std::max(dx, dy);
+    }
+    return dx + dy;
+  };
+
+  struct Node
+  {
+    int64_t cost;
+    GridGraphVertex parent;
+    bool closed;
+  };
+  struct QueueEntry
+  {
+    int64_t total;
+    int64_t remaining;
+    uint64_t sequence;
+    int64_t cost;
+    GridGraphVertex vertex;
+  };
+  // lowest total first, then closest to the goal, then first reached
+  auto queue_compare = [](const QueueEntry& lhs, const QueueEntry& rhs) {
+    return std::tie(lhs.total, lhs.remaining, lhs.sequence)
+           > std::tie(rhs.total, rhs.remaining, rhs.sequence);
+  };
+  std::priority_queue<QueueEntry,
+                      std::vector<QueueEntry>,
+                      decltype(queue_compare)>
+      queue(queue_compare);
+  std::unordered_map<GridGraphVertex, Node> nodes;
+  uint64_t sequence = 0;
+
+  nodes[start] = Node{0, start, false};
+  queue.push({estimate(source), estimate(source), sequence++, 0, start});
+  footprint.merge(source);
+
+  std::vector<GridGraphVertex> neighbors;
+  while (!queue.empty()) {
+    const QueueEntry entry = queue.top();
+    queue.pop();
+
+    Node& node = nodes.at(entry.vertex);
+    // skip entries made stale by a cheaper path to the vertex
+    if (node.closed || node.cost != entry.cost) {
+      continue;
+    }
+    node.closed = true;
+
+    const GridGraphVertex vertex = entry.vertex;
+    if (vertex == goal) {
+      std::vector<odb::Point> route;
+      for (GridGraphVertex v = goal;; v = nodes.at(v).parent) {
+        route.push_back(getVertexPoint(v, access));
+        if (v == start) {
+          break;
+        }
       }
+      std::ranges::reverse(route);
+      return route;
     }
 
-    std::vector<GridGraphVertex> route(shortest_path.begin(),
-                                       shortest_path.end());
-    return route;
+    // north, south, west, east, the diagonals, then the terminal access
+    neighbors.clear();
+    if (vertex < num_grid_vertices_) {
+      getGridNeighbors(vertex, neighbors);
+      std::erase_if(neighbors, [&](const GridGraphVertex other) {
+        return access.hidden_edges.contains(std::minmax(vertex, other));
+      });
+    }
+    const auto access_edges = access.edges.find(vertex);
+    if (access_edges != access.edges.end()) {
+      neighbors.insert(neighbors.end(),
+                       access_edges->second.begin(),
+                       access_edges->second.end());
+    }
+
+    const odb::Point pt = getVertexPoint(vertex, access);
+    // the access stubs at the source turn onto the grid for free
+    const bool check_turn = vertex != start && node.parent != start;
+    const odb::Point prev_pt
+        = check_turn ? getVertexPoint(node.parent, access) : pt;
+    const odb::Point incoming_vec(pt.x() - prev_pt.x(), pt.y() - prev_pt.y());
+    for (const GridGraphVertex next : neighbors) {
+      const odb::Point next_pt = getVertexPoint(next, access);
+      footprint.merge(next_pt);
+
+      const int64_t direction_bias = pt.y() == next_pt.y() ? 1 : 0;
+      const int64_t cost = node.cost + distance(pt, next_pt) + direction_bias;
+
+      const auto [itr, inserted]
+          = nodes.try_emplace(next, Node{cost, vertex, false});
+      if (!inserted) {
+        Node& next_node = itr->second;
+        if (next_node.cost <= cost) {
+          continue;
+        }
+        // the turn penalty can close a vertex before its cheapest path is
+        // known, so reopen it
+        next_node.cost = cost;
+        next_node.parent = vertex;
+        next_node.closed = false;
+      }
+
+      // Turns delay the expansion of the vertex they lead to, rather than
+      // adding to its cost, to prefer straighter routes among the short ones.
+      int64_t penalty = 0;
+      const odb::Point outgoing_vec(next_pt.x() - pt.x(), next_pt.y() - pt.y());
+      if (check_turn && incoming_vec != outgoing_vec) {
+        penalty = turn_penalty_ * distance(prev_pt, pt);
+      }
+
+      const int64_t remaining = estimate(next_pt);
+      queue.push(
+          {cost + remaining + penalty, remaining, sequence++, cost, next});
+    }
   }
 
   return {};
@@ -1327,11 +1447,7 @@ std::vector<GridGraphVertex> RDLRouter::run(const odb::Point& source,
 
 void RDLRouter::makeGraph()
 {
-  point_vertex_map_.clear();
-  vertex_point_map_.clear();
-  graph_.clear();
-
-  graph_weight_ = boost::get(boost::edge_weight, graph_);
+  grid_edges_.clear();
 
   odb::dbTrackGrid* tracks = block_->findTrackGrid(layer_);
 
@@ -1373,82 +1489,71 @@ void RDLRouter::makeGraph()
     }
   }
 
-  for (const auto& x : x_grid_) {
-    for (const auto& y : y_grid_) {
-      addGraphVertex(odb::Point(x, y));
-    }
-  }
+  const std::size_t nx = x_grid_.size();
+  const std::size_t ny = y_grid_.size();
+  num_grid_vertices_ = nx * ny;
+  grid_edges_.resize(num_grid_vertices_, 0);
 
   debugPrint(logger_,
              utl::PAD,
              "Router",
              1,
              "Added {} vertices to graph",
-             boost::num_vertices(graph_));
-
-  for (size_t i = 0; i < x_grid_.size(); i++) {
-    for (size_t j = 0; j < y_grid_.size(); j++) {
-      const odb::Point center(x_grid_[i], y_grid_[j]);
+             num_grid_vertices_);
+
+  // columns only write the edges they own
+  auto make_column = [this, nx, ny](const std::size_t i) {
+    for (std::size_t j = 0; j < ny; j++) {
+      const GridGraphVertex vertex = i * ny + j;
+      const odb::Point center = getGridPoint(vertex);
+      uint8_t& bits = grid_edges_[vertex];
+
+      auto add_edge = [&](const uint8_t bit, const GridGraphVertex other) {
+        if (!isEdgeObstructed(center, getGridPoint(other), false)) {
+          bits |= bit;
+        }
+      };
 
-      if (j + 1 < y_grid_.size()) {
-        addGraphEdge(center, {x_grid_[i], y_grid_[j + 1]});
-      }
-      if (j != 0) {
-        addGraphEdge(center, {x_grid_[i], y_grid_[j - 1]});
+      if (i + 1 < nx) {
+        add_edge(kEast, vertex + ny);
       }
-      if (i != 0) {
-        addGraphEdge(center, {x_grid_[i - 1], y_grid_[j]});
-      }
-      if (i + 1 < x_grid_.size()) {
-        addGraphEdge(center, {x_grid_[i + 1], y_grid_[j]});
+      if (j + 1 < ny) {
+        add_edge(kNorth, vertex + 1);
       }
 
-      if (allow45_) {
-        if (i % 2 == 1 || j % 2 == 1) {
-          // only do every other position
-          continue;
-        }
-        if (i + 1 < x_grid_.size() && j + 1 < y_grid_.size()) {
-          addGraphEdge(center, {x_grid_[i + 1], y_grid_[j + 1]});
-        }
-        if (i + 1 < x_grid_.size() && j != 0) {
-          addGraphEdge(center, {x_grid_[i + 1], y_grid_[j - 1]});
-        }
-        if (i != 0 && j + 1 < y_grid_.size()) {
-          addGraphEdge(center, {x_grid_[i - 1], y_grid_[j + 1]});
+      // diagonals only start from every other position, so the ones stored
+      // here have both ends on even or both ends on odd positions
+      if (allow45_ && i % 2 == j % 2 && i + 1 < nx) {
+        if (j + 1 < ny) {
+          add_edge(kNorthEast, vertex + ny + 1);
         }
-        if (i != 0 && j != 0) {
-          addGraphEdge(center, {x_grid_[i - 1], y_grid_[j - 1]});
+        if (j != 0) {
+          add_edge(kSouthEast, vertex + ny - 1);
         }
       }
     }
-  }
-
-  // Create a deterministic ordering of map entries to ensure consistent R-tree
-  // structure
-  std::vector<std::pair<odb::Point, GridGraphVertex>> sorted_entries(
-      point_vertex_map_.begin(), point_vertex_map_.end());
-  std::ranges::sort(sorted_entries);
-
-  std::vector<GridValue> grid_tree;
-  grid_tree.reserve(sorted_entries.size());
+  };
 
-  for (const auto& [point, vertex] : sorted_entries) {
-    odb::Rect rect(point, point);
-    for (const auto& edge : getVertexEdges(vertex)) {
-      rect.merge(odb::Rect(vertex_point_map_[edge.m_source],
-                           vertex_point_map_[edge.m_target]));
-    }
-    grid_tree.emplace_back(rect, vertex);
+  std::vector<std::size_t> columns(nx);
+  std::iota(columns.begin(), columns.end(), 0);
+  if (num_threads_ > 1) {
+    utl::ThreadPool pool(num_threads_);
+    pool.parallelFor(columns, make_column);
+  } else {
+    std::ranges::for_each(columns, make_column);
   }
-  vertex_grid_tree_ = GridTree(grid_tree.begin(), grid_tree.end());
 
   debugPrint(logger_,
              utl::PAD,
              "Router",
              1,
              "Added {} edges to graph",
-             boost::num_edges(graph_));
+             std::accumulate(grid_edges_.begin(),
+                             grid_edges_.end(),
+                             std::size_t{0},
+                             [](const std::size_t count, const uint8_t bits) {
+                               return count + std::popcount(bits);
+                             }));
 }
 
 bool RDLRouter::isEdgeObstructed(const odb::Point& pt0,
@@ -1485,55 +1590,71 @@ bool RDLRouter::isEdgeObstructed(const odb::Point& pt0,
   return false;
 }
 
-bool RDLRouter::addGraphVertex(const odb::Point& point)
+odb::Point RDLRouter::getGridPoint(const GridGraphVertex vertex) const
 {
-  if (point_vertex_map_.find(point) != point_vertex_map_.end()) {
-    return false;
+  return {x_grid_[vertex / y_grid_.size()], y_grid_[vertex % y_grid_.size()]};
+}
+
+odb::Point RDLRouter::getVertexPoint(const GridGraphVertex vertex,
+                                     const TerminalAccess& access) const
+{
+  if (vertex < num_grid_vertices_) {
+    return getGridPoint(vertex);
   }
+  return access.points[vertex - num_grid_vertices_];
+}
 
-  auto idx = boost::add_vertex(graph_);
-  debugPrint(logger_,
-             utl::PAD,
-             "Router_vertex",
-             1,
-             "Adding point ({}, {}) as vertex {}",
-             point.x(),
-             point.y(),
-             idx);
-  point_vertex_map_[point] = idx;
-  vertex_point_map_[idx] = point;
+bool RDLRouter::findGraphVertex(const odb::Point& point,
+                                const TerminalAccess& access,
+                                GridGraphVertex& vertex) const
+{
+  const auto x_itr = std::ranges::lower_bound(x_grid_, point.x());
+  const auto y_itr = std::ranges::lower_bound(y_grid_, point.y());
+  if (num_grid_vertices_ > 0 && x_itr != x_grid_.end() && *x_itr == point.x()
+      && y_itr != y_grid_.end() && *y_itr == point.y()) {
+    vertex = std::distance(x_grid_.begin(), x_itr) * y_grid_.size()
+             + std::distance(y_grid_.begin(), y_itr);
+    return true;
+  }
 
+  const auto find_point = std::ranges::find(access.points, point);
+  if (find_point == access.points.end()) {
+    return false;
+  }
+  vertex = num_grid_vertices_
+           + std::distance(access.points.begin(), find_point);
   return true;
 }
 
-void RDLRouter::removeGraphVertex(const odb::Point& point)
+GridGraphVertex RDLRouter::addAccessVertex(const odb::Point& point,
+                                           TerminalAccess& access) const
 {
-  auto find_idx = point_vertex_map_.find(point);
-  if (find_idx == point_vertex_map_.end()) {
-    return;
+  GridGraphVertex vertex;
+  if (findGraphVertex(point, access, vertex)) {
+    return vertex;
   }
 
-  auto idx = find_idx->second;
+  vertex = num_grid_vertices_ + access.points.size();
   debugPrint(logger_,
              utl::PAD,
              "Router_vertex",
              1,
-             "Removing point ({}, {}) as vertex {}",
+             "Adding point ({}, {}) as vertex {}",
              point.x(),
              point.y(),
-             idx);
-  point_vertex_map_.erase(point);
-  vertex_point_map_.erase(idx);
+             vertex);
+  access.points.push_back(point);
+
+  return vertex;
 }
 
-bool RDLRouter::addGraphEdge(const odb::Point& point0,
-                             const odb::Point& point1,
-                             float edge_weight_scale,
-                             bool check_obstructions,
-                             bool check_routes)
+bool RDLRouter::addAccessEdge(const odb::Point& point0,
+                              const odb::Point& point1,
+                              bool check_obstructions,
+                              TerminalAccess& access) const
 {
-  auto point0check = point_vertex_map_.find(point0);
-  if (point0check == point_vertex_map_.end()) {
+  GridGraphVertex v0;
+  if (!findGraphVertex(point0, access, v0)) {
     debugPrint(logger_,
                utl::PAD,
                "Router_edge",
@@ -1543,8 +1664,8 @@ bool RDLRouter::addGraphEdge(const odb::Point& point0,
                point0.y());
     return false;
   }
-  auto point1check = point_vertex_map_.find(point1);
-  if (point1check == point_vertex_map_.end()) {
+  GridGraphVertex v1;
+  if (!findGraphVertex(point1, access, v1)) {
     debugPrint(logger_,
                utl::PAD,
                "Router_edge",
@@ -1554,13 +1675,11 @@ bool RDLRouter::addGraphEdge(const odb::Point& point0,
                point1.y());
     return false;
   }
-  GridGraphVertex v0 = point0check->second;
-  GridGraphVertex v1 = point1check->second;
   if (v0 == v1) {
     return false;
   }
 
-  if (check_obstructions && isEdgeObstructed(point0, point1, check_routes)) {
+  if (check_obstructions && isEdgeObstructed(point0, point1, true)) {
     debugPrint(logger_,
                utl::PAD,
                "Router_edge",
@@ -1573,41 +1692,184 @@ bool RDLRouter::addGraphEdge(const odb::Point& point0,
     return false;
   }
 
-  bool added;
-  GridGraphEdge edge;
-
-  // For undirected graphs, we only need to check one direction
-  // since edge (v0, v1) is the same as edge (v1, v0)
-  bool exists;
-  boost::tie(edge, exists) = boost::lookup_edge(v0, v1, graph_);
-  if (exists) {
+  if (access.hidden_edges.erase(std::minmax(v0, v1)) > 0
+      || isGridEdgeOpen(v0, v1)) {
     return true;
   }
 
-  boost::tie(edge, added) = boost::add_edge(v0, v1, graph_);
-  if (!added) {
-    return false;
+  auto& edges0 = access.edges[v0];
+  if (std::ranges::find(edges0, v1) != edges0.end()) {
+    return true;
   }
-
-  const int64_t direction_bias = point0.y() == point1.y() ? 1 : 0;
-  const int64_t weight
-      = edge_weight_scale * distance(point0, point1) + direction_bias;
+  edges0.push_back(v1);
+  access.edges[v1].push_back(v0);
 
   debugPrint(logger_,
              utl::PAD,
              "Router_edge",
              1,
-             "Adding edge from ({}, {}) to ({}, {}) with weight {}",
+             "Adding edge from ({}, {}) to ({}, {})",
              point0.x(),
              point0.y(),
              point1.x(),
-             point1.y(),
-             weight);
-  graph_weight_[edge] = weight;
+             point1.y());
+
+  return true;
+}
 
+void RDLRouter::removeAccessEdge(const GridGraphVertex v0,
+                                 const GridGraphVertex v1,
+                                 TerminalAccess& access) const
+{
+  if (isGridEdgeOpen(v0, v1)) {
+    access.hidden_edges.insert(std::minmax(v0, v1));
+  }
+
+  for (const auto& [vertex, other] : {std::pair(v0, v1), std::pair(v1, v0)}) {
+    const auto edges = access.edges.find(vertex);
+    if (edges != access.edges.end()) {
+      std::erase(edges->second, other);
+    }
+  }
+}
+
+bool RDLRouter::getGridEdgeBit(const GridGraphVertex v0,
+                               const GridGraphVertex v1,
+                               GridGraphVertex& owner,
+                               uint8_t& bit) const
+{
+  if (v0 >= num_grid_vertices_ || v1 >= num_grid_vertices_) {
+    return false;
+  }
+
+  // the edge is stored on the vertex with the lower x, or lower y when
+  // vertical, which is also the lower vertex
+  const auto [lower, upper] = std::minmax(v0, v1);
+  const std::size_t ny = y_grid_.size();
+  const std::size_t i0 = lower / ny;
+  const std::size_t j0 = lower % ny;
+  const std::size_t i1 = upper / ny;
+  const std::size_t j1 = upper % ny;
+
+  owner = lower;
+  if (i0 == i1 && j0 + 1 == j1) {
+    bit = kNorth;
+  } else if (i0 + 1 != i1) {
+    return false;
+  } else if (j0 == j1) {
+    bit = kEast;
+  } else if (j0 + 1 == j1) {
+    bit = kNorthEast;
+  } else if (j0 == j1 + 1) {
+    bit = kSouthEast;
+  } else {
+    return false;
+  }
   return true;
 }
 
+bool RDLRouter::isGridEdgeOpen(const GridGraphVertex v0,
+                               const GridGraphVertex v1) const
+{
+  GridGraphVertex owner;
+  uint8_t bit;
+  return getGridEdgeBit(v0, v1, owner, bit) && (grid_edges_[owner] & bit) != 0;
+}
+
+void RDLRouter::getGridNeighbors(const GridGraphVertex vertex,
+                                 std::vector<GridGraphVertex>& neighbors) const
+{
+  const std::size_t ny = y_grid_.size();
+  const std::size_t i = vertex / ny;
+  const std::size_t j = vertex % ny;
+
+  // north, south, west, east, then north east, south east, north west and
+  // south west
+  if ((grid_edges_[vertex] & kNorth) != 0) {
+    neighbors.push_back(vertex + 1);
+  }
+  if (j > 0 && (grid_edges_[vertex - 1] & kNorth) != 0) {
+    neighbors.push_back(vertex - 1);
+  }
+  if (i > 0 && (grid_edges_[vertex - ny] & kEast) != 0) {
+    neighbors.push_back(vertex - ny);
+  }
+  if ((grid_edges_[vertex] & kEast) != 0) {
+    neighbors.push_back(vertex + ny);
+  }
+  if ((grid_edges_[vertex] & kNorthEast) != 0) {
+    neighbors.push_back(vertex + ny + 1);
+  }
+  if ((grid_edges_[vertex] & kSouthEast) != 0) {
+    neighbors.push_back(vertex + ny - 1);
+  }
+  if (i > 0 && j + 1 < ny && (grid_edges_[vertex - ny + 1] & kSouthEast) != 0) {
+    neighbors.push_back(vertex - ny + 1);
+  }
+  if (i > 0 && j > 0 && (grid_edges_[vertex - ny - 1] & kNorthEast) != 0) {
+    neighbors.push_back(vertex - ny - 1);
+  }
+}
+
+void RDLRouter::getGridRange(const odb::Rect& box,
+                             std::size_t& x_begin,
+                             std::size_t& x_end,
+                             std::size_t& y_begin,
+                             std::size_t& y_end) const
+{
+  // one more vertex on each side to include the edges crossing the box
+  auto get_range = [](const std::vector<int>& grid,
+                      const int low,
+                      const int high,
+                      std::size_t& begin,
+                      std::size_t& end) {
+    begin = std::distance(grid.begin(), std::ranges::lower_bound(grid, low));
+    end = std::distance(grid.begin(), std::ranges::upper_bound(grid, high));
+    begin = begin > 0 ? begin - 1 : 0;
+    end = std::min(end + 1, grid.size());
+  };
+  get_range(x_grid_, box.xMin(), box.xMax(), x_begin, x_end);
+  get_range(y_grid_, box.yMin(), box.yMax(), y_begin, y_end);
+}
+
+std::vector<odb::Point> RDLRouter::getGridPoints(const odb::Rect& box) const
+{
+  std::vector<odb::Point> points;
+  std::size_t x_begin, x_end, y_begin, y_end;
+  getGridRange(box, x_begin, x_end, y_begin, y_end);
+  for (std::size_t i = x_begin; i < x_end; i++) {
+    for (std::size_t j = y_begin; j < y_end; j++) {
+      const odb::Point pt = getGridPoint(i * y_grid_.size() + j);
+      if (box.intersects(pt)) {
+        points.push_back(pt);
+      }
+    }
+  }
+  return points;
+}
+
+std::vector<RDLRouter::Edge> RDLRouter::getGridEdges(const odb::Rect& box) const
+{
+  std::vector<Edge> edges;
+  std::size_t x_begin, x_end, y_begin, y_end;
+  getGridRange(box, x_begin, x_end, y_begin, y_end);
+  std::vector<GridGraphVertex> neighbors;
+  for (std::size_t i = x_begin; i < x_end; i++) {
+    for (std::size_t j = y_begin; j < y_end; j++) {
+      const GridGraphVertex vertex = i * y_grid_.size() + j;
+      const odb::Point pt = getGridPoint(vertex);
+      neighbors.clear();
+      getGridNeighbors(vertex, neighbors);
+      for (const GridGraphVertex other : neighbors) {
+        if (vertex < other) {
+          edges.push_back(Edge{pt, getGridPoint(other)});
+        }
+      }
+    }
+  }
+  return edges;
+}
+
 std::vector<std::pair<odb::Point, odb::Point>> RDLRouter::simplifyRoute(
     const std::vector<odb::Point>& route) const
 {
@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -16,7 +16,6 @@
 
 #include "boost/geometry/geometry.hpp"
 #include "boost/geometry/index/rtree.hpp"
-#include "boost/graph/adjacency_list.hpp"
 #include "gui/gui.h"
 #include "odb/PtrSetMap.h"
 #include "odb/db.h"
@@ -58,29 +57,12 @@ class RDLRouter;
 class RDLNet;
 class RDLSegment;
 
-using GridGraph
-    = boost::adjacency_list<boost::listS,
-                            boost::vecS,
-                            boost::undirectedS,
-                            boost::no_property,
-                            boost::property<boost::edge_weight_t, int64_t>>;
-
-using GridWeightMap
-    = boost::property_map<GridGraph, boost::edge_weight_t>::type;
-using GridGraphVertex = GridGraph::vertex_descriptor;
-using GridGraphEdge = GridGraph::edge_descriptor;
-
-// Order edges by (source, target) vertex indices; the descriptor's default
-// operator< compares a heap pointer, giving build-dependent iteration.
-struct GridGraphEdgeLess
-{
-  bool operator()(const GridGraphEdge& lhs, const GridGraphEdge& rhs) const
-  {
-    return std::minmax(lhs.m_source, lhs.m_target)
-           < std::minmax(rhs.m_source, rhs.m_target);
-  }
-};
-using GridGraphEdgeSet = std::set<GridGraphEdge, GridGraphEdgeLess>;
+// Vertices of the routing grid are numbered x major, the terminal access
+// vertices of a route attempt follow them.
+using GridGraphVertex = std::size_t;
+// Ordered with the lower vertex first.
+using GridGraphEdge = std::pair<GridGraphVertex, GridGraphVertex>;
+using GridGraphEdgeSet = std::set<GridGraphEdge>;
 
 struct RouteTarget
 {
@@ -108,29 +90,30 @@ class RDLRouter
     odb::Point pt0;
     odb::Point pt1;
   };
-  struct GridEdge
-  {
-    odb::Point source;
-    odb::Point target;
-    float weight;
-  };
-  struct NetRoute
-  {
-    std::vector<GridGraphVertex> route;
-    std::vector<GridEdge> removed_edges;
-    const RouteTarget* source;
-    const RouteTarget* target;
-  };
   struct ITermRouteOrder
   {
     std::vector<odb::dbITerm*> terminals;
     std::vector<odb::dbITerm*>::iterator next;
   };
+  // Terminal access of one route attempt, layered over the routing grid
+  // without changing it.
   struct TerminalAccess
   {
-    std::vector<GridEdge> removed_edges;
-    std::vector<Edge> added_edges;
-    std::set<odb::Point> added_points;
+    // locations of the access vertices, numbered after the grid vertices
+    std::vector<odb::Point> points;
+    // edges added by the access, in the order they were added
+    std::map<GridGraphVertex, std::vector<GridGraphVertex>> edges;
+    // grid edges which cannot be used while the access is in place
+    GridGraphEdgeSet hidden_edges;
+  };
+  struct RouteAttempt
+  {
+    std::vector<odb::Point> route;
+    const RouteTarget* source = nullptr;
+    const RouteTarget* target = nullptr;
+    // area read by the attempt, a route committed inside it can change
+    // the result
+    odb::Rect footprint;
   };
 
   using NetRoutingTargetMap
@@ -164,16 +147,9 @@ class RDLRouter
       = boost::geometry::index::rtree<ObsValue,
                                       boost::geometry::index::quadratic<16>>;
 
-  using GridValue = std::pair<odb::Rect, GridGraphVertex>;
-  using GridTree
-      = boost::geometry::index::rtree<GridValue,
-                                      boost::geometry::index::quadratic<16>>;
-
-  const GridGraph& getGraph() const { return graph_; };
-  const std::unordered_map<GridGraphVertex, odb::Point>& getVertexMap() const
-  {
-    return vertex_point_map_;
-  }
+  // Grid points and open grid edges touching the box
+  std::vector<odb::Point> getGridPoints(const odb::Rect& box) const;
+  std::vector<Edge> getGridEdges(const odb::Rect& box) const;
   const ObsTree& getObstructions() const { return obstructions_; }
   const NetRoutingTargetMap& getRoutingTargets() const
   {
@@ -183,6 +159,7 @@ class RDLRouter
   std::vector<RDLSegment*> getFailedRoutes() const;
 
   void setRDLGui(RDLGui* gui) { gui_ = gui; }
+  void setNumThreads(int threads) { num_threads_ = threads; }
   void setRDLDebugNet(odb::dbNet* net) { debug_net_ = net; }
   void setRDLDebugPin(odb::dbITerm* term) { debug_pin_ = term; }
 
@@ -195,19 +172,43 @@ class RDLRouter
 
  private:
   void makeGraph();
-  bool addGraphVertex(const odb::Point& point);
-  void removeGraphVertex(const odb::Point& point);
-  bool addGraphEdge(const odb::Point& point0,
-                    const odb::Point& point1,
-                    float edge_weight_scale = 1.0,
-                    bool check_obstructions = true,
-                    bool check_routes = true);
-  GridEdge removeGraphEdge(const GridGraphEdge& edge);
-
-  std::vector<GridGraphVertex> run(const odb::Point& source,
-                                   const odb::Point& dest);
-  std::vector<GridEdge> commitRoute(const std::vector<GridGraphVertex>& route);
-  void uncommitRoute(const std::vector<GridEdge>& route);
+  odb::Point getGridPoint(GridGraphVertex vertex) const;
+  odb::Point getVertexPoint(GridGraphVertex vertex,
+                            const TerminalAccess& access) const;
+  bool findGraphVertex(const odb::Point& point,
+                       const TerminalAccess& access,
+                       GridGraphVertex& vertex) const;
+  GridGraphVertex addAccessVertex(const odb::Point& point,
+                                  TerminalAccess& access) const;
+  bool addAccessEdge(const odb::Point& point0,
+                     const odb::Point& point1,
+                     bool check_obstructions,
+                     TerminalAccess& access) const;
+  void removeAccessEdge(GridGraphVertex v0,
+                        GridGraphVertex v1,
+                        TerminalAccess& access) const;
+  bool isGridEdgeOpen(GridGraphVertex v0, GridGraphVertex v1) const;
+  bool getGridEdgeBit(GridGraphVertex v0,
+                      GridGraphVertex v1,
+                      GridGraphVertex& owner,
+                      uint8_t& bit) const;
+  void getGridNeighbors(GridGraphVertex vertex,
+                        std::vector<GridGraphVertex>& neighbors) const;
+  void getGridRange(const odb::Rect& box,
+                    std::size_t& x_begin,
+                    std::size_t& x_end,
+                    std::size_t& y_begin,
+                    std::size_t& y_end) const;
+
+  RouteAttempt findRoute(const std::vector<TargetPair>& targets) const;
+  std::vector<odb::Point> run(const odb::Point& source,
+                              const odb::Point& dest,
+                              const TerminalAccess& access,
+                              odb::Rect& footprint) const;
+  std::vector<GridGraphEdge> commitRoute(const std::vector<odb::Point>& route);
+  void uncommitRoute(const std::vector<GridGraphEdge>& edges);
+  odb::Rect getCommitFootprint(const std::vector<odb::Point>& route,
+                               const std::vector<GridGraphEdge>& edges) const;
 
   void writeToDb(odb::dbNet* net,
                  const std::vector<odb::Point>& route,
@@ -235,14 +236,15 @@ class RDLRouter
       const std::unordered_map<odb::Point, GridGraphEdgeSet>& edges);
   std::set<odb::Point> generateTerminalAccessPoints(const odb::Point& pt,
                                                     bool do_x) const;
-  TerminalAccess insertTerminalAccess(const RouteTarget& target,
-                                      const RouteTarget& source);
-  void removeTerminalAccess(const TerminalAccess& access);
+  void insertTerminalAccess(const RouteTarget& target,
+                            TerminalAccess& access,
+                            odb::Rect& footprint) const;
+  std::vector<TargetPair> getTargetPairs(odb::dbITerm* src,
+                                         odb::dbITerm* dst) const;
 
   odb::PtrMap<odb::dbITerm, std::vector<RouteTarget>> generateRoutingTargets(
       odb::dbNet* net) const;
   odb::dbTechLayer* getOtherLayer(odb::dbTechVia* via) const;
-  GridGraphEdgeSet getVertexEdges(const GridGraphVertex& vertex) const;
 
   void buildIntialRouteSet();
   int reportFailedRoutes() const;
@@ -265,17 +267,24 @@ class RDLRouter
   bool fixed_;
   float turn_penalty_;
   int max_router_iterations_;
+  int num_threads_ = 1;
 
   const odb::PtrMap<odb::dbITerm, odb::dbITerm*>& routing_map_;
 
-  GridGraph graph_;
-  GridWeightMap graph_weight_;
+  // Open edges of the routing grid, one bit per edge.  An edge is stored on
+  // its lower vertex and is cleared when it is blocked by an obstruction or
+  // occupied by a committed route.
+  static constexpr uint8_t kEast = 1;
+  static constexpr uint8_t kNorth = 2;
+  static constexpr uint8_t kNorthEast = 4;
+  static constexpr uint8_t kSouthEast = 8;
+  std::vector<uint8_t> grid_edges_;
   ObsTree obstructions_;
 
   // Lookup tables
-  std::unordered_map<odb::Point, GridGraphVertex> point_vertex_map_;
-  GridTree vertex_grid_tree_;
-  std::unordered_map<GridGraphVertex, odb::Point> vertex_point_map_;
+  // The x_grid_.size() * y_grid_.size() vertices of the routing grid are
+  // numbered x major and their locations are implied by their number.
+  GridGraphVertex num_grid_vertices_{0};
   odb::PtrMap<odb::dbITerm, std::vector<Edge>> iterm_edges_;
 
   // Routing grid
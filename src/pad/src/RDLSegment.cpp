@@ -8,7 +8,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -99,6 +98,16 @@ odb::dbITerm* RDLSegment::getNextDestinationTerminal()
   return dst;
 }
 
+odb::dbITerm* RDLSegment::peakNextDestinationTerminal() const
+{
+  for (auto itr = next_; itr != terminals_.end(); itr++) {
+    if (!net_->isNonCoverRouted(*itr) && !net_->isRouted(iterm_, *itr)) {
+      return *itr;
+    }
+  }
+  return nullptr;
+}
+
 bool RDLSegment::compare(const RDLSegment* other) const
 {
   const auto lhs_priority = -getPriority();
@@ -124,36 +133,15 @@ bool RDLSegment::compare(const RDLSegment* other) const
   return lhs_dist > rhs_dist;
 }
 
-void RDLSegment::setRoute(
-    const std::unordered_map<GridGraphVertex, odb::Point>& vertex_point_map,
-    const std::vector<GridGraphVertex>& vertex,
-    const std::vector<RDLRouter::GridEdge>& removed_edges,
-    const RouteTarget* source,
-    const RouteTarget* target,
-    const RDLRouter::TerminalAccess& access_source,
-    const RDLRouter::TerminalAccess& access_dest)
+void RDLSegment::setRoute(const std::vector<odb::Point>& route,
+                          const std::vector<GridGraphEdge>& removed_edges,
+                          const RouteTarget* source,
+                          const RouteTarget* target)
 {
-  route_vertex_ = vertex;
-  for (const auto& vertex : route_vertex_) {
-    route_pts_.push_back(vertex_point_map.at(vertex));
-  }
+  route_pts_ = route;
   route_edges_ = removed_edges;
   route_source_ = source;
   route_dest_ = target;
-  access_source_ = access_source;
-  access_dest_ = access_dest;
-
-  // Forward removed edges from access
-  for (const auto& edge : access_source_.removed_edges) {
-    if (contains(edge.source) || contains(edge.target)) {
-      route_edges_.push_back(edge);
-    }
-  }
-  for (const auto& edge : access_dest_.removed_edges) {
-    if (contains(edge.source) || contains(edge.target)) {
-      route_edges_.push_back(edge);
-    }
-  }
 
   setRouted();
   net_->updateRoute(this);
@@ -168,14 +156,11 @@ void RDLSegment::resetRoute()
   routed_ = false;
   net_->updateRoute(this);
 
-  route_vertex_.clear();
   route_pts_.clear();
   route_edges_.clear();
   route_source_ = nullptr;
   route_dest_ = nullptr;
   route_pending_ = true;
-  access_source_ = {};
-  access_dest_ = {};
 
   next_ = terminals_.begin();
 }
@@ -306,11 +291,6 @@ bool RDLSegment::is45DegreeEdge(const odb::Point& pt0, const odb::Point& pt1)
   return pt0.x() != pt1.x() && pt0.y() != pt1.y();
 }
 
-bool RDLSegment::contains(const odb::Point& pt) const
-{
-  return std::ranges::find(route_pts_, pt) != route_pts_.end();
-}
-
 void RDLSegment::preprocess(odb::dbTechLayer* layer, utl::Logger* logger)
 {
   using boost::polygon::operators::operator+=;
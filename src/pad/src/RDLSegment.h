@@ -5,7 +5,6 @@
 
 #include <memory>
 #include <set>
-#include <unordered_map>
 #include <vector>
 
 #include "RDLRouter.h"
@@ -31,14 +30,10 @@ class RDLSegment
   RDLNet* getRDLNet() const { return net_; }
   odb::dbNet* getNet() const;
 
-  void setRoute(
-      const std::unordered_map<GridGraphVertex, odb::Point>& vertex_point_map,
-      const std::vector<GridGraphVertex>& vertex,
-      const std::vector<RDLRouter::GridEdge>& removed_edges,
-      const RouteTarget* source,
-      const RouteTarget* target,
-      const RDLRouter::TerminalAccess& access_source,
-      const RDLRouter::TerminalAccess& access_dest);
+  void setRoute(const std::vector<odb::Point>& route,
+                const std::vector<GridGraphEdge>& removed_edges,
+                const RouteTarget* source,
+                const RouteTarget* target);
   void resetRoute();
 
   void reportRoutePairs(utl::Logger* logger) const;
@@ -71,29 +66,20 @@ class RDLSegment
   odb::dbITerm* getNextTerminal();
   odb::dbITerm* peakNextTerminal() const;
   odb::dbITerm* getNextDestinationTerminal();
+  // The terminal getNextDestinationTerminal() would return, without
+  // advancing.
+  odb::dbITerm* peakNextDestinationTerminal() const;
   void moveNextTerminalToEnd() { next_ = terminals_.end(); }
 
   bool compare(const RDLSegment* other) const;
 
-  const std::vector<GridGraphVertex>& getRouteVerticies() const
-  {
-    return route_vertex_;
-  }
   const std::vector<odb::Point>& getRoutePoints() const { return route_pts_; }
-  const std::vector<RDLRouter::GridEdge>& getRouteEdges() const
+  const std::vector<GridGraphEdge>& getRouteEdges() const
   {
     return route_edges_;
   }
   const RouteTarget* getRouteTargetSource() const { return route_source_; }
   const RouteTarget* getRouteTargetDestination() const { return route_dest_; }
-  const RDLRouter::TerminalAccess& getTerminalAccessSource() const
-  {
-    return access_source_;
-  }
-  const RDLRouter::TerminalAccess& getTerminalAccessDestination() const
-  {
-    return access_dest_;
-  }
 
   odb::Rect getBBox(int bloat = 0) const;
 
@@ -120,19 +106,14 @@ class RDLSegment
   std::vector<odb::dbITerm*> terminals_;
   std::vector<odb::dbITerm*>::iterator next_;
 
-  std::vector<GridGraphVertex> route_vertex_;
   std::vector<odb::Point> route_pts_;
-  std::vector<RDLRouter::GridEdge> route_edges_;
+  std::vector<GridGraphEdge> route_edges_;
   const RouteTarget* route_source_;
   const RouteTarget* route_dest_;
   odb::PtrSet<odb::dbITerm> routed_terminals_;
   std::set<odb::Rect> stubs_;
   odb::Rect bbox_;
 
-  RDLRouter::TerminalAccess access_source_;
-  RDLRouter::TerminalAccess access_dest_;
-
-  bool contains(const odb::Point& pt) const;
   void setRouted();
 };
 
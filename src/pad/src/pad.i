@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////
 
 %{
+#include "ord/OpenRoad.hh"
 #include "pad/ICeWall.h"
 #include "utl/Logger.h"
 #include "odb/db.h"
@@ -142,6 +143,7 @@ void route_rdl(odb::dbTechLayer* layer,
                float penalty = 2.0,
                int max_iterations = 10)
 {
+  ord::getICeWall()->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
   ord::getICeWall()->routeRDL(layer, bump_via, pad_via, nets, width, spacing, allow45, fixed, penalty, max_iterations);
 }
 
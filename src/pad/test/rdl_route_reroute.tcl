@@ -0,0 +1,43 @@
+# RDL routes are unchanged when one session routes with and without 45*,
+# rebuilding the routing grid in between.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_lef Nangate45_io/dummy_pads.lef
+
+read_def Nangate45_blackparrot/floorplan_flipchip.def
+
+set block [ord::get_db_block]
+
+proc special_wires { block } {
+  set wires {}
+  foreach net [$block getNets] {
+    foreach swire [$net getSWires] {
+      lappend wires $swire
+    }
+  }
+  return $wires
+}
+
+set existing [special_wires $block]
+
+proc check_routes { name reference } {
+  set def_file [make_result_file "rdl_route_reroute_$name.def"]
+  write_def $def_file
+  if { [diff_files $def_file $reference] } {
+    error "$name routes differ from $reference"
+  }
+}
+
+rdl_route -layer metal10 -width 4 -spacing 4 "VDD DVDD VSS DVSS p_*"
+check_routes orthogonal rdl_route.defok
+
+foreach swire [special_wires $block] {
+  if { [lsearch -exact $existing $swire] == -1 } {
+    odb::dbSWire_destroy $swire
+  }
+}
+
+rdl_route -layer metal10 -width 6 -spacing 6 -allow45 "VDD DVDD VSS DVSS p_*"
+check_routes 45 rdl_route_45.defok
+
+puts pass
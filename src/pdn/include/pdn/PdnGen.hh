@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <set>
@@ -82,7 +83,13 @@ class PdnGen
                                odb::dbRegion* region);
 
   // Grids
-  void buildGrids(bool trim);
+  // With incremental, grids whose inputs and surroundings did not change
+  // since the last incremental build keep their shapes instead of being
+  // rebuilt.
+  void buildGrids(bool trim, bool incremental = false);
+  // Whether the last incremental build kept the shapes of the grid.
+  bool isGridReused(Grid* grid) const;
+  void setNumThreads(int threads) { num_threads_ = threads; }
   std::vector<Grid*> findGrid(const std::string& name,
                               bool error = false) const;
   void makeCoreGrid(VoltageDomain* domain,
@@ -212,6 +219,21 @@ class PdnGen
   std::unique_ptr<VoltageDomain> core_domain_;
   std::vector<std::unique_ptr<VoltageDomain>> domains_;
   std::vector<std::unique_ptr<PowerCell>> switched_power_cells_;
+
+  // Grids kept from the last incremental build
+  struct BuiltGrid
+  {
+    std::size_t input_hash = 0;
+    // obstructions and shapes of the grids before it that the grid saw
+    std::size_t surroundings_hash = 0;
+    odb::Rect footprint;
+    // untrimmed shapes of the grid seen by each grid after it
+    std::map<Grid*, std::size_t> shapes_hash;
+    bool reused = false;
+  };
+  std::map<Grid*, BuiltGrid> built_grids_;
+
+  int num_threads_ = 1;
 };
 
 }  // namespace pdn
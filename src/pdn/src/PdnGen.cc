@@ -5,8 +5,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -33,6 +35,8 @@
 #include "straps.h"
 #include "techlayer.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
+#include "utl/Trace.h"
 #include "via.h"
 #include "via_repair.h"
 
@@ -49,6 +53,7 @@ PdnGen::~PdnGen() = default;
 
 void PdnGen::reset()
 {
+  built_grids_.clear();
   core_domain_ = nullptr;
   domains_.clear();
   updateRenderer(true);
@@ -56,21 +61,134 @@ void PdnGen::reset()
 
 void PdnGen::resetShapes()
 {
+  built_grids_.clear();
   for (auto* grid : getGrids()) {
     grid->resetShapes();
   }
   updateRenderer(true);
 }
 
-void PdnGen::buildGrids(bool trim)
+bool PdnGen::isGridReused(Grid* grid) const
 {
+  auto built = built_grids_.find(grid);
+  return built != built_grids_.end() && built->second.reused;
+}
+
+// Bounding box of the shapes of a grid.
+static odb::Rect gridShapesBBox(const Grid* grid)
+{
+  odb::Rect bbox;
+  bbox.mergeInit();
+  for (const auto& [layer, shapes] : grid->getShapes()) {
+    for (const auto& shape : shapes) {
+      bbox.merge(shape->getRect());
+    }
+  }
+  return bbox;
+}
+
+// Area in which a grid looks at the shapes of the grids built before it.
+static odb::Rect gridFootprint(const Grid* grid)
+{
+  odb::Rect footprint = grid->getDomainBoundary();
+  footprint.merge(grid->getGridArea());
+  const odb::Rect shapes = gridShapesBBox(grid);
+  if (!shapes.isInverted()) {
+    footprint.merge(shapes);
+  }
+  return footprint;
+}
+
+// Area in which a grid makes its shapes and vias.
+static odb::Rect gridInputArea(const Grid* grid)
+{
+  odb::Rect area = grid->getDomainBoundary();
+  area.merge(grid->getGridArea());
+  return area;
+}
+
+// Layers a grid makes shapes on or connects through.
+static odb::PtrSet<odb::dbTechLayer> gridLayers(const Grid* grid)
+{
+  odb::PtrSet<odb::dbTechLayer> layers;
+  for (const auto& ring : grid->getRings()) {
+    for (auto* layer : ring->getLayers()) {
+      layers.insert(layer);
+    }
+  }
+  for (const auto& strap : grid->getStraps()) {
+    layers.insert(strap->getLayer());
+  }
+  for (const auto& connect : grid->getConnect()) {
+    layers.insert(connect->getLowerLayer());
+    layers.insert(connect->getUpperLayer());
+    for (auto* layer : connect->getIntermediteLayers()) {
+      layers.insert(layer);
+    }
+  }
+  return layers;
+}
+
+// Order independent hash of the shapes on the layers of a grid that reach
+// into its area.
+template <typename Tree>
+static std::size_t hashShapesAround(
+    const Grid* grid,
+    const odb::PtrMap<odb::dbTechLayer, Tree>& shapes)
+{
+  const odb::Rect area = gridInputArea(grid);
+  std::size_t hash = 0;
+  for (auto* layer : gridLayers(grid)) {
+    auto layer_shapes = shapes.find(layer);
+    if (layer_shapes == shapes.end()) {
+      continue;
+    }
+    const Tree& tree = layer_shapes->second;
+    for (auto it = tree.qbegin(bgi::intersects(area)); it != tree.qend();
+         it++) {
+      const ShapePtr& shape = *it;
+      const odb::Rect& rect = shape->getRect();
+      std::size_t seed = std::hash<odb::dbTechLayer*>{}(layer);
+      odb::hash_combine(seed, std::hash<odb::Point>{}(rect.ll()));
+      odb::hash_combine(seed, std::hash<odb::Point>{}(rect.ur()));
+      odb::hash_combine(seed, std::hash<odb::dbNet*>{}(shape->getNet()));
+      hash += seed;
+    }
+  }
+  return hash;
+}
+
+void PdnGen::buildGrids(bool trim, bool incremental)
+{
+  utl::TraceScope trace("pdn::buildGrids");
   debugPrint(logger_, utl::PDN, "Make", 1, "Build - begin");
   auto* block = db_->getChip()->getBlock();
 
-  resetShapes();
-
   const std::vector<Grid*> grids = getGrids(true);
 
+  if (incremental
+      && std::ranges::any_of(grids, [](const Grid* grid) {
+           return grid->type() == Grid::kExisting;
+         })) {
+    logger_->warn(utl::PDN,
+                  242,
+                  "Incremental build is not supported with existing grids, "
+                  "building all grids.");
+    incremental = false;
+  }
+
+  if (incremental && !built_grids_.empty()) {
+    // remove the shapes written by the previous build, the unchanged grids
+    // still have them in memory.
+    for (auto* domain : getDomains()) {
+      for (auto* net : domain->getNets()) {
+        ripUp(net);
+      }
+    }
+  } else {
+    resetShapes();
+  }
+
   // connect instances already assigned to grids
   odb::PtrSet<odb::dbInst> insts_in_grids;
   for (auto* grid : grids) {
@@ -101,6 +219,8 @@ void PdnGen::buildGrids(bool trim)
     }
   }
 
+  const bool reuse_grids = incremental && !built_grids_.empty();
+
   Shape::ObstructionTreeMap block_obs;
   for (const auto& [layer, shapes] : block_obs_vec) {
     block_obs[layer] = Shape::ObstructionTree(shapes.begin(), shapes.end());
@@ -116,10 +236,95 @@ void PdnGen::buildGrids(bool trim)
   }
   all_shapes_vec.clear();
 
+  std::map<Grid*, BuiltGrid> built_grids;
+
+  std::map<Grid*, std::size_t> grid_order;
   for (auto* grid : grids) {
-    debugPrint(
-        logger_, utl::PDN, "Make", 2, "Build start grid - {}", grid->getName());
-    grid->makeShapes(all_shapes, block_obs);
+    grid_order.emplace(grid, grid_order.size());
+  }
+  auto is_before = [&grid_order](Grid* grid, Grid* other) {
+    return grid_order.at(grid) < grid_order.at(other);
+  };
+
+  // The obstructions a grid sees do not depend on what gets rebuilt
+  std::map<Grid*, std::size_t> obstructions_hash;
+  if (incremental) {
+    for (auto* grid : grids) {
+      obstructions_hash[grid] = hashShapesAround(grid, block_obs);
+    }
+  }
+  auto surroundings_hash = [&](Grid* grid) {
+    std::size_t seed = obstructions_hash.at(grid);
+    for (auto* other : grids) {
+      if (other == grid) {
+        break;
+      }
+      const auto& shapes_hash = built_grids.at(other).shapes_hash;
+      auto shapes = shapes_hash.find(grid);
+      odb::hash_combine(
+          seed, shapes != shapes_hash.end() ? shapes->second : 0);
+    }
+    return seed;
+  };
+  // records the untrimmed shapes of a built grid that each later grid sees
+  auto hash_shapes_for_later_grids = [&](Grid* grid) {
+    const Shape::ShapeTreeMap shapes = grid->getShapes();
+    auto& shapes_hash = built_grids[grid].shapes_hash;
+    for (auto* other : grids) {
+      if (is_before(grid, other)) {
+        shapes_hash[other] = hashShapesAround(other, shapes);
+      }
+    }
+  };
+
+  // A grid is rebuilt when its own inputs change.  An unchanged grid is
+  // reused when its surroundings are, and only its vias to the rebuilt
+  // grids before it are moved to their new shapes.  The grids after it see
+  // its trimmed shapes, so it is also rebuilt when a rebuilt grid after it
+  // reaches it.
+  std::set<Grid*> rebuild;
+  auto affected_by_later_grids = [&](Grid* grid,
+                                     const odb::Rect& footprint,
+                                     const auto& other_footprint) {
+    return std::ranges::any_of(rebuild, [&](Grid* other) {
+      return is_before(grid, other)
+             && other_footprint(other).intersects(footprint);
+    });
+  };
+  if (reuse_grids) {
+    for (auto* grid : grids) {
+      auto built = built_grids_.find(grid);
+      if (built == built_grids_.end()
+          || built->second.input_hash != grid->getInputHash()
+          || !grid->hasShapes()) {
+        rebuild.insert(grid);
+      }
+    }
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (auto* grid : grids) {
+        if (rebuild.contains(grid)) {
+          continue;
+        }
+        const bool affected = affected_by_later_grids(
+            grid, built_grids_.at(grid).footprint, [&](Grid* other) {
+              odb::Rect footprint = gridFootprint(other);
+              auto built = built_grids_.find(other);
+              if (built != built_grids_.end()) {
+                footprint.merge(built->second.footprint);
+              }
+              return footprint;
+            });
+        if (affected) {
+          rebuild.insert(grid);
+          changed = true;
+        }
+      }
+    }
+  }
+
+  auto add_grid_shapes = [&](Grid* grid) {
     for (const auto& [layer, shapes] : grid->getShapes()) {
       auto& all_shapes_layer = all_shapes[layer];
       for (auto& shape : shapes) {
@@ -127,8 +332,134 @@ void PdnGen::buildGrids(bool trim)
       }
     }
     grid->getObstructions(block_obs);
+  };
+
+  auto make_grid_shapes = [&](Grid* grid) {
+    debugPrint(
+        logger_, utl::PDN, "Make", 2, "Build start grid - {}", grid->getName());
+    grid->makeShapes(all_shapes, block_obs);
     debugPrint(
         logger_, utl::PDN, "Make", 2, "Build end grid - {}", grid->getName());
+  };
+
+  // Instance grids are queued and built concurrently against the same
+  // shapes.  A grid that reaches the shapes of a grid ahead of it in the
+  // batch is rebuilt afterwards to get the same result as a serial build.
+  const bool parallel = num_threads_ > 1 && debug_renderer_ == nullptr;
+  std::vector<Grid*> batch;
+  auto build_batch = [&]() {
+    if (batch.size() == 1) {
+      batch.front()->setNumThreads(parallel ? num_threads_ : 1);
+      make_grid_shapes(batch.front());
+    } else if (!batch.empty()) {
+      for (auto* grid : batch) {
+        grid->setNumThreads(1);
+        // the shared shapes only get the vias once the batch is merged
+        grid->setDeferSharedVias(true);
+      }
+      utl::ThreadPool pool(std::min<size_t>(num_threads_, batch.size()));
+      pool.parallelFor(batch, make_grid_shapes);
+    }
+
+    std::vector<odb::Rect> batch_shapes;
+    for (auto* grid : batch) {
+      const bool overlaps
+          = std::ranges::any_of(batch_shapes, [&](const odb::Rect& shapes) {
+              return shapes.intersects(gridFootprint(grid));
+            });
+      if (overlaps) {
+        debugPrint(logger_,
+                   utl::PDN,
+                   "Make",
+                   1,
+                   "Rebuilding overlapping grid - {}",
+                   grid->getName());
+        grid->resetShapes();
+        grid->setDeferSharedVias(false);
+        make_grid_shapes(grid);
+      } else {
+        // link in grid order, as a serial build would
+        grid->linkSharedVias();
+      }
+      const odb::Rect shapes = gridShapesBBox(grid);
+      if (!shapes.isInverted()) {
+        batch_shapes.push_back(shapes);
+      }
+      if (incremental) {
+        built_grids[grid].surroundings_hash = surroundings_hash(grid);
+        hash_shapes_for_later_grids(grid);
+      }
+      add_grid_shapes(grid);
+      built_grids[grid].footprint = gridFootprint(grid);
+    }
+    batch.clear();
+  };
+
+  for (auto* grid : grids) {
+    built_grids[grid].input_hash = incremental ? grid->getInputHash() : 0;
+
+    if (reuse_grids && !rebuild.contains(grid)) {
+      // what the grid sees is only known once the grids before it are built
+      build_batch();
+      const BuiltGrid& built = built_grids_.at(grid);
+      if (built.surroundings_hash == surroundings_hash(grid)
+          && grid->retargetSharedVias(all_shapes)) {
+        logger_->info(utl::PDN, 243, "Reusing grid: {}", grid->getLongName());
+        BuiltGrid& reused = built_grids[grid];
+        reused.surroundings_hash = built.surroundings_hash;
+        reused.footprint = built.footprint;
+        reused.shapes_hash = built.shapes_hash;
+        reused.reused = true;
+        add_grid_shapes(grid);
+        continue;
+      }
+      rebuild.insert(grid);
+    }
+    if (incremental) {
+      // detaches the vias it added to the shapes of the reused grids
+      grid->resetShapes();
+    }
+
+    logger_->info(utl::PDN, 1, "Inserting grid: {}", grid->getLongName());
+    if (!parallel || grid->type() != Grid::kInstance) {
+      build_batch();
+      batch.push_back(grid);
+      build_batch();
+    } else {
+      batch.push_back(grid);
+    }
+  }
+  build_batch();
+
+  if (reuse_grids) {
+    // a rebuilt grid can grow past its previous footprint
+    for (auto* grid : grids) {
+      if (rebuild.contains(grid)) {
+        continue;
+      }
+      const bool affected = affected_by_later_grids(
+          grid, built_grids.at(grid).footprint, [&](Grid* other) {
+            return built_grids.at(other).footprint;
+          });
+      if (affected) {
+        debugPrint(logger_,
+                   utl::PDN,
+                   "Make",
+                   1,
+                   "Rebuilt grids reach reused grid {}, building all grids.",
+                   grid->getName());
+        built_grids_.clear();
+        resetShapes();
+        buildGrids(trim, incremental);
+        return;
+      }
+    }
+  }
+
+  if (incremental) {
+    built_grids_ = std::move(built_grids);
+  } else {
+    built_grids_.clear();
   }
 
   updateVias();
@@ -623,6 +954,7 @@ void PdnGen::makeRing(Grid* grid,
                       const std::vector<odb::dbNet*>& nets,
                       bool allow_out_of_die)
 {
+  built_grids_.erase(grid);
   auto ring = std::make_unique<Rings>(grid,
                                       Rings::Layer{layer0, width0, spacing0},
                                       Rings::Layer{layer1, width1, spacing1});
@@ -657,6 +989,7 @@ void PdnGen::makeFollowpin(Grid* grid,
                            int width,
                            ExtensionMode extend)
 {
+  built_grids_.erase(grid);
   auto strap = std::make_unique<FollowPins>(grid, layer, width);
   strap->setExtend(extend);
 
@@ -676,6 +1009,7 @@ void PdnGen::makeStrap(Grid* grid,
                        const std::vector<odb::dbNet*>& nets,
                        bool allow_out_of_core)
 {
+  built_grids_.erase(grid);
   auto strap = std::make_unique<Straps>(
       grid, layer, width, pitch, spacing, number_of_straps);
   strap->setExtend(extend);
@@ -704,6 +1038,7 @@ void PdnGen::makeConnect(
     const odb::PtrMap<odb::dbTechLayer, std::pair<int, bool>>& split_cuts,
     const std::string& dont_use_vias)
 {
+  built_grids_.erase(grid);
   auto con = std::make_unique<Connect>(grid, layer0, layer1);
   con->setCutPitch(cut_pitch_x, cut_pitch_y);
 
@@ -1053,6 +1388,7 @@ void PdnGen::report()
 
 void PdnGen::setAllowRepairChannels(bool allow)
 {
+  built_grids_.clear();
   for (auto* grid : getGrids()) {
     grid->setAllowRepairChannels(allow);
   }
@@ -1060,6 +1396,7 @@ void PdnGen::setAllowRepairChannels(bool allow)
 
 void PdnGen::filterVias(const std::string& filter)
 {
+  built_grids_.clear();
   for (auto* grid : getGrids()) {
     for (const auto& connect : grid->getConnect()) {
       connect->filterVias(filter);
@@ -4,6 +4,7 @@
 %{
 #include "pdn/PdnGen.hh"
 #include "odb/db.h"
+#include "ord/OpenRoad.hh"
 #include "utl/timer.h"
 #include <array>
 #include <regex>
@@ -48,14 +49,18 @@ using utl::PDN;
 
 namespace pdn {
 
-void run_pdngen(bool trim, bool add_pins, const char* report_file)
+void run_pdngen(bool trim, bool add_pins, const char* report_file, bool incremental)
 {
   utl::Timer timer;
   PdnGen* pdngen = ord::getPdnGen();
   pdngen->checkSetup();
-  pdngen->buildGrids(trim);
+  pdngen->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
+  pdngen->buildGrids(trim, incremental);
   pdngen->writeToDb(add_pins, report_file);
-  pdngen->resetShapes();
+  if (!incremental) {
+    // incremental builds keep the shapes for the next build
+    pdngen->resetShapes();
+  }
   ord::getLogger()->info(utl::PDN, 500, "Runtime: {:.2f}s", timer.elapsed());
 }
 
@@ -349,6 +354,18 @@ bool has_grid(const char* name)
   return !pdngen->findGrid(name, false).empty();
 }
 
+bool is_grid_reused(const char* name)
+{
+  PdnGen* pdngen = ord::getPdnGen();
+  const auto grids = pdngen->findGrid(name, false);
+  for (auto* grid : grids) {
+    if (!pdngen->isGridReused(grid)) {
+      return false;
+    }
+  }
+  return !grids.empty();
+}
+
 void remove_dummy_grid(const char* name)
 {
   PdnGen* pdngen = ord::getPdnGen();
@@ -5,9 +5,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <string>
 #include <tuple>
@@ -29,6 +32,7 @@
 #include "straps.h"
 #include "techlayer.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 #include "via.h"
 
 namespace pdn {
@@ -119,7 +123,6 @@ void Grid::makeShapes(const Shape::ShapeTreeMap& global_shapes,
                       const Shape::ObstructionTreeMap& obstructions)
 {
   auto* logger = getLogger();
-  logger->info(utl::PDN, 1, "Inserting grid: {}", getLongName());
 
   // copy obstructions
   Shape::ObstructionTreeMap local_obstructions = obstructions;
@@ -537,17 +540,21 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
     comp->getConnectableShapes(shapes);
   }
 
-  // loop over connect statements
-  for (const auto& connect : connect_) {
+  // each connect statement covers a separate pair of layers, so the
+  // intersections are found in parallel and concatenated in connect order.
+  std::vector<std::vector<ViaPtr>> connect_intersections(connect_.size());
+  auto find_intersections = [&](const int index) {
+    const auto& connect = connect_[index];
+    auto& intersections = connect_intersections[index];
     odb::dbTechLayer* lower_layer = connect->getLowerLayer();
     odb::dbTechLayer* upper_layer = connect->getUpperLayer();
 
     // check if both layers have shapes
     if (!shapes.contains(lower_layer)) {
-      continue;
+      return;
     }
     if (!shapes.contains(upper_layer)) {
-      continue;
+      return;
     }
 
     const auto& lower_shapes = shapes.at(lower_layer);
@@ -590,9 +597,25 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
                             via_rect,
                             lower_shape,
                             upper_shape);
-        shape_intersections.push_back(ViaPtr(via));
+        intersections.push_back(ViaPtr(via));
       }
     }
+  };
+
+  std::vector<int> connect_indices(connect_.size());
+  std::iota(connect_indices.begin(), connect_indices.end(), 0);
+  if (num_threads_ > 1 && connect_.size() > 1) {
+    utl::ThreadPool pool(std::min<size_t>(num_threads_, connect_.size()));
+    pool.parallelFor(connect_indices, find_intersections);
+  } else {
+    for (const int index : connect_indices) {
+      find_intersections(index);
+    }
+  }
+
+  for (auto& intersections : connect_intersections) {
+    shape_intersections.insert(
+        shape_intersections.end(), intersections.begin(), intersections.end());
   }
   debugPrint(getLogger(),
              utl::PDN,
@@ -602,8 +625,112 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
              name_);
 }
 
+bool Grid::isSharedShape(const Shape* shape) const
+{
+  const GridComponent* component = shape->getGridComponent();
+  return component == nullptr || component->getGrid() != this;
+}
+
+void Grid::linkSharedVias()
+{
+  for (; shared_vias_linked_ < shared_vias_.size(); shared_vias_linked_++) {
+    const auto& [via, shape] = shared_vias_[shared_vias_linked_];
+    shape->addVia(via);
+  }
+  defer_shared_vias_ = false;
+}
+
+void Grid::unlinkSharedVias()
+{
+  for (std::size_t i = 0; i < shared_vias_linked_; i++) {
+    const auto& [via, shape] = shared_vias_[i];
+    shape->removeVia(via);
+  }
+  shared_vias_.clear();
+  shared_vias_linked_ = 0;
+}
+
+bool Grid::retargetSharedVias(const Shape::ShapeTreeMap& global_shapes)
+{
+  std::set<Shape*> own_shapes;
+  for (const auto& [layer, shapes] : getShapes()) {
+    for (const auto& shape : shapes) {
+      own_shapes.insert(shape.get());
+    }
+  }
+
+  // finds the shape of the same net that now covers the via on the layer
+  auto find_shape = [&global_shapes](const ShapePtr& shape,
+                                     const odb::Rect& area) -> ShapePtr {
+    auto layer_shapes = global_shapes.find(shape->getLayer());
+    if (layer_shapes == global_shapes.end()) {
+      return nullptr;
+    }
+    std::vector<ShapePtr> found;
+    for (auto it = layer_shapes->second.qbegin(bgi::intersects(area));
+         it != layer_shapes->second.qend();
+         it++) {
+      const ShapePtr& other = *it;
+      if (other == shape) {
+        return shape;
+      }
+      if (other->getNet() == shape->getNet()
+          && other->getRect().contains(area)) {
+        found.push_back(other);
+      }
+    }
+    return found.size() == 1 ? found.front() : nullptr;
+  };
+
+  std::vector<std::tuple<ViaPtr, bool, ShapePtr>> replacements;
+  for (const auto& via : vias_) {
+    for (const bool lower : {true, false}) {
+      const ShapePtr& shape
+          = lower ? via->getLowerShape() : via->getUpperShape();
+      if (own_shapes.contains(shape.get())) {
+        continue;
+      }
+      ShapePtr new_shape
+          = find_shape(shape, via->getArea().intersect(shape->getRect()));
+      if (new_shape == nullptr) {
+        if (shape->getGridComponent() != nullptr) {
+          // the shape of the other grid is gone
+          return false;
+        }
+        // instance pins are not part of the shapes of any grid
+        continue;
+      }
+      if (new_shape != shape) {
+        replacements.emplace_back(via, lower, std::move(new_shape));
+      }
+    }
+  }
+
+  unlinkSharedVias();
+  for (const auto& [via, lower, shape] : replacements) {
+    if (lower) {
+      via->setLowerShape(shape);
+    } else {
+      via->setUpperShape(shape);
+    }
+  }
+  for (const auto& via : vias_) {
+    for (const ShapePtr& shape : {via->getLowerShape(), via->getUpperShape()}) {
+      if (!own_shapes.contains(shape.get())) {
+        shared_vias_.emplace_back(via, shape);
+      }
+    }
+  }
+  linkSharedVias();
+
+  return true;
+}
+
 void Grid::resetShapes()
 {
+  // the vias on the shapes of other grids would otherwise still count as
+  // connections when those shapes are trimmed
+  unlinkSharedVias();
   vias_.clear();
   std::set<GridComponent*> remove;
   for (auto* component : getGridComponents()) {
@@ -946,8 +1073,16 @@ void Grid::makeVias(const Shape::ShapeTreeMap& global_shapes,
   vias_.clear();
   for (auto& via : vias) {
     vias_.insert(via);
-    via->getLowerShape()->addVia(via);
-    via->getUpperShape()->addVia(via);
+    for (const ShapePtr& shape : {via->getLowerShape(), via->getUpperShape()}) {
+      if (isSharedShape(shape.get())) {
+        shared_vias_.emplace_back(via, shape);
+      } else {
+        shape->addVia(via);
+      }
+    }
+  }
+  if (!defer_shared_vias_) {
+    linkSharedVias();
   }
   debugPrint(
       getLogger(), utl::PDN, "Make", 1, "Making vias in \"{}\" - end", name_);
@@ -1294,6 +1429,57 @@ bool Grid::hasVias() const
   return !vias_.empty();
 }
 
+static void hashRect(std::size_t& seed, const odb::Rect& rect)
+{
+  odb::hash_combine(seed, std::hash<odb::Point>{}(rect.ll()));
+  odb::hash_combine(seed, std::hash<odb::Point>{}(rect.ur()));
+}
+
+std::size_t Grid::getInputHash() const
+{
+  std::size_t seed = 0;
+  hashRect(seed, getDomainArea());
+  hashRect(seed, getGridArea());
+  hashRect(seed, getDomainBoundary());
+
+  // specification of the rings, straps and connects
+  for (const auto& ring : rings_) {
+    for (auto* layer : ring->getLayers()) {
+      odb::hash_combine(seed, std::hash<odb::dbTechLayer*>{}(layer));
+    }
+    int hor_width = 0;
+    int ver_width = 0;
+    ring->getTotalWidth(hor_width, ver_width);
+    odb::hash_combine(seed, hor_width);
+    odb::hash_combine(seed, ver_width);
+    for (const int offset : ring->getOffset()) {
+      odb::hash_combine(seed, offset);
+    }
+  }
+  for (const auto& strap : straps_) {
+    odb::hash_combine(seed, static_cast<int>(strap->type()));
+    odb::hash_combine(seed, std::hash<odb::dbTechLayer*>{}(strap->getLayer()));
+    odb::hash_combine(seed, strap->getWidth());
+    odb::hash_combine(seed, strap->getSpacing());
+    odb::hash_combine(seed, strap->getPitch());
+    odb::hash_combine(seed, strap->getOffset());
+    odb::hash_combine(seed, strap->getStrapStart());
+    odb::hash_combine(seed, strap->getStrapEnd());
+    odb::hash_combine(seed, static_cast<int>(strap->getExtendMode()));
+  }
+  for (const auto& connect : connect_) {
+    odb::hash_combine(
+        seed, std::hash<odb::dbTechLayer*>{}(connect->getLowerLayer()));
+    odb::hash_combine(
+        seed, std::hash<odb::dbTechLayer*>{}(connect->getUpperLayer()));
+    odb::hash_combine(seed, connect->getCutPitchX());
+    odb::hash_combine(seed, connect->getCutPitchY());
+    odb::hash_combine(seed, connect->getMaxRows());
+    odb::hash_combine(seed, connect->getMaxColumns());
+  }
+  return seed;
+}
+
 ///////////////
 
 CoreGrid::CoreGrid(VoltageDomain* domain,
@@ -1572,6 +1758,18 @@ ShapeVectorMap InstanceGrid::getInstanceObstructions(
   return obs;
 }
 
+std::size_t InstanceGrid::getInputHash() const
+{
+  std::size_t seed = Grid::getInputHash();
+  odb::hash_combine(seed, inst_->getOrient().getValue());
+  odb::hash_combine(seed, inst_->getPlacementStatus().getValue());
+  for (const int halo : halos_) {
+    odb::hash_combine(seed, halo);
+  }
+  odb::hash_combine(seed, grid_to_boundary_);
+  return seed;
+}
+
 void InstanceGrid::getGridLevelObstructions(ShapeVectorMap& obstructions) const
 {
   ShapeVectorMap local_obs;
@@ -4,10 +4,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "odb/PtrSetMap.h"
@@ -170,6 +172,25 @@ class Grid
   bool hasShapes() const;
   bool hasVias() const;
 
+  // threads used to find the via intersections of this grid
+  void setNumThreads(int threads) { num_threads_ = threads; }
+
+  // While deferred, vias are only added to the shapes of this grid and the
+  // vias to shapes it does not own wait for linkSharedVias().  This lets
+  // grids be built concurrently against the same shapes.
+  void setDeferSharedVias(bool defer) { defer_shared_vias_ = defer; }
+  void linkSharedVias();
+
+  // Points the vias to the shapes of other grids at the shapes that took
+  // their place after those grids were rebuilt.  Returns false, and leaves
+  // the vias unchanged, if a via no longer lands on a single shape.
+  bool retargetSharedVias(const Shape::ShapeTreeMap& global_shapes);
+
+  // hash of the placement and specification of the grid, used by
+  // incremental builds to find the grids that changed since they were last
+  // built.
+  virtual std::size_t getInputHash() const;
+
  protected:
   // find all intersections in the shapes which may become vias
   virtual void getIntersections(std::vector<ViaPtr>& intersections,
@@ -195,7 +216,17 @@ class Grid
 
   Via::ViaTree vias_;
 
+  int num_threads_ = 1;
+
+  // vias to the shapes this grid does not own, the first
+  // shared_vias_linked_ of them are already added to those shapes.
+  std::vector<std::pair<ViaPtr, ShapePtr>> shared_vias_;
+  std::size_t shared_vias_linked_ = 0;
+  bool defer_shared_vias_ = false;
+
   std::vector<GridComponent*> getGridComponents() const;
+  bool isSharedShape(const Shape* shape) const;
+  void unlinkSharedVias();
   void removeGridComponent(GridComponent* component);
   bool repairVias(const Shape::ShapeTreeMap& global_shapes,
                   Shape::ObstructionTreeMap& obstructions);
@@ -253,6 +284,8 @@ class InstanceGrid : public Grid
 
   void getGridLevelObstructions(ShapeVectorMap& obstructions) const override;
 
+  std::size_t getInputHash() const override;
+
   void setReplaceable(bool replaceable) { replaceable_ = replaceable; }
   bool isReplaceable() const override { return replaceable_; }
 
@@ -3,6 +3,7 @@
 
 sta::define_cmd_args "pdngen" {[-skip_trim] \
                                [-dont_add_pins] \
+                               [-incremental] \
                                [-reset] \
                                [-ripup] \
                                [-report_only] \
@@ -14,7 +15,8 @@ sta::define_cmd_args "pdngen" {[-skip_trim] \
 proc pdngen { args } {
   sta::parse_key_args "pdngen" args \
     keys {-failed_via_report} \
-    flags {-skip_trim -dont_add_pins -reset -ripup -report_only -verbose -check_only}
+    flags {-skip_trim -dont_add_pins -reset -ripup -report_only -verbose -check_only \
+      -incremental}
 
   sta::check_argc_eq0 "pdngen" $args
 
@@ -55,13 +57,14 @@ proc pdngen { args } {
 
   set trim [expr [info exists flags(-skip_trim)] == 0]
   set add_pins [expr [info exists flags(-dont_add_pins)] == 0]
+  set incremental [info exists flags(-incremental)]
 
   set failed_via_report ""
   if { [info exists keys(-failed_via_report)] } {
     set failed_via_report $keys(-failed_via_report)
   }
 
-  pdn::run_pdngen $trim $add_pins $failed_via_report
+  pdn::run_pdngen $trim $add_pins $failed_via_report $incremental
 }
 
 sta::define_cmd_args "set_voltage_domain" {-name domain_name \
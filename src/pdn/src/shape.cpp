@@ -107,6 +107,14 @@ odb::Rect Shape::getRectWithLargestObstructionHalo(
   return obs_rect;
 }
 
+void Shape::removeVia(const ViaPtr& via)
+{
+  auto find = std::ranges::find(vias_, via);
+  if (find != vias_.end()) {
+    vias_.erase(find);
+  }
+}
+
 int Shape::getNumberOfConnections() const
 {
   return vias_.size() + iterm_connections_.size() + bterm_connections_.size();
@@ -0,0 +1,84 @@
+# instance grids built in parallel or incrementally match a serial build
+source "helpers.tcl"
+
+read_lef Nangate45/Nangate45.lef
+read_lef nangate_macros/fakeram45_64x32.lef
+
+read_def nangate_macros/floorplan.def
+
+add_global_connection -net VDD -pin_pattern {^VDD$} -power
+add_global_connection -net VDD -pin_pattern {^VDDPE$}
+add_global_connection -net VDD -pin_pattern {^VDDCE$}
+add_global_connection -net VSS -pin_pattern {^VSS$} -ground
+add_global_connection -net VSS -pin_pattern {^VSSE$}
+
+set_voltage_domain -power VDD -ground VSS
+
+define_pdn_grid -name "Core"
+add_pdn_stripe -followpins -layer metal1
+add_pdn_stripe -layer metal4 -width 0.48 -spacing 4.0 -pitch 49.0 -offset 2.0
+add_pdn_stripe -layer metal7 -width 1.4 -pitch 40.0 -offset 2.0
+
+add_pdn_connect -layers {metal1 metal4}
+add_pdn_connect -layers {metal4 metal7}
+
+define_pdn_grid -macro -name "sram1" \
+  -instances "dcache.data.data_arrays_0.data_arrays_0_ext.mem"
+add_pdn_stripe -layer metal5 -width 0.93 -pitch 10.0 -offset 2.0
+add_pdn_stripe -layer metal6 -width 0.93 -pitch 10.0 -offset 2.0
+
+add_pdn_connect -layers {metal4 metal5}
+add_pdn_connect -layers {metal5 metal6}
+add_pdn_connect -layers {metal6 metal7}
+
+define_pdn_grid -macro -name "sram2" \
+  -instances "frontend.icache.data_arrays_0.data_arrays_0_0_ext.mem"
+add_pdn_stripe -layer metal5 -width 0.93 -pitch 10.0 -offset 2.0
+add_pdn_stripe -layer metal6 -width 0.93 -pitch 10.0 -offset 2.0
+
+add_pdn_connect -layers {metal4 metal5}
+add_pdn_connect -layers {metal5 metal6}
+add_pdn_connect -layers {metal6 metal7}
+
+proc build_and_compare { name reference args } {
+  pdngen {*}$args
+  set def_file [make_result_file macros_parallel_$name.def]
+  write_def $def_file
+  if { [diff_files $reference $def_file] } {
+    error "$name build differs from $reference"
+  }
+}
+
+set_thread_count 1
+build_and_compare serial macros.defok
+
+pdngen -ripup
+set_thread_count 4
+build_and_compare parallel macros.defok
+
+# the second incremental build reuses every grid
+pdngen -ripup
+build_and_compare incremental macros.defok -incremental
+build_and_compare reused macros.defok -incremental
+foreach grid {Core sram1 sram2} {
+  if { ![pdn::is_grid_reused $grid] } {
+    error "$grid was rebuilt without changes"
+  }
+}
+
+# moving one macro rebuilds its grid and the core grid that avoids it, the
+# other macro grid only moves its vias to the new core straps
+set sram1 [[ord::get_db_block] findInst \
+  dcache.data.data_arrays_0.data_arrays_0_ext.mem]
+$sram1 setLocation 285600 200000
+pdngen -incremental
+if { [pdn::is_grid_reused sram1] || ![pdn::is_grid_reused sram2] } {
+  error "moving sram1 rebuilt more than the sram1 and core grids"
+}
+set moved_def [make_result_file macros_parallel_moved.def]
+write_def $moved_def
+
+pdngen -ripup
+build_and_compare moved_full $moved_def
+
+puts pass
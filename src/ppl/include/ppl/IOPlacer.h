@@ -200,6 +200,7 @@ class IOPlacer
                                          Netlist* netlist,
                                          bool mirrored_only);
   int64 computeIONetsHPWL(Netlist* netlist);
+  void runAnnealingChains(int num_chains);
   void findPinAssignment(std::vector<Section>& sections,
                          bool mirrored_groups_only);
   void updateSlots();
@@ -73,6 +73,12 @@ class Parameters
     pin_placement_file_ = file_name;
   }
   std::string getPinPlacementFile() const { return pin_placement_file_; }
+  void setSparseMatching(bool sparse) { sparse_matching_ = sparse; }
+  bool getSparseMatching() const { return sparse_matching_; }
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+  void setAnnealingChains(int chains) { annealing_chains_ = chains; }
+  int getAnnealingChains() const { return annealing_chains_; }
+  int getNumThreads() const { return num_threads_; }
 
  private:
   bool report_hpwl_ = false;
@@ -88,6 +94,9 @@ class Parameters
   int min_dist_ = 0;
   bool distance_in_tracks_ = false;
   std::string pin_placement_file_;
+  bool sparse_matching_ = false;
+  int num_threads_ = 1;
+  int annealing_chains_ = 1;
 };
 
 }  // namespace ppl
@@ -8,11 +8,14 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <numeric>
+#include <tuple>
 #include <vector>
 
 #include "Core.h"
 #include "Netlist.h"
 #include "Slots.h"
+#include "SparseAssignment.h"
 #include "odb/db.h"
 #include "odb/geom.h"
 #include "utl/Logger.h"
@@ -24,13 +27,15 @@ HungarianMatching::HungarianMatching(const Section& section,
                                      Core* core,
                                      std::vector<Slot>& slots,
                                      utl::Logger* logger,
-                                     odb::dbDatabase* db)
+                                     odb::dbDatabase* db,
+                                     bool sparse)
     : netlist_(netlist),
       core_(core),
       pin_indices_(section.pin_indices),
       pin_groups_(section.pin_groups),
       slots_(slots),
-      db_(db)
+      db_(db),
+      sparse_(sparse)
 {
   num_io_pins_ = section.pin_indices.size();
   num_pin_groups_ = netlist_->numIOGroups();
@@ -45,6 +50,9 @@ HungarianMatching::HungarianMatching(const Section& section,
 
 void HungarianMatching::findAssignment()
 {
+  if (sparse_ && findSparseAssignment()) {
+    return;
+  }
   createMatrix();
   if (!hungarian_matrix_.empty()) {
     hungarian_solver_.solve(hungarian_matrix_, assignment_);
@@ -56,39 +64,179 @@ void HungarianMatching::createMatrix()
   hungarian_matrix_.resize(non_blocked_slots_);
   int pin_index = 0;
 
+  std::vector<int> costs;
   for (int idx : pin_indices_) {
     IOPin& io_pin = netlist_->getIoPin(idx);
     if (!io_pin.isInGroup()) {
-      bool is_mirrored = false;
-      std::vector<int> larger_costs;
-      int slot_index = 0;
-      for (int i = begin_slot_; i <= end_slot_; ++i) {
-        const odb::Point& slot_pos = slots_[i].pos;
-        if (slots_[i].blocked) {
-          continue;
-        }
+      computePinCosts(idx, io_pin, costs);
+      for (int slot_index = 0; slot_index < costs.size(); slot_index++) {
         hungarian_matrix_[slot_index].resize(num_io_pins_,
                                              std::numeric_limits<int>::max());
-        const int io_net_hpwl = netlist_->computeIONetHPWL(idx, slot_pos);
-        const int mirrored_cost = getMirroredPinCost(io_pin, slot_pos);
-        const int hpwl = io_net_hpwl + mirrored_cost;
-        larger_costs.push_back(std::max(io_net_hpwl, mirrored_cost));
-        hungarian_matrix_[slot_index][pin_index] = hpwl;
-        is_mirrored = is_mirrored || mirrored_cost != 0;
-        slot_index++;
+        hungarian_matrix_[slot_index][pin_index] = costs[slot_index];
       }
+      pin_index++;
+    }
+  }
+}
 
-      if (is_mirrored) {
-        std::vector<uint8_t> rank = getTieBreakRank(larger_costs);
-        for (int idx = 0; idx < slot_index; idx++) {
-          const int hpwl = hungarian_matrix_[idx][pin_index];
-          if ((hpwl >> 24) != 0) {
-            logger_->critical(utl::PPL, 210, "Cost for pin exceeds 24 bits.");
-          }
-          hungarian_matrix_[idx][pin_index] = (hpwl << 8) | rank[idx];
-        }
+// Cost of placing the pin at each non-blocked slot of the section.
+void HungarianMatching::computePinCosts(int idx,
+                                        IOPin& io_pin,
+                                        std::vector<int>& costs)
+{
+  costs.clear();
+  bool is_mirrored = false;
+  std::vector<int> larger_costs;
+  for (int i = begin_slot_; i <= end_slot_; ++i) {
+    const odb::Point& slot_pos = slots_[i].pos;
+    if (slots_[i].blocked) {
+      continue;
+    }
+    const int io_net_hpwl = netlist_->computeIONetHPWL(idx, slot_pos);
+    const int mirrored_cost = getMirroredPinCost(io_pin, slot_pos);
+    costs.push_back(io_net_hpwl + mirrored_cost);
+    larger_costs.push_back(std::max(io_net_hpwl, mirrored_cost));
+    is_mirrored = is_mirrored || mirrored_cost != 0;
+  }
+
+  if (is_mirrored) {
+    std::vector<uint8_t> rank = getTieBreakRank(larger_costs);
+    for (int slot_index = 0; slot_index < costs.size(); slot_index++) {
+      const int hpwl = costs[slot_index];
+      if ((hpwl >> 24) != 0) {
+        logger_->critical(utl::PPL, 210, "Cost for pin exceeds 24 bits.");
       }
+      costs[slot_index] = (hpwl << 8) | rank[slot_index];
+    }
+  }
+}
+
+// Restrict each pin to its cheapest slots instead of building the dense
+// slots x pins matrix.  Returns false when the candidates do not admit a
+// complete assignment so the caller can fall back to the dense solver.
+bool HungarianMatching::findSparseAssignment()
+{
+  int num_pins = 0;
+  for (int idx : pin_indices_) {
+    if (!netlist_->getIoPin(idx).isInGroup()) {
+      num_pins++;
+    }
+  }
+  if (num_pins == 0 || num_pins > non_blocked_slots_) {
+    return false;
+  }
+
+  std::vector<int> free_slots;
+  free_slots.reserve(non_blocked_slots_);
+  for (int i = begin_slot_; i <= end_slot_; ++i) {
+    if (!slots_[i].blocked) {
+      free_slots.push_back(i);
+    }
+  }
+
+  SparseAssignment solver(num_pins, non_blocked_slots_);
+  std::vector<int> costs;
+  std::vector<int> order;
+  int pin_index = 0;
+  for (int idx : pin_indices_) {
+    IOPin& io_pin = netlist_->getIoPin(idx);
+    if (io_pin.isInGroup()) {
+      continue;
+    }
+    // Mirrored pins rank their costs against every slot and top layer
+    // sections are not a line of slots, so those pins use all the costs.
+    if (edge_ != Edge::invalid && !io_pin.getBTerm()->hasMirroredBTerm()) {
+      addWindowCandidates(idx, pin_index, free_slots, solver);
       pin_index++;
+      continue;
+    }
+    computePinCosts(idx, io_pin, costs);
+    order.resize(costs.size());
+    std::iota(order.begin(), order.end(), 0);
+    const int num_candidates
+        = std::min(static_cast<int>(order.size()), kSparseCandidates);
+    auto cost_less = [&costs](int a, int b) {
+      return std::tie(costs[a], a) < std::tie(costs[b], b);
+    };
+    std::ranges::nth_element(
+        order, order.begin() + num_candidates - 1, cost_less);
+    for (int i = 0; i < num_candidates; i++) {
+      const int slot_index = order[i];
+      if (costs[slot_index] != hungarian_fail_) {
+        solver.addCandidate(pin_index, slot_index, costs[slot_index]);
+      }
+    }
+    pin_index++;
+  }
+
+  std::vector<int> pin_to_slot;
+  if (!solver.solve(pin_to_slot)) {
+    debugPrint(logger_,
+               utl::PPL,
+               "sparse_matching",
+               1,
+               "Section at slots {}-{} needs the dense matching.",
+               begin_slot_,
+               end_slot_);
+    return false;
+  }
+
+  assignment_.assign(non_blocked_slots_, -1);
+  for (int pin = 0; pin < num_pins; pin++) {
+    assignment_[pin_to_slot[pin]] = pin;
+  }
+  return true;
+}
+
+// The slots of an edge section lie on a line, along which the net HPWL is
+// convex.  The cheapest slot is found by binary search and the window of
+// the kSparseCandidates cheapest slots grows around it, so only
+// O(kSparseCandidates + log(slots)) costs are computed per pin.  Up to
+// ties, the window holds the slots selecting from all the costs would.
+void HungarianMatching::addWindowCandidates(int idx,
+                                            int pin_index,
+                                            const std::vector<int>& free_slots,
+                                            SparseAssignment& solver)
+{
+  auto cost = [&](int slot_index) {
+    return netlist_->computeIONetHPWL(idx, slots_[free_slots[slot_index]].pos);
+  };
+
+  const int num_free = free_slots.size();
+  int lo = 0;
+  int hi = num_free - 1;
+  while (lo < hi) {
+    const int mid = lo + (hi - lo) / 2;
+    if (cost(mid + 1) < cost(mid)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  solver.addCandidate(pin_index, lo, cost(lo));
+  int left = lo - 1;
+  int right = lo + 1;
+  int left_cost = left >= 0 ? cost(left) : 0;
+  int right_cost = right < num_free ? cost(right) : 0;
+  for (int count = 1; count < kSparseCandidates; count++) {
+    const bool has_left = left >= 0;
+    const bool has_right = right < num_free;
+    if (!has_left && !has_right) {
+      break;
+    }
+    if (has_left && (!has_right || left_cost <= right_cost)) {
+      solver.addCandidate(pin_index, left, left_cost);
+      left--;
+      if (left >= 0) {
+        left_cost = cost(left);
+      }
+    } else {
+      solver.addCandidate(pin_index, right, right_cost);
+      right++;
+      if (right < num_free) {
+        right_cost = cost(right);
+      }
     }
   }
 }
@@ -112,7 +260,8 @@ void HungarianMatching::getFinalAssignment(std::vector<IOPin>& assignment,
           slot_index++;
           continue;
         }
-        if (hungarian_matrix_[row][col] == hungarian_fail_) {
+        if (!hungarian_matrix_.empty()
+            && hungarian_matrix_[row][col] == hungarian_fail_) {
           logger_->warn(utl::PPL,
                         33,
                         "I/O pin {} cannot be placed in the specified region. "
@@ -12,6 +12,7 @@
 #include "Hungarian.h"
 #include "Netlist.h"
 #include "Slots.h"
+#include "SparseAssignment.h"
 #include "odb/geom.h"
 #include "ppl/IOPlacer.h"
 #include "utl/Logger.h"
@@ -26,7 +27,8 @@ class HungarianMatching
                     Core* core,
                     std::vector<Slot>& slots,
                     utl::Logger* logger,
-                    odb::dbDatabase* db);
+                    odb::dbDatabase* db,
+                    bool sparse = false);
   virtual ~HungarianMatching() = default;
   void findAssignment();
   void findAssignmentForGroups();
@@ -55,8 +57,18 @@ class HungarianMatching
   const int hungarian_fail_ = std::numeric_limits<int>::max();
   utl::Logger* logger_;
   odb::dbDatabase* db_;
+  bool sparse_;
+  // Number of cheapest slots each pin may be assigned to by the sparse
+  // solver.
+  static constexpr int kSparseCandidates = 32;
 
   void createMatrix();
+  bool findSparseAssignment();
+  void addWindowCandidates(int idx,
+                           int pin_index,
+                           const std::vector<int>& free_slots,
+                           SparseAssignment& solver);
+  void computePinCosts(int idx, IOPin& io_pin, std::vector<int>& costs);
   void createMatrixForGroups();
   void assignMirroredPins(IOPin& io_pin, std::vector<IOPin>& assignment);
   int getSlotIdxByPosition(const odb::Point& position, int layer) const;
@@ -28,6 +28,9 @@
 #include "odb/geom.h"
 #include "ppl/Parameters.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
+#include "utl/Trace.h"
+#include "utl/timer.h"
 #include "utl/validation.h"
 
 namespace ppl {
@@ -2207,6 +2210,7 @@ std::string IOPlacer::getPinSetOrListString(const PinSetOrList& group)
 void IOPlacer::findPinAssignment(std::vector<Section>& sections,
                                  bool mirrored_groups_only)
 {
+  const bool sparse = parms_->getSparseMatching();
   std::vector<HungarianMatching> hg_vec;
   for (const auto& section : sections) {
     if (!section.pin_indices.empty()) {
@@ -2216,11 +2220,17 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
                              core_.get(),
                              top_layer_slots_,
                              logger_,
-                             db_);
+                             db_,
+                             sparse);
         hg_vec.push_back(hg);
       } else {
-        HungarianMatching hg(
-            section, netlist_.get(), core_.get(), slots_, logger_, db_);
+        HungarianMatching hg(section,
+                             netlist_.get(),
+                             core_.get(),
+                             slots_,
+                             logger_,
+                             db_,
+                             sparse);
         hg_vec.push_back(hg);
       }
     }
@@ -2240,9 +2250,33 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     updateSection(sec, slots);
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignment();
+  // Each section only reads the netlist and its own slots, so the sections
+  // are solved independently.  Only the sparse matching uses the threads:
+  // concurrent dense matrices would multiply the peak memory.
+  const utl::Timer timer;
+  const int num_threads = parms_->getNumThreads();
+  if (sparse && num_threads > 1 && hg_vec.size() > 1) {
+    std::vector<HungarianMatching*> matches;
+    matches.reserve(hg_vec.size());
+    for (auto& match : hg_vec) {
+      matches.push_back(&match);
+    }
+    utl::ThreadPool pool(std::min<size_t>(num_threads, hg_vec.size()));
+    pool.parallelFor(matches,
+                     [](HungarianMatching* match) { match->findAssignment(); });
+  } else {
+    for (auto& match : hg_vec) {
+      match.findAssignment();
+    }
   }
+  debugPrint(logger_,
+             utl::PPL,
+             "sparse_matching",
+             1,
+             "{} matching of {} sections took {:.3f}s.",
+             sparse ? "Sparse" : "Hungarian",
+             hg_vec.size(),
+             timer.elapsed());
 
   for (bool mirrored_pins : {true, false}) {
     for (auto& match : hg_vec) {
@@ -2263,6 +2297,7 @@ void IOPlacer::updateSlots()
 
 void IOPlacer::runHungarianMatching()
 {
+  utl::TraceScope trace("ppl::hungarianMatching");
   bool isPolygon = getBlock()->getDieAreaPolygon().getPoints().size() > 5;
 
   slots_per_section_ = parms_->getSlotsPerSection();
@@ -2417,17 +2452,25 @@ void IOPlacer::runAnnealing()
   initMirroredPins(true);
   initConstraints(true);
 
-  ppl::SimulatedAnnealing annealing(
-      netlist_.get(), core_.get(), slots_, constraints_, logger_, db_);
+  printConfig(true);
 
-  if (isAnnealingDebugOn()) {
-    annealing.setDebugOn(std::move(ioplacer_renderer_));
-  }
+  // The debug renderer follows a single chain.
+  const int num_chains
+      = isAnnealingDebugOn() ? 1 : parms_->getAnnealingChains();
+  if (num_chains <= 1) {
+    ppl::SimulatedAnnealing annealing(
+        netlist_.get(), core_.get(), slots_, constraints_, logger_, db_);
 
-  printConfig(true);
+    if (isAnnealingDebugOn()) {
+      annealing.setDebugOn(std::move(ioplacer_renderer_));
+    }
 
-  annealing.run(init_temperature_, max_iterations_, perturb_per_iter_, alpha_);
-  annealing.getAssignment(assignment_);
+    annealing.run(
+        init_temperature_, max_iterations_, perturb_per_iter_, alpha_);
+    annealing.getAssignment(assignment_);
+  } else {
+    runAnnealingChains(num_chains);
+  }
 
   for (auto& pin : assignment_) {
     if (isPolygon) {
@@ -2446,6 +2489,58 @@ void IOPlacer::runAnnealing()
   clear();
 }
 
+// Run independent annealing chains from different seeds, each on its own
+// copy of the slots, and keep the cheapest result.  Ties go to the lowest
+// chain so the result does not depend on the thread count.
+void IOPlacer::runAnnealingChains(const int num_chains)
+{
+  std::vector<std::vector<Slot>> chain_slots(num_chains, slots_);
+  std::vector<std::unique_ptr<SimulatedAnnealing>> chains;
+  std::vector<int> chain_indices(num_chains);
+  for (int i = 0; i < num_chains; i++) {
+    auto chain = std::make_unique<SimulatedAnnealing>(netlist_.get(),
+                                                      core_.get(),
+                                                      chain_slots[i],
+                                                      constraints_,
+                                                      logger_,
+                                                      db_);
+    chain->setSeed(chain->getSeed() + i);
+    chains.push_back(std::move(chain));
+    chain_indices[i] = i;
+  }
+
+  auto run_chain = [&](const int i) {
+    chains[i]->run(
+        init_temperature_, max_iterations_, perturb_per_iter_, alpha_);
+  };
+  const int num_threads = std::min(parms_->getNumThreads(), num_chains);
+  if (num_threads > 1) {
+    utl::ThreadPool pool(num_threads);
+    pool.parallelFor(chain_indices, run_chain);
+  } else {
+    for (const int i : chain_indices) {
+      run_chain(i);
+    }
+  }
+
+  int best = 0;
+  for (int i = 0; i < num_chains; i++) {
+    debugPrint(logger_,
+               utl::PPL,
+               "annealing",
+               1,
+               "chain {} cost: {}um",
+               i,
+               getBlock()->dbuToMicrons(chains[i]->getCost()));
+    if (chains[i]->getCost() < chains[best]->getCost()) {
+      best = i;
+    }
+  }
+
+  chains[best]->getAssignment(assignment_);
+  slots_ = std::move(chain_slots[best]);
+}
+
 void IOPlacer::checkPinPlacement()
 {
   bool invalid = false;
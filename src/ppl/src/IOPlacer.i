@@ -160,6 +160,8 @@ add_ver_layer(odb::dbTechLayer* layer)
 void
 run_hungarian_matching()
 {
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  getIOPlacer()->getParameters()->setNumThreads(num_threads);
   getIOPlacer()->runHungarianMatching();
 }
 
@@ -210,6 +212,16 @@ void set_pin_placement_file(const char* file_name)
   getIOPlacer()->getParameters()->setPinPlacementFile(file_name);
 }
 
+void set_sparse_matching(bool sparse)
+{
+  getIOPlacer()->getParameters()->setSparseMatching(sparse);
+}
+
+void set_annealing_chains(int chains)
+{
+  getIOPlacer()->getParameters()->setAnnealingChains(chains);
+}
+
 void
 place_pin(odb::dbBTerm* bterm, odb::dbTechLayer* layer,
           int x, int y, int width, int height,
@@ -260,6 +272,8 @@ simulated_annealing_debug(int iters_between_paintings,
 void
 run_annealing()
 {
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  getIOPlacer()->getParameters()->setNumThreads(num_threads);
   getIOPlacer()->runAnnealing();
 }
 
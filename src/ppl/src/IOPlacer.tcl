@@ -61,12 +61,14 @@ proc set_pin_thick_multiplier { args } {
 sta::define_cmd_args "set_simulated_annealing" {[-temperature temperature]\
                                                 [-max_iterations iters]\
                                                 [-perturb_per_iter perturbs]\
-                                                [-alpha alpha]
+                                                [-alpha alpha]\
+                                                [-chains chains]
 }
 
 proc set_simulated_annealing { args } {
   sta::parse_key_args "set_simulated_annealing" args \
-    keys {-temperature -max_iterations -perturb_per_iter -alpha} flags {}
+    keys {-temperature -max_iterations -perturb_per_iter -alpha -chains} \
+    flags {}
 
   set temperature 0
   if { [info exists keys(-temperature)] } {
@@ -92,6 +94,13 @@ proc set_simulated_annealing { args } {
     sta::check_positive_float "-alpha" $alpha
   }
 
+  set chains 1
+  if { [info exists keys(-chains)] } {
+    set chains $keys(-chains)
+    sta::check_positive_int "-chains" $chains
+  }
+
+  ppl::set_annealing_chains $chains
   ppl::set_simulated_annealing $temperature $max_iterations $perturb_per_iter $alpha
 }
 
@@ -216,6 +225,7 @@ sta::define_cmd_args "place_pins" {[-hor_layers h_layers]\
                                   [-exclude region]\
                                   [-group_pins pin_list]\
                                   [-annealing] \
+                                  [-sparse_matching] \
                                   [-write_pin_placement file_name]
 }
 
@@ -224,7 +234,7 @@ proc place_pins { args } {
   sta::parse_key_args "place_pins" args \
     keys {-hor_layers -ver_layers -random_seed -corner_avoidance \
           -min_distance -write_pin_placement} \
-    flags {-random -min_distance_in_tracks -annealing}
+    flags {-random -min_distance_in_tracks -annealing -sparse_matching}
 
   sta::check_argc_eq0 "place_pins" $args
 
@@ -361,6 +371,8 @@ proc place_pins { args } {
       ppl::set_pin_placement_file $keys(-write_pin_placement)
     }
 
+    ppl::set_sparse_matching [info exists flags(-sparse_matching)]
+
     if { [info exists flags(-annealing)] } {
       ppl::run_annealing
     } else {
@@ -138,15 +138,6 @@ int Netlist::computeDstIOtoPins(int idx, const odb::Point& slot_pos)
   return total_distance;
 }
 
-void Netlist::sortPinsFromGroup(int group_idx, Edge edge)
-{
-  PinGroupByIndex& group = io_groups_[group_idx];
-  std::vector<int>& pin_indices = group.pin_indices;
-  if (group.order && (edge == Edge::top || edge == Edge::left)) {
-    std::ranges::reverse(pin_indices);
-  }
-}
-
 void Netlist::reset()
 {
   inst_pins_.clear();
@@ -123,10 +123,12 @@ void SimulatedAnnealing::run(float init_temperature,
       annealingStateVisualization(pins, all_sinks, iter);
     }
   }
+  cost_ = pre_cost;
 }
 
 void SimulatedAnnealing::getAssignment(std::vector<IOPin>& assignment)
 {
+  netlist_->setIOGroups(pin_groups_);
   for (int i = 0; i < pin_assignment_.size(); i++) {
     IOPin& io_pin = netlist_->getIoPin(i);
     Slot& slot = slots_[pin_assignment_[i]];
@@ -603,7 +605,7 @@ int SimulatedAnnealing::moveGroupToFreeSlots(const int group_idx)
   }
 
   if (free_slot && same_edge_slot) {
-    netlist_->sortPinsFromGroup(group_idx, slots_[new_slot].edge);
+    sortPinsFromGroup(group_idx, slots_[new_slot].edge);
     updateGroupSlots(group.pin_indices, new_slot);
   } else {
     updateSlotsFromGroup(prev_slots_, true);
@@ -739,7 +741,7 @@ int SimulatedAnnealing::rearrangeConstrainedGroups(int constraint_idx)
     for (int idx : aux_indices) {
       int group_idx = group_indices[idx];
       const PinGroupByIndex& group = pin_groups_[group_idx];
-      netlist_->sortPinsFromGroup(group_idx, slots_[new_slot].edge);
+      sortPinsFromGroup(group_idx, slots_[new_slot].edge);
       updateGroupSlots(group.pin_indices, new_slot);
       cnt++;
       if (cnt < group_limits_list.size()) {
@@ -1036,4 +1038,12 @@ void SimulatedAnnealing::countLonePins()
   unconstrained_swappable_pins_ = unconstrained_swappable;
 }
 
+void SimulatedAnnealing::sortPinsFromGroup(int group_idx, Edge edge)
+{
+  PinGroupByIndex& group = pin_groups_[group_idx];
+  if (group.order && (edge == Edge::top || edge == Edge::left)) {
+    std::ranges::reverse(group.pin_indices);
+  }
+}
+
 }  // namespace ppl
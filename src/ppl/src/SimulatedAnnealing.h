@@ -45,6 +45,10 @@ class SimulatedAnnealing
            int perturb_per_iter,
            float alpha);
   void getAssignment(std::vector<IOPin>& assignment);
+  // Cost of the assignment found by the last run().
+  int64 getCost() const { return cost_; }
+  int getSeed() const { return seed_; }
+  void setSeed(int seed) { seed_ = seed; }
 
   // debug functions
   void setDebugOn(std::unique_ptr<AbstractIOPlacerRenderer> renderer);
@@ -93,6 +97,7 @@ class SimulatedAnnealing
   int computeGroupPrevCost(int group_idx);
   void updateGroupSlots(const std::vector<int>& pin_indices, int& new_slot);
   void countLonePins();
+  void sortPinsFromGroup(int group_idx, Edge edge);
 
   // [pin] -> slot
   std::vector<int> pin_assignment_;
@@ -100,7 +105,9 @@ class SimulatedAnnealing
   Netlist* netlist_;
   Core* core_;
   std::vector<Slot>& slots_;
-  const std::vector<PinGroupByIndex>& pin_groups_;
+  // Local copy as moving an ordered group reverses its pins; published to
+  // the netlist by getAssignment().
+  std::vector<PinGroupByIndex> pin_groups_;
   const std::vector<Constraint>& constraints_;
   int num_slots_;
   int num_pins_;
@@ -130,7 +137,8 @@ class SimulatedAnnealing
   utl::Logger* logger_ = nullptr;
   odb::dbDatabase* db_;
   const int fail_cost_ = std::numeric_limits<int>::max();
-  const int seed_ = 42;
+  int seed_ = 42;
+  int64 cost_ = 0;
 
   // debug variables
   std::unique_ptr<DebugSettings> debug_;
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "SparseAssignment.h"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace ppl {
+
+namespace {
+constexpr int64_t kInfinity = std::numeric_limits<int64_t>::max();
+}
+
+SparseAssignment::SparseAssignment(const int num_rows, const int num_cols)
+    : num_rows_(num_rows),
+      num_cols_(num_cols),
+      candidates_(num_rows),
+      potential_(num_rows + num_cols, 0),
+      row_match_(num_rows, -1),
+      col_match_(num_cols, -1),
+      col_match_cost_(num_cols, 0),
+      dist_(num_rows + num_cols, kInfinity),
+      parent_(num_rows + num_cols, -1),
+      parent_cost_(num_cols, 0),
+      done_(num_rows + num_cols, false)
+{
+}
+
+void SparseAssignment::addCandidate(const int row,
+                                    const int col,
+                                    const int64_t cost)
+{
+  candidates_[row].push_back({col, cost});
+}
+
+bool SparseAssignment::solve(std::vector<int>& row_to_col)
+{
+  if (num_rows_ > num_cols_) {
+    return false;
+  }
+  for (int row = 0; row < num_rows_; row++) {
+    if (!augment(row)) {
+      return false;
+    }
+  }
+  row_to_col = row_match_;
+  return true;
+}
+
+// Find the cheapest path from a free row to a free column alternating
+// between candidate and matched edges, then flip it.  Reduced costs
+// cost + potential[from] - potential[to] stay non-negative, which keeps
+// Dijkstra valid with the negated cost of matched (column -> row) edges.
+bool SparseAssignment::augment(const int row)
+{
+  using Entry = std::pair<int64_t, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+
+  auto relax = [&](const int node, const int64_t dist, const int parent) {
+    if (dist < dist_[node]) {
+      if (dist_[node] == kInfinity) {
+        touched_.push_back(node);
+      }
+      dist_[node] = dist;
+      parent_[node] = parent;
+      queue.emplace(dist, node);
+      return true;
+    }
+    return false;
+  };
+
+  relax(row, 0, -1);
+  int free_col = -1;
+  int64_t path_dist = 0;
+  while (!queue.empty()) {
+    const auto [dist, node] = queue.top();
+    queue.pop();
+    if (done_[node]) {
+      continue;
+    }
+    done_[node] = true;
+
+    if (node < num_rows_) {
+      for (const Candidate& candidate : candidates_[node]) {
+        const int col_node = num_rows_ + candidate.col;
+        if (done_[col_node]) {
+          continue;
+        }
+        const int64_t reduced
+            = candidate.cost + potential_[node] - potential_[col_node];
+        if (relax(col_node, dist + reduced, node)) {
+          parent_cost_[candidate.col] = candidate.cost;
+        }
+      }
+    } else {
+      const int col = node - num_rows_;
+      const int matched_row = col_match_[col];
+      if (matched_row == -1) {
+        free_col = col;
+        path_dist = dist;
+        break;
+      }
+      const int64_t reduced = -col_match_cost_[col] + potential_[node]
+                              - potential_[matched_row];
+      relax(matched_row, dist + reduced, node);
+    }
+  }
+
+  if (free_col != -1) {
+    // Only settled nodes move; everything else is shifted by path_dist,
+    // which leaves reduced costs unchanged.
+    for (const int node : touched_) {
+      if (done_[node] && dist_[node] < path_dist) {
+        potential_[node] += dist_[node] - path_dist;
+      }
+    }
+
+    int col = free_col;
+    while (true) {
+      const int match_row = parent_[num_rows_ + col];
+      const int prev_col = row_match_[match_row];
+      row_match_[match_row] = col;
+      col_match_[col] = match_row;
+      col_match_cost_[col] = parent_cost_[col];
+      if (match_row == row) {
+        break;
+      }
+      col = prev_col;
+    }
+  }
+
+  for (const int node : touched_) {
+    dist_[node] = kInfinity;
+    parent_[node] = -1;
+    done_[node] = false;
+  }
+  touched_.clear();
+
+  return free_col != -1;
+}
+
+}  // namespace ppl
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ppl {
+
+// Minimum cost assignment of rows to distinct columns where each row may only
+// use its own candidate columns.  Solved by successive shortest augmenting
+// paths (Dijkstra with node potentials), so the run time and memory follow
+// the number of candidates instead of rows x columns.
+class SparseAssignment
+{
+ public:
+  SparseAssignment(int num_rows, int num_cols);
+
+  // Costs must be non-negative.
+  void addCandidate(int row, int col, int64_t cost);
+  // Returns false when some row cannot be assigned using only the candidate
+  // columns.  Otherwise row_to_col holds the column assigned to each row.
+  bool solve(std::vector<int>& row_to_col);
+
+ private:
+  struct Candidate
+  {
+    int col;
+    int64_t cost;
+  };
+
+  bool augment(int row);
+
+  const int num_rows_;
+  const int num_cols_;
+  std::vector<std::vector<Candidate>> candidates_;
+
+  // Nodes [0, num_rows_) are rows, [num_rows_, num_rows_ + num_cols_) are
+  // columns.
+  std::vector<int64_t> potential_;
+  std::vector<int> row_match_;
+  std::vector<int> col_match_;
+  std::vector<int64_t> col_match_cost_;
+
+  // Per augmentation search state, reset through touched_.
+  std::vector<int64_t> dist_;
+  std::vector<int> parent_;
+  std::vector<int64_t> parent_cost_;
+  std::vector<bool> done_;
+  std::vector<int> touched_;
+};
+
+}  // namespace ppl
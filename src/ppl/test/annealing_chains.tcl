@@ -0,0 +1,40 @@
+# set_simulated_annealing -chains: one chain reproduces the annealing1
+# golden, several chains give the same placement on 1 and 4 threads, and
+# omitting -chains goes back to one chain.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def gcd.def
+
+set args {-hor_layers metal3 -ver_layers metal4 -annealing}
+
+set_simulated_annealing -chains 1
+place_pins {*}$args
+set def_file [make_result_file annealing_chains1.def]
+write_def $def_file
+if { [diff_files annealing1.defok $def_file] } {
+  error "one annealing chain differs from annealing1.defok"
+}
+
+set_simulated_annealing -chains 4
+set chain_defs {}
+foreach threads {1 4} {
+  set_thread_count $threads
+  place_pins {*}$args
+  set def_file [make_result_file annealing_chains4_t$threads.def]
+  write_def $def_file
+  lappend chain_defs $def_file
+}
+if { [diff_files {*}$chain_defs] } {
+  error "four annealing chains differ between 1 and 4 threads"
+}
+
+set_thread_count 1
+set_simulated_annealing
+place_pins {*}$args
+set def_file [make_result_file annealing_chains_default.def]
+write_def $def_file
+if { [diff_files annealing1.defok $def_file] } {
+  error "omitting -chains did not go back to one chain"
+}
+
+puts pass
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "SparseAssignment.h"
+#include "gtest/gtest.h"
+
+namespace ppl {
+
+namespace {
+
+constexpr int64_t kNoCandidate = -1;
+
+// Cheapest complete assignment by trying every permutation of the columns.
+int64_t bruteForceCost(const std::vector<std::vector<int64_t>>& costs,
+                       const int num_cols)
+{
+  std::vector<int> cols(num_cols);
+  std::iota(cols.begin(), cols.end(), 0);
+  int64_t best = std::numeric_limits<int64_t>::max();
+  do {
+    int64_t total = 0;
+    bool complete = true;
+    for (size_t row = 0; row < costs.size(); row++) {
+      if (costs[row][cols[row]] == kNoCandidate) {
+        complete = false;
+        break;
+      }
+      total += costs[row][cols[row]];
+    }
+    if (complete) {
+      best = std::min(best, total);
+    }
+  } while (std::ranges::next_permutation(cols).found);
+  return best;
+}
+
+}  // namespace
+
+TEST(SparseAssignment, MatchesBruteForce)
+{
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int64_t> cost_dist(0, 100);
+  std::bernoulli_distribution keep(0.6);
+  const int num_rows = 5;
+  const int num_cols = 7;
+  for (int trial = 0; trial < 50; trial++) {
+    std::vector<std::vector<int64_t>> costs(
+        num_rows, std::vector<int64_t>(num_cols, kNoCandidate));
+    SparseAssignment solver(num_rows, num_cols);
+    for (int row = 0; row < num_rows; row++) {
+      for (int col = 0; col < num_cols; col++) {
+        if (keep(rng)) {
+          costs[row][col] = cost_dist(rng);
+          solver.addCandidate(row, col, costs[row][col]);
+        }
+      }
+    }
+
+    const int64_t best = bruteForceCost(costs, num_cols);
+    std::vector<int> row_to_col;
+    const bool solved = solver.solve(row_to_col);
+    ASSERT_EQ(solved, best != std::numeric_limits<int64_t>::max());
+    if (!solved) {
+      continue;
+    }
+
+    int64_t total = 0;
+    std::vector<bool> used(num_cols, false);
+    for (int row = 0; row < num_rows; row++) {
+      const int col = row_to_col[row];
+      ASSERT_NE(costs[row][col], kNoCandidate);
+      EXPECT_FALSE(used[col]);
+      used[col] = true;
+      total += costs[row][col];
+    }
+    EXPECT_EQ(total, best);
+  }
+}
+
+TEST(SparseAssignment, FailsWhenCandidatesConflict)
+{
+  // Both rows can only use column 0.
+  SparseAssignment solver(2, 3);
+  solver.addCandidate(0, 0, 1);
+  solver.addCandidate(1, 0, 2);
+  std::vector<int> row_to_col;
+  EXPECT_FALSE(solver.solve(row_to_col));
+}
+
+TEST(SparseAssignment, FailsWithMoreRowsThanColumns)
+{
+  SparseAssignment solver(3, 2);
+  for (int row = 0; row < 3; row++) {
+    solver.addCandidate(row, 0, 1);
+    solver.addCandidate(row, 1, 1);
+  }
+  std::vector<int> row_to_col;
+  EXPECT_FALSE(solver.solve(row_to_col));
+}
+
+TEST(SparseAssignment, ReassignsForCheaperTotal)
+{
+  // Row 0 prefers column 0, but giving it to row 1 is cheaper overall.
+  SparseAssignment solver(2, 2);
+  solver.addCandidate(0, 0, 1);
+  solver.addCandidate(0, 1, 2);
+  solver.addCandidate(1, 0, 1);
+  solver.addCandidate(1, 1, 10);
+  std::vector<int> row_to_col;
+  ASSERT_TRUE(solver.solve(row_to_col));
+  EXPECT_EQ(row_to_col[0], 1);
+  EXPECT_EQ(row_to_col[1], 0);
+}
+
+}  // namespace ppl
@@ -0,0 +1,66 @@
+# place_pins -sparse_matching places every pin at distinct positions, with
+# the same result on any number of threads and close to the full matching.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def gcd.def
+
+set block [ord::get_db_block]
+
+# Positions of the pins and the total HPWL of their nets, measured between
+# the pin and the origins of the connected instances.
+proc pin_placement { block } {
+  set positions {}
+  set hpwl 0
+  foreach bterm [$block getBTerms] {
+    set box [$bterm getBBox]
+    set x [$box xCenter]
+    set y [$box yCenter]
+    lappend positions "[$bterm getName] $x $y"
+    set min_x $x
+    set max_x $x
+    set min_y $y
+    set max_y $y
+    foreach iterm [[$bterm getNet] getITerms] {
+      lassign [[$iterm getInst] getLocation] inst_x inst_y
+      set min_x [expr { min($min_x, $inst_x) }]
+      set max_x [expr { max($max_x, $inst_x) }]
+      set min_y [expr { min($min_y, $inst_y) }]
+      set max_y [expr { max($max_y, $inst_y) }]
+    }
+    set hpwl [expr { $hpwl + $max_x - $min_x + $max_y - $min_y }]
+  }
+  return [list $positions $hpwl]
+}
+
+set args {-hor_layers metal3 -ver_layers metal2 -corner_avoidance 0
+  -min_distance 0.12}
+
+place_pins {*}$args
+lassign [pin_placement $block] dense_positions dense_hpwl
+
+set_thread_count 1
+place_pins {*}$args -sparse_matching
+lassign [pin_placement $block] serial_positions sparse_hpwl
+
+set_thread_count 4
+place_pins {*}$args -sparse_matching
+lassign [pin_placement $block] parallel_positions parallel_hpwl
+
+if { $serial_positions != $parallel_positions } {
+  error "sparse matching differs between 1 and 4 threads"
+}
+
+set locations {}
+foreach pin $serial_positions {
+  lappend locations [lrange $pin 1 2]
+}
+if { [llength [lsort -unique $locations]] != [llength $locations] } {
+  error "sparse matching placed pins at the same position"
+}
+
+puts "dense HPWL $dense_hpwl sparse HPWL $sparse_hpwl"
+if { $sparse_hpwl > 1.01 * $dense_hpwl } {
+  error "sparse matching HPWL is more than 1% above the full matching"
+}
+
+puts pass
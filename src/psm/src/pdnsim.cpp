@@ -24,6 +24,7 @@
 #include "shape.h"
 #include "sta/Liberty.hh"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 
 using odb::dbBlock;
 using odb::dbSigType;
@@ -88,6 +89,7 @@ void PDNSim::analyzePowerGrid(odb::dbNet* net,
                               const std::string& error_file,
                               const std::string& voltage_source_file)
 {
+  utl::TraceScope trace("psm::analyzePowerGrid");
   if (!checkConnectivity(net, false, error_file, false)) {
     return;
   }
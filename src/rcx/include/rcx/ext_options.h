@@ -52,6 +52,8 @@ struct ExtractOptions
   bool lef_rc = false;
   bool lef_res = false;
   int _dbg = 0;
+  // Threads used to order the wires before extraction
+  int num_threads = 1;
 
   // v2-only variables:
   bool _v2 = false;
@@ -21,6 +21,7 @@
 #include "rcx/multiChipExtractor.h"
 #include "rcx/multiChipSpefWriter.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 
 namespace rcx {
 
@@ -250,10 +251,11 @@ void Ext::setAssemblyExtractionRulesFile(
 
 void Ext::extract(ExtractOptions options)
 {
+  utl::TraceScope trace("rcx::extract");
   _ext->setBlockFromChip(_db->getChip());
   odb::dbBlock* block = _ext->getBlock();
 
-  odb::orderWires(logger_, block);
+  odb::orderWires(logger_, block, options.num_threads);
 
   if (options.ext_model_file != nullptr && options.ext_model_file[0] != '\0') {
     logger_->warn(RCX,
@@ -119,6 +119,7 @@ extract(const char* ext_model_file,
   opts._version= version;
 
   opts._dbg= dbg;
+  opts.num_threads = ord::getOpenRoad()->getThreadCount();
 
   odb::dbChip* top_chip = ord::getOpenRoad()->getDb()->getChip();
   if (!top_chip) {
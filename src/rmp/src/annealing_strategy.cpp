@@ -59,8 +59,8 @@ std::vector<GiaOp> AnnealingStrategy::RunStrategy(
   }
 
   SolutionSlack sol_slack{ops};
-  auto [worst_slack, required] = sol_slack.Evaluate(
-      candidate_vertices, abc_library, corner_, sta, name_generator, logger);
+  auto [worst_slack, required] = EvaluateCached(
+      sol_slack, candidate_vertices, abc_library, sta, name_generator, logger);
 
   if (!temperature_) {
     temperature_ = required;
@@ -110,8 +110,12 @@ std::vector<GiaOp> AnnealingStrategy::RunStrategy(
     auto new_ops = s.RandomNeighbor(all_ops, logger, random_);
     sol_slack = SolutionSlack{new_ops};
 
-    auto [worst_slack_new, _] = sol_slack.Evaluate(
-        candidate_vertices, abc_library, corner_, sta, name_generator, logger);
+    auto [worst_slack_new, _] = EvaluateCached(sol_slack,
+                                               candidate_vertices,
+                                               abc_library,
+                                               sta,
+                                               name_generator,
+                                               logger);
 
     if (worst_slack_new < best_worst_slack) {
       worse_iters++;
@@ -75,8 +75,12 @@ std::vector<GiaOp> GeneticStrategy::RunStrategy(
   }
 
   for (auto& candidate : population) {
-    (void) candidate.Evaluate(
-        candidate_vertices, abc_library, corner_, sta, name_generator, logger);
+    (void) EvaluateCached(candidate,
+                          candidate_vertices,
+                          abc_library,
+                          sta,
+                          name_generator,
+                          logger);
 
     debugPrint(logger, RMP, "genetic", 1, candidate.toString());
   }
@@ -116,12 +120,12 @@ std::vector<GiaOp> GeneticStrategy::RunStrategy(
       if (sol_slack.WorstSlack()) {
         continue;
       }
-      (void) sol_slack.Evaluate(candidate_vertices,
-                                abc_library,
-                                corner_,
-                                sta,
-                                name_generator,
-                                logger);
+      (void) EvaluateCached(sol_slack,
+                            candidate_vertices,
+                            abc_library,
+                            sta,
+                            name_generator,
+                            logger);
     }
     // Selection
     std::ranges::stable_sort(
@@ -23,6 +23,7 @@
 #include "sta/Transition.hh"
 #include "utils.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/unique_name.h"
 
 namespace rmp {
@@ -140,11 +141,39 @@ std::pair<sta::Slack, sta::Delay> SolutionSlack::Evaluate(
   return {worst_slack, required};
 }
 
+std::pair<sta::Slack, sta::Delay> SlackTuningStrategy::EvaluateCached(
+    SolutionSlack& solution,
+    const std::vector<sta::Vertex*>& candidate_vertices,
+    cut::AbcLibrary& abc_library,
+    sta::dbSta* sta,
+    utl::UniqueName& name_generator,
+    utl::Logger* logger)
+{
+  auto it = evaluated_.find(solution.Solution());
+  if (it != evaluated_.end()) {
+    cache_hits_++;
+    solution.SetWorstSlack(it->second.first);
+    debugPrint(logger,
+               RMP,
+               "slack_tunning",
+               2,
+               "Reusing evaluation of {}",
+               solution.toString());
+    return it->second;
+  }
+
+  const auto result = solution.Evaluate(
+      candidate_vertices, abc_library, corner_, sta, name_generator, logger);
+  evaluated_.emplace(solution.Solution(), result);
+  return result;
+}
+
 void SlackTuningStrategy::OptimizeDesign(sta::dbSta* sta,
                                          utl::UniqueName& name_generator,
                                          rsz::Resizer* resizer,
                                          utl::Logger* logger)
 {
+  utl::TraceScope trace("rmp::slackTuning");
   sta->ensureGraph();
   sta->ensureLevelized();
   sta->searchPreamble();
@@ -181,6 +210,13 @@ void SlackTuningStrategy::OptimizeDesign(sta::dbSta* sta,
                                      resizer,
                                      logger);
 
+  debugPrint(logger,
+             RMP,
+             "slack_tunning",
+             1,
+             "Evaluated {} distinct op sequences, {} repeats reused",
+             evaluated_.size(),
+             cache_hits_);
   logger->info(
       RMP, 67, "Resynthesis: End of slack tuning, applying ABC operations");
 
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "cut/abc_library_factory.h"
 #include "gia.h"
 #include "resynthesis_strategy.h"
@@ -63,6 +66,7 @@ class SolutionSlack final
   ResultOps Solution() const { return solution_; }
   ResultOps& Solution() { return solution_; }
   std::optional<sta::Slack> WorstSlack() const { return worst_slack_; }
+  void SetWorstSlack(sta::Slack worst_slack) { worst_slack_ = worst_slack; }
 };
 
 class SlackTuningStrategy : public ResynthesisStrategy
@@ -96,12 +100,35 @@ class SlackTuningStrategy : public ResynthesisStrategy
       utl::Logger* logger)
       = 0;
 
+  // Number of distinct op sequences evaluated, and of evaluations served
+  // from them instead.
+  size_t EvaluatedCount() const { return evaluated_.size(); }
+  size_t CacheHits() const { return cache_hits_; }
+
  protected:
+  // Evaluates `solution` unless the same op sequence was evaluated before.
+  // Every evaluation is undone on the design, so an op sequence always
+  // times the same and its result can be reused.
+  std::pair<sta::Slack, sta::Delay> EvaluateCached(
+      SolutionSlack& solution,
+      const std::vector<sta::Vertex*>& candidate_vertices,
+      cut::AbcLibrary& abc_library,
+      sta::dbSta* sta,
+      utl::UniqueName& name_generator,
+      utl::Logger* logger);
+
   sta::Scene* corner_;
   sta::Slack slack_threshold_;
   unsigned iterations_;
   unsigned initial_ops_;
   std::mt19937 random_;
+
+ private:
+  std::unordered_map<SolutionSlack::ResultOps,
+                     std::pair<sta::Slack, sta::Delay>,
+                     absl::Hash<SolutionSlack::ResultOps>>
+      evaluated_;
+  size_t cache_hits_ = 0;
 };
 
 }  // namespace rmp
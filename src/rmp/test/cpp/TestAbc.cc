@@ -10,6 +10,8 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/abc/abc.h"
 #include "base/main/abcapis.h"
@@ -19,15 +21,20 @@
 #include "db_sta/dbReadVerilog.hh"
 #include "db_sta/dbSta.hh"
 #include "delay_optimization_strategy.h"
+#include "gia.h"
 #include "gtest/gtest.h"
 #include "map/mio/mio.h"
 #include "map/scl/sclLib.h"
 #include "odb/db.h"
 #include "odb/dbSet.h"
 #include "odb/lefin.h"
+#include "slack_tuning_strategy.h"
+#include "sta/Delay.hh"
 #include "sta/Graph.hh"
 #include "sta/Liberty.hh"
+#include "sta/MinMax.hh"
 #include "sta/NetworkClass.hh"
+#include "sta/PortDirection.hh"
 #include "sta/SdcClass.hh"
 #include "sta/Sta.hh"
 #include "sta/VerilogReader.hh"
@@ -127,6 +134,33 @@ class AbcTest : public tst::Fixture
   sta::LibertyLibrary* library_;
 };
 
+// Exposes the evaluation cache of the slack tuning strategies.
+class CachedEvaluator : public SlackTuningStrategy
+{
+ public:
+  explicit CachedEvaluator(sta::Scene* corner)
+      : SlackTuningStrategy(corner,
+                            /*slack_threshold=*/0,
+                            /*seed=*/0,
+                            /*iterations=*/0,
+                            /*initial_ops=*/0)
+  {
+  }
+
+  std::vector<GiaOp> RunStrategy(const std::vector<GiaOp>&,
+                                 const std::vector<sta::Vertex*>&,
+                                 cut::AbcLibrary&,
+                                 sta::dbSta*,
+                                 utl::UniqueName&,
+                                 rsz::Resizer*,
+                                 utl::Logger*) override
+  {
+    return {};
+  }
+
+  using SlackTuningStrategy::EvaluateCached;
+};
+
 TEST_F(AbcTest, InsertingMappedLogicAfterOptimizationCutDoesNotThrow)
 {
   AbcLibraryFactory factory(&logger_);
@@ -170,4 +204,68 @@ TEST_F(AbcTest, ResynthesisStrategyDoesNotThrow)
       zero_slack.OptimizeDesign(sta_.get(), name_generator, nullptr, &logger_));
 }
 
+TEST_F(AbcTest, SlackTuningReusesEvaluationOfRepeatedOps)
+{
+  LoadVerilog(kPrefix + "aes_nangate45.v", /*top=*/"aes_cipher_top");
+
+  sta::dbNetwork* network = sta_->getDbNetwork();
+  std::vector<sta::Vertex*> candidate_vertices;
+  for (sta::Vertex* vertex : sta_->endpoints()) {
+    if (network->direction(vertex->pin())->isInput()
+        && sta_->slack(vertex, sta::MinMax::max()) < 0) {
+      candidate_vertices.push_back(vertex);
+    }
+  }
+  ASSERT_FALSE(candidate_vertices.empty());
+
+  AbcLibraryFactory factory(&logger_);
+  factory.AddDbSta(sta_.get());
+  AbcLibrary abc_library = factory.Build();
+
+  const std::vector<GiaOp> all_ops = GiaOps(&logger_);
+  ASSERT_GE(all_ops.size(), 2);
+  const std::vector<GiaOp> ops = {all_ops[0], all_ops[1]};
+  const std::vector<GiaOp> swapped_ops = {all_ops[1], all_ops[0]};
+
+  utl::UniqueName name_generator;
+  CachedEvaluator evaluator(sta_->cmdScene());
+  auto evaluate = [&](std::vector<GiaOp> solution_ops) {
+    SolutionSlack solution(std::move(solution_ops));
+    auto result = evaluator.EvaluateCached(solution,
+                                           candidate_vertices,
+                                           abc_library,
+                                           sta_.get(),
+                                           name_generator,
+                                           &logger_);
+    EXPECT_EQ(solution.WorstSlack(), result.first);
+    return result;
+  };
+
+  const std::pair<sta::Slack, sta::Delay> first = evaluate(ops);
+  EXPECT_EQ(evaluator.EvaluatedCount(), 1);
+  EXPECT_EQ(evaluator.CacheHits(), 0);
+
+  // The same sequence is served from the cache with the same result, which
+  // matches a fresh evaluation.
+  const std::pair<sta::Slack, sta::Delay> repeated = evaluate(ops);
+  EXPECT_EQ(evaluator.EvaluatedCount(), 1);
+  EXPECT_EQ(evaluator.CacheHits(), 1);
+  EXPECT_EQ(repeated, first);
+
+  SolutionSlack uncached(ops);
+  EXPECT_EQ(uncached.Evaluate(candidate_vertices,
+                              abc_library,
+                              sta_->cmdScene(),
+                              sta_.get(),
+                              name_generator,
+                              &logger_),
+            first);
+
+  // The same ops in another order and a prefix are distinct sequences.
+  evaluate(swapped_ops);
+  evaluate({all_ops[0]});
+  EXPECT_EQ(evaluator.EvaluatedCount(), 3);
+  EXPECT_EQ(evaluator.CacheHits(), 1);
+}
+
 }  // namespace rmp
@@ -90,6 +90,7 @@
 #include "sta/Units.hh"
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
+#include "utl/Trace.h"
 #include "utl/algorithms.h"
 #include "utl/scope.h"
 #include "utl/timer.h"
@@ -4991,6 +4992,7 @@ void Resizer::repairDesign(double max_wire_length,
                            bool reroute,
                            bool verbose)
 {
+  utl::TraceScope trace("rsz::repairDesign");
   utl::Timer timer;
   utl::SetAndRestore set_match_footprint(match_cell_footprint_,
                                          match_cell_footprint);
@@ -5277,6 +5279,7 @@ bool Resizer::repairSetup(double setup_margin,
                           bool skip_vt_swap,
                           bool skip_crit_vt_swap)
 {
+  utl::TraceScope trace("rsz::repairSetup");
   utl::Timer timer;
   OptimizerRunConfig config;
   // Freeze Tcl-facing repair setup knobs before policy dispatch.
@@ -5361,6 +5364,7 @@ bool Resizer::repairHold(
     bool match_cell_footprint,
     bool verbose)
 {
+  utl::TraceScope trace("rsz::repairHold");
   utl::Timer timer;
   utl::SetAndRestore set_match_footprint(match_cell_footprint_,
                                          match_cell_footprint);
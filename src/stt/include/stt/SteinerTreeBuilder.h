@@ -71,6 +71,9 @@ class SteinerTreeBuilder
                        int acc);
 
   bool checkTree(const Tree& tree) const;
+  // makeSteinerTree lazily initializes the flute tables on first use.
+  // Call this before building trees from several threads at once.
+  void prepareConcurrentTrees();
   float getAlpha() const { return alpha_; }
   void setAlpha(float alpha);
   float getAlpha(const odb::dbNet* net) const;
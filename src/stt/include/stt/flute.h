@@ -28,6 +28,9 @@ class Flute
                const std::vector<int>& x,
                const std::vector<int>& y,
                int acc);
+  // Initialize the lookup tables for every degree so that later calls
+  // never modify them and may run concurrently.
+  void initAllLUT();
 
  private:
   struct Csoln;
@@ -253,6 +253,11 @@ int SteinerTreeBuilder::computeHPWL(odb::dbNet* net)
   return hpwl;
 }
 
+void SteinerTreeBuilder::prepareConcurrentTrees()
+{
+  flute_->initAllLUT();
+}
+
 Tree SteinerTreeBuilder::flute(const std::vector<int>& x,
                                const std::vector<int>& y,
                                int acc)
@@ -234,6 +234,11 @@ void Flute::ensureLUT(const int d)
   }
 }
 
+void Flute::initAllLUT()
+{
+  ensureLUT(kMaxLutDegree);
+}
+
 ////////////////////////////////////////////////////////////////
 
 int Flute::flute_wl(const int d,
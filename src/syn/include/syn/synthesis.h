@@ -86,8 +86,9 @@ class Synthesis : public sta::dbStaState
   // Split wide bitwise operations into per-bit fine operations.
   void bitblast(bool blast_arith = true);
 
-  // Map combinational gates to library cells.
-  void mapCombinationals();
+  // Map combinational gates to library cells.  Cut enumeration runs level
+  // by level on num_threads threads.
+  void mapCombinationals(int num_threads = 1);
 
   // Export AIG to ABC, run commands, reimport.
   void abcRoundtrip(const std::string& commands, int naming_threshold = -1);
@@ -141,7 +142,8 @@ void mapSequentials(Graph& g,
 void mapCombinationals(Graph& g,
                        sta::Network* network,
                        utl::Logger* logger,
-                       const Synthesis& syn);
+                       const Synthesis& syn,
+                       int num_threads = 1);
 void abcRoundtrip(Graph& g,
                   const std::string& commands,
                   utl::Logger* logger,
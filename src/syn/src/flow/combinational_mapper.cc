@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <span>
 #include <utility>
@@ -31,6 +32,8 @@
 #include "syn/ir/Instance.h"
 #include "syn/synthesis.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
+#include "utl/Trace.h"
 
 namespace syn {
 
@@ -119,6 +122,9 @@ struct ClassMatch
 {
   Truth6 semiclass = 0;
   NPN npn;
+  // Library targets of the (ninputs, semiclass) class, resolved once when
+  // the match is recorded
+  const std::vector<MapTarget>* targets = nullptr;
   Net cut[kCutMaximum] = {Net::sentinel(),
                           Net::sentinel(),
                           Net::sentinel(),
@@ -127,12 +133,60 @@ struct ClassMatch
                           Net::sentinel()};
 };
 
+struct PriorityCut
+{
+  Net cut[kCutMaximum] = {Net::sentinel(),
+                          Net::sentinel(),
+                          Net::sentinel(),
+                          Net::sentinel(),
+                          Net::sentinel(),
+                          Net::sentinel()};
+  int ncut = 0;
+  Truth6 function = 0;
+};
+
+// Chunked storage for ClassMatch records. Nodes point into the chunks, so
+// they are never moved or freed while the mapping is alive.
+class MatchArena
+{
+ public:
+  // Returns a buffer with room for n matches without allocating it
+  ClassMatch* reserve(int n);
+
+  ClassMatch* alloc(int n);
+
+ private:
+  std::vector<std::unique_ptr<ClassMatch[]>> chunks_;
+  int slot_ = 0;
+  static constexpr int kChunk = 2048;
+};
+
+ClassMatch* MatchArena::reserve(const int n)
+{
+  assert(n <= kChunk);
+  if (slot_ + n > kChunk || chunks_.empty()) {
+    chunks_.push_back(std::make_unique<ClassMatch[]>(kChunk));
+    slot_ = 0;
+  }
+  ClassMatch* ret = &chunks_.back()[slot_];
+  // We are reserving but not allocating: do not increment slot_
+  return ret;
+}
+
+ClassMatch* MatchArena::alloc(const int n)
+{
+  assert(n <= kChunk);
+  ClassMatch* ret = reserve(n);
+  slot_ += n;
+  return ret;
+}
+
 struct NodePolarity
 {
   int map_fouts = 0;
   float flow_fouts = 1.0f;
   float farea = 0.0f;
-  std::pair<ClassMatch*, MapTarget*> selected;
+  std::pair<ClassMatch*, const MapTarget*> selected;
 };
 
 struct Node
@@ -167,11 +221,7 @@ class Mapping
  public:
   using Literal = ControlNet;
 
-  Mapping(utl::Logger* logger, const Subject& subject);
-
-  ClassMatch* reserveMatches(int n);
-
-  ClassMatch* allocMatches(int n);
+  Mapping(utl::Logger* logger, const Subject& subject, int num_threads = 1);
 
   Node* node(Net net) { return &nodes_[Graph::netId(net)]; }
 
@@ -185,6 +235,10 @@ class Mapping
 
   void prepareMatches(int npriority_cuts, int nmatches_max, int max_cut_len);
 
+  void prepareMatchesParallel(int npriority_cuts,
+                              int nmatches_max,
+                              int max_cut_len);
+
   float refCut(const Literal& lit);
 
   void derefCut(const Literal& lit);
@@ -202,20 +256,51 @@ class Mapping
   void integrate();
 
  private:
+  struct GateFanins
+  {
+    Net fanin1 = Net::sentinel();
+    Net fanin2 = Net::sentinel();
+    bool in1_compl = false;
+    bool in2_compl = false;
+    bool out_compl = false;
+  };
+
+  GateFanins gateFanins(Net net) const;
+
+  // Enumerates the cuts of the mappable `net` from the priority cuts of its
+  // fanins (looked up through `fanin_cuts`). Up to cuts.size() cuts are
+  // stored in `cuts` and up to matches.size() library matches in `matches`.
+  // Returns the number of cuts and matches stored.
+  template <typename FaninCuts>
+  std::pair<int, int> enumerateCuts(Net net,
+                                    FaninCuts&& fanin_cuts,
+                                    std::span<PriorityCut> cuts,
+                                    std::span<ClassMatch> matches,
+                                    int max_cut_len) const;
+
   utl::Logger* logger_;
   Subject subject_;
+  int num_threads_;
   std::vector<Node> nodes_;
   std::vector<ControlNet> primary_outputs_;
   std::vector<std::pair<ControlNet, Net>> primary_output_fixups_;
 
-  // Match arena
-  std::vector<std::unique_ptr<ClassMatch[]>> match_arena_;
-  int arena_slot_ = 0;
-  static constexpr int kArenaChunk = 2048;
+  // One match arena per worker so that enumeration never shares an
+  // allocator between threads; arena 0 serves the serial path.
+  std::vector<MatchArena> match_arenas_;
+
+  // Parallel enumeration only pays off once a level has this many nodes
+  // per thread.
+  static constexpr int kMinNodesPerThread = 256;
 };
 
-Mapping::Mapping(utl::Logger* logger, const Subject& subject)
-    : logger_(logger), subject_(subject)
+Mapping::Mapping(utl::Logger* logger,
+                 const Subject& subject,
+                 const int num_threads)
+    : logger_(logger),
+      subject_(subject),
+      num_threads_(std::max(num_threads, 1)),
+      match_arenas_(num_threads_)
 {
   nodes_.resize(subject_.graph.tableSize());
 }
@@ -231,26 +316,6 @@ bool Mapping::isMappable(Net net)
   return isMappable(inst);
 }
 
-ClassMatch* Mapping::reserveMatches(const int n)
-{
-  assert(n <= kArenaChunk);
-  if (arena_slot_ + n > kArenaChunk || match_arena_.empty()) {
-    match_arena_.push_back(std::make_unique<ClassMatch[]>(kArenaChunk));
-    arena_slot_ = 0;
-  }
-  ClassMatch* ret = &match_arena_.back()[arena_slot_];
-  // We are reserving but not allocating: do not increment arena_slot_
-  return ret;
-}
-
-ClassMatch* Mapping::allocMatches(const int n)
-{
-  assert(n <= kArenaChunk);
-  ClassMatch* ret = reserveMatches(n);
-  arena_slot_ += n;
-  return ret;
-}
-
 void Mapping::collectPrimaryOutputs()
 {
   std::set<ControlNet> primary_output_nets;
@@ -311,24 +376,186 @@ void Mapping::computeFanouts()
   }
 }
 
+Mapping::GateFanins Mapping::gateFanins(Net net) const
+{
+  GateFanins gate;
+  auto [inst, offset] = subject_.graph.resolve(net);
+  if (auto* op = inst->try_as<And>()) {
+    gate.fanin1 = op->a()[offset];
+    gate.fanin2 = op->b()[offset];
+  } else if (auto* op = inst->try_as<Andnot>()) {
+    gate.fanin1 = op->a()[offset];
+    gate.fanin2 = op->b()[offset];
+    gate.in2_compl = true;
+  } else if (auto* op = inst->try_as<Or>()) {
+    gate.fanin1 = op->a()[offset];
+    gate.fanin2 = op->b()[offset];
+    gate.in1_compl = true;
+    gate.in2_compl = true;
+    gate.out_compl = true;
+  } else {
+    std::abort();
+  }
+  return gate;
+}
+
+template <typename FaninCuts>
+std::pair<int, int> Mapping::enumerateCuts(Net net,
+                                           FaninCuts&& fanin_cuts,
+                                           std::span<PriorityCut> cuts,
+                                           std::span<ClassMatch> matches,
+                                           const int max_cut_len) const
+{
+  const GateFanins gate = gateFanins(net);
+  const std::span<const PriorityCut> ps1 = fanin_cuts(gate.fanin1);
+  const std::span<const PriorityCut> ps2 = fanin_cuts(gate.fanin2);
+
+  const Net t1[kCutMaximum] = {gate.fanin1,
+                               Net::sentinel(),
+                               Net::sentinel(),
+                               Net::sentinel(),
+                               Net::sentinel(),
+                               Net::sentinel()};
+  const Net t2[kCutMaximum] = {gate.fanin2,
+                               Net::sentinel(),
+                               Net::sentinel(),
+                               Net::sentinel(),
+                               Net::sentinel(),
+                               Net::sentinel()};
+
+  auto cutLen = [](const Net* cut) {
+    for (int i = 0; i < kCutMaximum; i++) {
+      if (cut[i] == Net::sentinel()) {
+        return i;
+      }
+    }
+    return kCutMaximum;
+  };
+
+  const auto& classes = subject_.target_index->classes;
+  std::set<uint64_t> seenCuts;
+
+  int matchSlot = 0;
+  int psSlot = 0;
+
+  for (int i = -1; i < (int) ps1.size(); i++) {
+    for (int j = -1; j < (int) ps2.size(); j++) {
+      const Net* n1Cut = ((i == -1) ? t1 : ps1[i].cut);
+      const Net* n2Cut = ((j == -1) ? t2 : ps2[j].cut);
+      int n1CutLen = (i == -1) ? 1 : cutLen(n1Cut);
+      int n2CutLen = (j == -1) ? 1 : cutLen(n2Cut);
+
+      Truth6 n1Func = ((i == -1) ? (Truth6) 2 : ps1[i].function);
+      if (gate.in1_compl) {
+        n1Func ^= mask6(n1CutLen);
+      }
+      Truth6 n2Func = ((j == -1) ? (Truth6) 2 : ps2[j].function);
+      if (gate.in2_compl) {
+        n2Func ^= mask6(n2CutLen);
+      }
+
+      Net workingCut[kCutMaximum] = {
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+      };
+      int workingLen = 0;
+      if (!cutUnion(workingCut, workingLen, max_cut_len, n1Cut, n2Cut)) {
+        continue;
+      }
+
+      Truth6 cutFunction
+          = recode6(n1Func, n1Cut, n1CutLen, workingCut, workingLen)
+            & recode6(n2Func, n2Cut, n2CutLen, workingCut, workingLen);
+      if (gate.out_compl) {
+        cutFunction ^= mask6(workingLen);
+      }
+
+      // Remove unsupported variables
+      Net reducedCut[kCutMaximum] = {
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+          Net::sentinel(),
+      };
+      int reducedLen = 0;
+      for (int idx = 0; idx < workingLen; idx++) {
+        if (checkSupport6(cutFunction, idx)) {
+          reducedCut[reducedLen++] = workingCut[idx];
+        }
+      }
+
+      if (reducedLen < workingLen) {
+        cutFunction = recode6(
+            cutFunction, workingCut, workingLen, reducedCut, reducedLen);
+      }
+
+      // Dedup cuts
+      uint64_t cutHash = reducedLen;
+      for (int k = 0; k < reducedLen; k++) {
+        cutHash
+            = cutHash * 6364136223846793005ULL + Graph::netId(reducedCut[k]);
+      }
+      if (seenCuts.contains(cutHash)) {
+        continue;
+      }
+      seenCuts.insert(cutHash);
+
+      // Try to match against library
+      if (matchSlot < (int) matches.size()) {
+        NPN npn;
+        Truth6 sc = npnSemiclass(cutFunction, reducedLen, npn);
+        auto it = classes.find({reducedLen, sc});
+        if (it != classes.end()) {
+          ClassMatch& m = matches[matchSlot];
+          m.semiclass = sc;
+          m.npn = npn;
+          m.targets = &it->second;
+          for (int k = 0; k < reducedLen; k++) {
+            m.cut[k] = reducedCut[k];
+          }
+          for (int k = reducedLen; k < kCutMaximum; k++) {
+            m.cut[k] = Net::undef();
+          }
+          matchSlot++;
+        }
+      }
+
+      // Store in priority cut cache
+      if (psSlot < (int) cuts.size()) {
+        auto& pc = cuts[psSlot];
+        pc.ncut = reducedLen;
+        for (int k = 0; k < reducedLen; k++) {
+          pc.cut[k] = reducedCut[k];
+        }
+        for (int k = reducedLen; k < kCutMaximum; k++) {
+          pc.cut[k] = Net::sentinel();
+        }
+        pc.function = cutFunction;
+        psSlot++;
+      }
+    }
+  }
+
+  return {psSlot, matchSlot};
+}
+
 void Mapping::prepareMatches(const int npriority_cuts,
                              const int nmatches_max,
                              const int max_cut_len)
 {
   assert(max_cut_len >= 3 && max_cut_len <= kCutMaximum);
+  if (num_threads_ > 1) {
+    prepareMatchesParallel(npriority_cuts, nmatches_max, max_cut_len);
+    return;
+  }
   debugPrint(logger_, utl::SYN, "cm", 1, "collecting matches");
 
-  struct PriorityCut
-  {
-    Net cut[kCutMaximum] = {Net::sentinel(),
-                            Net::sentinel(),
-                            Net::sentinel(),
-                            Net::sentinel(),
-                            Net::sentinel(),
-                            Net::sentinel()};
-    int ncut = 0;
-    Truth6 function = 0;
-  };
   struct NodeCache
   {
     std::span<PriorityCut> ps;
@@ -385,191 +612,165 @@ void Mapping::prepareMatches(const int npriority_cuts,
   std::vector<PriorityCut> pcuts(
       static_cast<size_t>(frontierSize) * npriority_cuts, PriorityCut{});
   std::vector<NodeCache> cache(frontierSize, NodeCache{});
+  MatchArena& arena = match_arenas_[0];
+
+  auto faninCuts = [&](Net fanin) {
+    const NodeCache& fcache = cache[node(fanin)->fid];
+    (void) fcache;
+    assert(fcache.mark == fanin);
+    return std::span<const PriorityCut>(fcache.ps);
+  };
 
   subject_.graph.forEachNet([&](Net net, const Instance*, uint32_t) {
     Node* cur = node(net);
     NodeCache* lcache = &cache[cur->fid];
-    lcache->ps = std::span<PriorityCut>(
-        &pcuts[static_cast<size_t>(cur->fid) * npriority_cuts], 0);
+    const std::span<PriorityCut> slot(
+        &pcuts[static_cast<size_t>(cur->fid) * npriority_cuts],
+        npriority_cuts);
+    lcache->ps = slot.first(0);
     lcache->mark = net;
 
     if (!isMappable(net)) {
       return;
     }
 
-    bool in1Compl = false, in2Compl = false, outCompl = false;
-    Net fanin1 = Net::sentinel(), fanin2 = Net::sentinel();
-
-    auto [inst, offset] = subject_.graph.resolve(net);
-    if (auto* op = inst->try_as<And>()) {
-      fanin1 = op->a()[offset];
-      fanin2 = op->b()[offset];
-    } else if (auto* op = inst->try_as<Andnot>()) {
-      fanin1 = op->a()[offset];
-      fanin2 = op->b()[offset];
-      in2Compl = true;
-    } else if (auto* op = inst->try_as<Or>()) {
-      fanin1 = op->a()[offset];
-      fanin2 = op->b()[offset];
-      in1Compl = true;
-      in2Compl = true;
-      outCompl = true;
-    } else {
-      std::abort();
-    }
-
-    Node *n1 = node(fanin1), *n2 = node(fanin2);
-    assert(n1 && n2);
-    assert(cache[n1->fid].mark == fanin1);
-    assert(cache[n2->fid].mark == fanin2);
-
-    Net t1[kCutMaximum] = {fanin1,
-                           Net::sentinel(),
-                           Net::sentinel(),
-                           Net::sentinel(),
-                           Net::sentinel(),
-                           Net::sentinel()};
-    Net t2[kCutMaximum] = {fanin2,
-                           Net::sentinel(),
-                           Net::sentinel(),
-                           Net::sentinel(),
-                           Net::sentinel(),
-                           Net::sentinel()};
-
-    auto cutLen = [](const Net* cut) {
-      for (int i = 0; i < kCutMaximum; i++) {
-        if (cut[i] == Net::sentinel()) {
-          return i;
-        }
-      }
-      return kCutMaximum;
-    };
-
-    std::set<uint64_t> seenCuts;
-
-    int matchSlot = 0;
-    int psSlot = 0;
-
     // Conservatively reserve a buffer for the maximal number of matches.
-    // Later we will call `allocMatches` to allocate the used portion of
+    // Later we will call `alloc` to allocate the used portion of
     // the buffer. This way we don't overallocate and waste slots.
-    ClassMatch* matchBuf = reserveMatches(nmatches_max);
-
-    for (int i = -1; i < (int) cache[n1->fid].ps.size(); i++) {
-      for (int j = -1; j < (int) cache[n2->fid].ps.size(); j++) {
-        Net* n1Cut = ((i == -1) ? t1 : cache[n1->fid].ps[i].cut);
-        Net* n2Cut = ((j == -1) ? t2 : cache[n2->fid].ps[j].cut);
-        int n1CutLen = (i == -1) ? 1 : cutLen(n1Cut);
-        int n2CutLen = (j == -1) ? 1 : cutLen(n2Cut);
-
-        Truth6 n1Func
-            = ((i == -1) ? (Truth6) 2 : cache[n1->fid].ps[i].function);
-        if (in1Compl) {
-          n1Func ^= mask6(n1CutLen);
-        }
-        Truth6 n2Func
-            = ((j == -1) ? (Truth6) 2 : cache[n2->fid].ps[j].function);
-        if (in2Compl) {
-          n2Func ^= mask6(n2CutLen);
-        }
+    ClassMatch* matchBuf = arena.reserve(nmatches_max);
+    const auto [ncuts, nmatches] = enumerateCuts(
+        net, faninCuts, slot, {matchBuf, (size_t) nmatches_max}, max_cut_len);
 
-        Net workingCut[kCutMaximum] = {
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-        };
-        int workingLen = 0;
-        if (!cutUnion(workingCut, workingLen, max_cut_len, n1Cut, n2Cut)) {
-          continue;
-        }
-
-        Truth6 cutFunction
-            = recode6(n1Func, n1Cut, n1CutLen, workingCut, workingLen)
-              & recode6(n2Func, n2Cut, n2CutLen, workingCut, workingLen);
-        if (outCompl) {
-          cutFunction ^= mask6(workingLen);
-        }
+    lcache->ps = slot.first(ncuts);
+    ClassMatch* allocatedBuf = arena.alloc(nmatches);
+    (void) allocatedBuf;
+    assert(allocatedBuf == matchBuf);
+    cur->matches = matchBuf;
+    cur->nmatches = nmatches;
+    matchesTotal += nmatches;
+  });
 
-        // Remove unsupported variables
-        Net reducedCut[kCutMaximum] = {
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-            Net::sentinel(),
-        };
-        int reducedLen = 0;
-        for (int idx = 0; idx < workingLen; idx++) {
-          if (checkSupport6(cutFunction, idx)) {
-            reducedCut[reducedLen++] = workingCut[idx];
-          }
-        }
+  debugPrint(logger_, utl::SYN, "cm", 1, "matches total = {}", matchesTotal);
+}
 
-        if (reducedLen < workingLen) {
-          cutFunction = recode6(
-              cutFunction, workingCut, workingLen, reducedCut, reducedLen);
-        }
+// Cut enumeration of a node only reads the cuts of its fanins, so all nodes
+// of one logic level are independent.  Levels are processed in order and
+// each level is split into contiguous chunks, one per worker, each with its
+// own match arena.  A priority cut slot is recycled once every fanout level
+// of its net is done, which keeps the frontier close to the widest pair of
+// adjacent levels.
+void Mapping::prepareMatchesParallel(const int npriority_cuts,
+                                     const int nmatches_max,
+                                     const int max_cut_len)
+{
+  debugPrint(logger_,
+             utl::SYN,
+             "cm",
+             1,
+             "collecting matches ({} threads)",
+             num_threads_);
 
-        // Dedup cuts
-        uint64_t cutHash = reducedLen;
-        for (int k = 0; k < reducedLen; k++) {
-          cutHash
-              = cutHash * 6364136223846793005ULL + Graph::netId(reducedCut[k]);
-        }
-        if (seenCuts.contains(cutHash)) {
-          continue;
-        }
-        seenCuts.insert(cutHash);
+  const size_t table_size = subject_.graph.tableSize();
+  std::vector<int> level(table_size, 0);
+  std::vector<int> last_use(table_size, 0);
+  std::vector<std::vector<Net>> levels;
 
-        // Try to match against library
-        NPN npn;
-        Truth6 sc = npnSemiclass(cutFunction, reducedLen, npn);
-        if (subject_.target_index->classes.contains({reducedLen, sc})) {
-          if (matchSlot < nmatches_max) {
-            ClassMatch& m = matchBuf[matchSlot];
-            m.semiclass = sc;
-            m.npn = npn;
-            for (int k = 0; k < reducedLen; k++) {
-              m.cut[k] = reducedCut[k];
-            }
-            for (int k = reducedLen; k < kCutMaximum; k++) {
-              m.cut[k] = Net::undef();
-            }
-            matchSlot++;
-            matchesTotal++;
-          }
-        }
+  subject_.graph.forEachNet([&](Net net, const Instance*, uint32_t) {
+    if (!isMappable(net)) {
+      return;
+    }
+    const GateFanins gate = gateFanins(net);
+    const uint32_t id1 = Graph::netId(gate.fanin1);
+    const uint32_t id2 = Graph::netId(gate.fanin2);
+    const int lvl = std::max(level[id1], level[id2]) + 1;
+    level[Graph::netId(net)] = lvl;
+    last_use[Graph::netId(net)] = lvl;
+    last_use[id1] = std::max(last_use[id1], lvl);
+    last_use[id2] = std::max(last_use[id2], lvl);
+    if ((int) levels.size() < lvl) {
+      levels.resize(lvl);
+    }
+    levels[lvl - 1].push_back(net);
+  });
 
-        // Store in priority cut cache
-        if (psSlot < npriority_cuts) {
-          auto& pc = pcuts[cur->fid * npriority_cuts + psSlot];
-          pc.ncut = reducedLen;
-          for (int k = 0; k < reducedLen; k++) {
-            pc.cut[k] = reducedCut[k];
-          }
-          for (int k = reducedLen; k < kCutMaximum; k++) {
-            pc.cut[k] = Net::sentinel();
-          }
-          pc.function = cutFunction;
-          psSlot++;
-        }
+  // Assign frontier slots level by level
+  std::vector<std::vector<uint32_t>> expiring(levels.size() + 1);
+  std::vector<uint32_t> freeSlots;
+  uint32_t frontierSize = 0;
+  for (size_t l = 0; l < levels.size(); l++) {
+    for (Net net : levels[l]) {
+      Node* cur = node(net);
+      if (!freeSlots.empty()) {
+        cur->fid = freeSlots.back();
+        freeSlots.pop_back();
+      } else {
+        cur->fid = frontierSize++;
       }
+      expiring[last_use[Graph::netId(net)]].push_back(cur->fid);
     }
+    freeSlots.insert(
+        freeSlots.end(), expiring[l + 1].begin(), expiring[l + 1].end());
+  }
 
-    lcache->ps = std::span<PriorityCut>(
-        &pcuts[static_cast<size_t>(cur->fid) * npriority_cuts], psSlot);
-    lcache->mark = net;
-    ClassMatch* allocatedBuf = allocMatches(matchSlot);
-    (void) allocatedBuf;
-    assert(allocatedBuf == matchBuf);
-    cur->matches = matchBuf;
-    cur->nmatches = matchSlot;
-  });
+  std::vector<PriorityCut> pcuts(
+      static_cast<size_t>(frontierSize) * npriority_cuts, PriorityCut{});
+  // Number of stored priority cuts per net; zero for non-mappable nets
+  std::vector<int> ncuts(table_size, 0);
 
+  auto faninCuts = [&](Net fanin) {
+    const int n = ncuts[Graph::netId(fanin)];
+    if (n == 0) {
+      return std::span<const PriorityCut>();
+    }
+    return std::span<const PriorityCut>(
+        &pcuts[static_cast<size_t>(node(fanin)->fid) * npriority_cuts], n);
+  };
+
+  std::vector<size_t> chunkMatches(num_threads_, 0);
+  utl::ThreadPool pool(num_threads_);
+  for (const std::vector<Net>& nets : levels) {
+    const int nchunks = std::clamp(
+        (int) nets.size() / kMinNodesPerThread, 1, num_threads_);
+    const size_t chunkSize = (nets.size() + nchunks - 1) / nchunks;
+
+    auto enumerateChunk = [&](const int chunk) {
+      MatchArena& arena = match_arenas_[chunk];
+      const size_t begin = chunk * chunkSize;
+      const size_t end = std::min(begin + chunkSize, nets.size());
+      for (size_t i = begin; i < end; i++) {
+        const Net net = nets[i];
+        Node* cur = node(net);
+        const std::span<PriorityCut> slot(
+            &pcuts[static_cast<size_t>(cur->fid) * npriority_cuts],
+            npriority_cuts);
+        ClassMatch* matchBuf = arena.reserve(nmatches_max);
+        const auto [ncut, nmatches]
+            = enumerateCuts(net,
+                            faninCuts,
+                            slot,
+                            {matchBuf, (size_t) nmatches_max},
+                            max_cut_len);
+        arena.alloc(nmatches);
+        ncuts[Graph::netId(net)] = ncut;
+        cur->matches = matchBuf;
+        cur->nmatches = nmatches;
+        chunkMatches[chunk] += nmatches;
+      }
+    };
+
+    if (nchunks == 1) {
+      enumerateChunk(0);
+      continue;
+    }
+    std::vector<int> chunks(nchunks);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    pool.parallelFor(chunks, enumerateChunk);
+  }
+
+  size_t matchesTotal = 0;
+  for (const size_t n : chunkMatches) {
+    matchesTotal += n;
+  }
   debugPrint(logger_, utl::SYN, "cm", 1, "matches total = {}", matchesTotal);
 }
 
@@ -713,17 +914,11 @@ void Mapping::areaFlowRound(const float refs_blend, const bool initial)
     for (int C = 0; C < 2; C++) {
       float bestArea = 1.0e30f;
       ClassMatch* bestMatch = nullptr;
-      MapTarget* bestTarget = nullptr;
+      const MapTarget* bestTarget = nullptr;
 
       for (int mi = 0; mi < nd->nmatches; mi++) {
         ClassMatch& m = nd->matches[mi];
-        auto it = subject_.target_index->classes.find(
-            {m.npn.ninputs(), m.semiclass});
-        if (it == subject_.target_index->classes.end()) {
-          continue;
-        }
-
-        for (auto& target : it->second) {
+        for (const MapTarget& target : *m.targets) {
           NPN localMap = target.via * m.npn;
           if (localMap.output_complement != (C != 0)) {
             continue;
@@ -800,17 +995,11 @@ void Mapping::exactRound()
 
       float bestArea = 1.0e30f;
       ClassMatch* bestMatch = nullptr;
-      MapTarget* bestTarget = nullptr;
+      const MapTarget* bestTarget = nullptr;
 
       for (int mi = 0; mi < nd->nmatches; mi++) {
         ClassMatch& m = nd->matches[mi];
-        const auto it = subject_.target_index->classes.find(
-            {m.npn.ninputs(), m.semiclass});
-        if (it == subject_.target_index->classes.end()) {
-          continue;
-        }
-
-        for (auto& target : it->second) {
+        for (const MapTarget& target : *m.targets) {
           const NPN localMap = target.via * m.npn;
           if (localMap.output_complement != (C != 0)) {
             continue;
@@ -974,8 +1163,10 @@ void Mapping::integrate()
 void mapCombinationals(Graph& g,
                        sta::Network* network,
                        utl::Logger* logger,
-                       const Synthesis& syn)
+                       const Synthesis& syn,
+                       const int num_threads)
 {
+  utl::TraceScope trace("syn::mapCombinationals");
   g.normalize();
 
   auto index = std::make_shared<cm::TargetIndex>();
@@ -993,7 +1184,7 @@ void mapCombinationals(Graph& g,
 
   g.normalize();
 
-  cm::Mapping state{logger, {.target_index = index, .graph = g}};
+  cm::Mapping state{logger, {.target_index = index, .graph = g}, num_threads};
   state.collectPrimaryOutputs();
   state.computeFanouts();
   state.prepareMatches(/*npriority_cuts=*/64,
@@ -3,7 +3,9 @@
 
 #pragma once
 
-#include <map>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -37,12 +39,25 @@ struct MapTarget
   NPN via;
 };
 
+struct ClassKeyHash
+{
+  std::size_t operator()(const std::pair<int, Truth6>& key) const
+  {
+    return std::hash<Truth6>()(key.second * 0x9e3779b97f4a7c15ULL
+                               + static_cast<Truth6>(key.first));
+  }
+};
+
 // Index of the available gates for fast lookup during combinational
 // mapping or resynthesis
 struct TargetIndex
 {
-  // The key is (num_inputs, canonical truth table)
-  std::map<std::pair<int, Truth6>, std::vector<MapTarget>> classes;
+  // The key is (num_inputs, canonical truth table).  Hashed since the
+  // mapper probes it once per enumerated cut.
+  std::unordered_map<std::pair<int, Truth6>,
+                     std::vector<MapTarget>,
+                     ClassKeyHash>
+      classes;
   sta::LibertyCell* inverter = nullptr;
   // The int is the output port index (0 or 1)
   std::pair<sta::LibertyCell*, int> tie_low;
@@ -317,13 +317,14 @@ void Synthesis::bitblast(bool blast_arith)
   syn::bitblast(*graph_, blast_arith);
 }
 
-void Synthesis::mapCombinationals()
+void Synthesis::mapCombinationals(int num_threads)
 {
   if (!graph_) {
     logger_->error(utl::SYN, 15, "No graph. Run syn::elaborate first.");
     return;
   }
-  syn::mapCombinationals(*graph_, sta_->network(), logger_, *this);
+  syn::mapCombinationals(
+      *graph_, sta_->network(), logger_, *this, num_threads);
 }
 
 void Synthesis::abcRoundtrip(const std::string& commands, int naming_threshold)
@@ -126,7 +126,7 @@ void
 map_combinationals_cmd()
 {
   syn::Synthesis* synthesis = ord::OpenRoad::openRoad()->getSynthesis();
-  synthesis->mapCombinationals();
+  synthesis->mapCombinationals(ord::OpenRoad::openRoad()->getThreadCount());
 }
 
 void
@@ -31,6 +31,7 @@
 #include "spdlog/fmt/ostr.h"
 #include "spdlog/logger.h"
 #include "utl/Metrics.h"
+#include "utl/PerfCounters.h"
 #if FMT_VERSION >= 110000
 #include "spdlog/fmt/ranges.h"
 #endif
@@ -213,6 +214,11 @@ class Logger
     log_metric(std::string(metric), '"' + value + '"');
   }
 
+  // Adds to a metric of the innermost stage that is written once, when the
+  // stage ends, or with the other metrics when there is no stage.  Used by
+  // PerfCounters for the deltas of repeated scopes.
+  void addStageMetric(const std::string& metric, uint64_t value);
+
   void setDebugLevel(ToolId tool, const char* group, int level);
 
   bool debugCheck(ToolId tool, const char* group, int level) const
@@ -327,6 +333,11 @@ class Logger
   }
 
   void flushMetrics();
+  // Hardware counters over the innermost metrics stage, reported as its
+  // perf__* metrics when the stage ends.
+  void beginPerfStage();
+  void endPerfStage();
+  void logStageMetrics(const std::map<std::string, uint64_t>& metrics);
   // Add new metrics for non-zero warnings. It also counts the number of
   // unique warning types.
   void addWarningMetrics();
@@ -357,6 +368,16 @@ class Logger
   std::vector<spdlog::sink_ptr> sinks_;
   std::shared_ptr<spdlog::logger> logger_;
   std::stack<std::string> metrics_stages_;
+  struct PerfStage
+  {
+    // Counters at the start of the stage
+    PerfCounts begin;
+    std::map<std::string, uint64_t> metrics;
+  };
+  // One for each entry of metrics_stages_
+  std::stack<PerfStage> perf_stages_;
+  // addStageMetric totals from outside any stage
+  std::map<std::string, uint64_t> unstaged_metrics_;
 
   // interface to handle string and file redirections
   std::unique_ptr<std::ostringstream> string_redirect_;
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace utl {
+
+class Logger;
+
+enum class PerfEvent
+{
+  kCycles,
+  kInstructions,
+  kLlcMisses,
+  kContextSwitches
+};
+
+constexpr int kNumPerfEvents = 4;
+
+const char* perfEventName(PerfEvent event);
+
+// A sample of the hardware and software event counters.  valid is false
+// when the counters were not running at the time of the sample.  The
+// difference of two samples is only valid if both are from the same
+// start() of the counters.
+struct PerfCounts
+{
+  std::array<uint64_t, kNumPerfEvents> values{};
+  int session = 0;
+  bool valid = false;
+
+  uint64_t operator[](PerfEvent event) const
+  {
+    return values[static_cast<int>(event)];
+  }
+  PerfCounts operator-(const PerfCounts& begin) const;
+};
+
+// Process-wide hardware performance counters read through Linux
+// perf_event_open.  They are off by default.  Once started, the deltas are
+// reported for every metrics stage (as perf__<event> metrics of the stage)
+// and for every PerfScope, in both the metrics JSON and the Prometheus
+// registry of the logger.
+//
+// The counters follow the threads created after they are opened, and a
+// read includes the work of those threads, so the ThreadPool and OpenMP
+// workers of a phase are counted.  Threads that already run when the
+// counters are opened are not.  openroad -perf_counters therefore opens
+// them in main() before any worker exists.  Events the kernel or CPU does
+// not provide (e.g. LLC misses in many VMs) are left out of the reports.
+// On other platforms open() and start() always fail.
+class PerfCounters
+{
+ public:
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  // Opens the counters without reporting them yet.  Returns false if no
+  // event could be opened.
+  static bool open();
+  // Reports the counters to `logger`, opening them first unless they are
+  // already open.  Returns false, leaving the counters off, if no event
+  // could be opened.
+  static bool start(Logger* logger);
+  static void stop();
+  // Stops the counters if they report to `logger`, which is going away.
+  static void detach(const Logger* logger);
+  static bool available(PerfEvent event);
+
+  // Totals since start().  Invalid when the counters are off.
+  static PerfCounts read();
+
+  // Scopes are only measured on the thread that started the counters.
+  // Its reads include the workers, so worker scopes would overlap it.
+  static bool isOwnerThread();
+  static void recordScope(const char* name, const PerfCounts& delta);
+  static void recordStage(const std::string& stage, const PerfCounts& delta);
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+// Reports the counter deltas over the lifetime of the enclosing scope
+// under `name`, which must outlive the scope.  A null name disables the
+// scope.  Every TraceScope carries one, so the traced hot phases are
+// measured without extra instrumentation.
+class PerfScope
+{
+ public:
+  explicit PerfScope(const char* name)
+  {
+    if (name && PerfCounters::enabled() && PerfCounters::isOwnerThread()) {
+      name_ = name;
+      begin_ = PerfCounters::read();
+    }
+  }
+  ~PerfScope() { end(); }
+
+  PerfScope(const PerfScope&) = delete;
+  PerfScope& operator=(const PerfScope&) = delete;
+
+  // Ends the measurement before the scope does.
+  void end()
+  {
+    if (name_) {
+      if (begin_.valid) {
+        PerfCounters::recordScope(name_, PerfCounters::read() - begin_);
+      }
+      name_ = nullptr;
+    }
+  }
+
+ private:
+  const char* name_ = nullptr;
+  PerfCounts begin_;
+};
+
+}  // namespace utl
@@ -20,6 +20,8 @@
 #include <utility>
 #include <vector>
 
+#include "utl/Trace.h"
+
 namespace utl {
 
 class ThreadPool;
@@ -118,11 +120,14 @@ class ThreadPool
 
     // Return a pool-aware future so callers can freely compose nested submit /
     // get() patterns without manually handling worker starvation.
+    size_t queue_depth;
     {
       std::lock_guard<std::mutex> lock(lock_);
       tasks_.emplace([task = std::move(packaged_task)]() { (*task)(); });
+      queue_depth = tasks_.size();
     }
     cv_.notify_one();
+    traceCounter("thread_pool_queue", queue_depth);
     return ThreadPoolFuture<Result>(this, lifetime_, std::move(future));
   }
 
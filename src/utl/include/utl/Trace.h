@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "utl/PerfCounters.h"
+
+namespace utl {
+
+// Process-wide recorder of timed spans and counter samples that is written
+// out in the Chrome trace event format (chrome://tracing or
+// ui.perfetto.dev).
+//
+// Recording is off by default and a TraceScope then costs two relaxed
+// atomic loads (this and PerfCounters).  While recording, each thread
+// appends to its own buffer without locking, so spans from ThreadPool
+// workers show up on separate tracks.  Span and counter names are stored
+// by pointer and must outlive the trace.  Pass string literals, or use the
+// std::string TraceScope constructor for names built at run time.
+//
+// start() discards the buffers of the previous trace and must not race
+// with traced work.  It is meant to be called between commands.
+class Tracer
+{
+ public:
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  // Drops any recorded events and starts recording.
+  static void start();
+  static void stop();
+  // Writes everything recorded since start().  Returns false if the file
+  // could not be opened.
+  static bool writeChromeTrace(const std::string& filename);
+
+  // Returns a copy of `name` that lives as long as the process.
+  static const char* intern(const std::string& name);
+
+  static int64_t beginSpan();
+  static void endSpan(const char* name, int64_t begin_ns);
+  static void recordCounter(const char* name, double value);
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+// Records the lifetime of the enclosing scope as a span named `name`, and
+// its hardware counters when PerfCounters are running.
+class TraceScope
+{
+ public:
+  explicit TraceScope(const char* name) : perf_(name)
+  {
+    if (Tracer::enabled()) {
+      name_ = name;
+      begin_ns_ = Tracer::beginSpan();
+    }
+  }
+  // For names built at run time; the name is only copied while recording.
+  explicit TraceScope(const std::string& name)
+      : perf_(PerfCounters::enabled() ? Tracer::intern(name) : nullptr)
+  {
+    if (Tracer::enabled()) {
+      name_ = Tracer::intern(name);
+      begin_ns_ = Tracer::beginSpan();
+    }
+  }
+  ~TraceScope() { end(); }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  // Ends the span before the scope does.
+  void end()
+  {
+    perf_.end();
+    if (name_) {
+      Tracer::endSpan(name_, begin_ns_);
+      name_ = nullptr;
+    }
+  }
+
+ private:
+  const char* name_ = nullptr;
+  int64_t begin_ns_ = 0;
+  PerfScope perf_;
+};
+
+// Adds a sample to the counter track `name` (e.g. a queue depth).
+inline void traceCounter(const char* name, double value)
+{
+  if (Tracer::enabled()) {
+    Tracer::recordCounter(name, value);
+  }
+}
+
+}  // namespace utl
@@ -24,6 +24,7 @@
 #include "spdlog/sinks/ostream_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "utl/Metrics.h"
+#include "utl/PerfCounters.h"
 #include "utl/Progress.h"
 #include "utl/prometheus/metrics_server.h"
 #include "utl/prometheus/registry.h"
@@ -69,6 +70,7 @@ Logger::Logger(const char* log_filename, const char* metrics_filename)
 Logger::~Logger()
 {
   finalizeMetrics();
+  PerfCounters::detach(this);
 }
 
 void Logger::addMetricsSink(const char* metrics_filename)
@@ -144,24 +146,34 @@ void Logger::setMetricsStage(std::string_view format)
   if (metrics_stages_.empty()) {
     metrics_stages_.emplace(format);
   } else {
+    endPerfStage();
     metrics_stages_.top() = format;
   }
+  beginPerfStage();
 }
 
 void Logger::clearMetricsStage()
 {
+  if (!metrics_stages_.empty()) {
+    // Only the innermost stage ends here; the others are dropped.
+    endPerfStage();
+  }
   std::stack<std::string> new_stack;
   metrics_stages_.swap(new_stack);
+  std::stack<PerfStage> new_perf_stages;
+  perf_stages_.swap(new_perf_stages);
 }
 
 void Logger::pushMetricsStage(std::string_view format)
 {
   metrics_stages_.emplace(format);
+  beginPerfStage();
 }
 
 std::string Logger::popMetricsStage()
 {
   if (!metrics_stages_.empty()) {
+    endPerfStage();
     std::string stage = metrics_stages_.top();
     metrics_stages_.pop();
     return stage;
@@ -169,6 +181,35 @@ std::string Logger::popMetricsStage()
   return "";
 }
 
+void Logger::beginPerfStage()
+{
+  perf_stages_.push({.begin = PerfCounters::read()});
+}
+
+void Logger::endPerfStage()
+{
+  PerfStage stage = std::move(perf_stages_.top());
+  perf_stages_.pop();
+  // Invalid if the counters were started or stopped during the stage
+  PerfCounters::recordStage(metrics_stages_.top(),
+                            PerfCounters::read() - stage.begin);
+  logStageMetrics(stage.metrics);
+}
+
+void Logger::addStageMetric(const std::string& metric, const uint64_t value)
+{
+  auto& metrics
+      = perf_stages_.empty() ? unstaged_metrics_ : perf_stages_.top().metrics;
+  metrics[metric] += value;
+}
+
+void Logger::logStageMetrics(const std::map<std::string, uint64_t>& metrics)
+{
+  for (const auto& [name, value] : metrics) {
+    metric(name, value);
+  }
+}
+
 void Logger::flushMetrics()
 {
   const std::string json = MetricsEntry::assembleJSON(metrics_entries_);
@@ -211,6 +252,9 @@ void Logger::finalizeMetrics()
   }
   metrics_finalized_ = true;
 
+  logStageMetrics(unstaged_metrics_);
+  unstaged_metrics_.clear();
+
   log_metric("flow__warnings__count", std::to_string(warning_count_));
   log_metric("flow__errors__count", std::to_string(error_count_));
 
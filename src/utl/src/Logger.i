@@ -4,6 +4,8 @@
 %{
 
 #include "utl/Logger.h"
+#include "utl/PerfCounters.h"
+#include "utl/Trace.h"
 #include "LoggerCommon.h"
     
 namespace ord {
@@ -105,6 +107,40 @@ void startPrometheusEndpoint(uint16_t port)
   logger->startPrometheusEndpoint(port);
 }
 
+void startTrace()
+{
+  utl::Tracer::start();
+}
+
+void stopTrace()
+{
+  utl::Tracer::stop();
+}
+
+void writeTrace(const std::string& filename)
+{
+  if (!utl::Tracer::writeChromeTrace(filename)) {
+    utl::Logger* logger = ord::getLogger();
+    logger->error(utl::UTL, 109, "Unable to write trace file {}.", filename);
+  }
+}
+
+void startPerfCounters()
+{
+  utl::Logger* logger = ord::getLogger();
+  if (!utl::PerfCounters::start(logger)) {
+    logger->warn(utl::UTL,
+                 110,
+                 "Hardware performance counters are not available "
+                 "(check /proc/sys/kernel/perf_event_paranoid).");
+  }
+}
+
+void stopPerfCounters()
+{
+  utl::PerfCounters::stop();
+}
+
 } // namespace
 
 %} // inline
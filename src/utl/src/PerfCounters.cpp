@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "utl/PerfCounters.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "utl/Logger.h"
+#include "utl/prometheus/counter.h"
+#include "utl/prometheus/family.h"
+#include "utl/prometheus/registry.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace utl {
+
+namespace {
+
+constexpr std::array<const char*, kNumPerfEvents> kEventNames
+    = {"cycles", "instructions", "llc_misses", "context_switches"};
+
+constexpr std::array<const char*, kNumPerfEvents> kEventHelp
+    = {"CPU cycles",
+       "Retired instructions",
+       "Last level cache misses",
+       "Context switches"};
+
+std::mutex state_lock;
+Logger* state_logger = nullptr;
+std::thread::id owner_thread;
+// Bumped by every successful start()
+int current_session = 0;
+// -1 for events that are not open
+std::array<int, kNumPerfEvents> fds = {-1, -1, -1, -1};
+std::array<Counter<double>::Family*, kNumPerfEvents> families{};
+
+#if defined(__linux__)
+int openEvent(const PerfEvent event)
+{
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  switch (event) {
+    case PerfEvent::kCycles:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case PerfEvent::kInstructions:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case PerfEvent::kLlcMisses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case PerfEvent::kContextSwitches:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+      break;
+  }
+  // User space only so that perf_event_paranoid=2 is enough.  Context
+  // switches happen in the kernel and would never be counted.
+  attr.exclude_kernel = event != PerfEvent::kContextSwitches;
+  attr.exclude_hv = 1;
+  // Follow the threads created from here on.  Reads of the counter include
+  // the counts of those threads, live or exited.
+  attr.inherit = 1;
+  attr.read_format
+      = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(
+      syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+uint64_t readEvent(const int fd)
+{
+  uint64_t data[3];  // value, time enabled, time running
+  if (::read(fd, data, sizeof(data)) != sizeof(data) || data[2] == 0) {
+    return 0;
+  }
+  if (data[2] < data[1]) {
+    // The event was multiplexed with others; extrapolate.
+    return static_cast<uint64_t>(static_cast<double>(data[0]) * data[1]
+                                 / data[2]);
+  }
+  return data[0];
+}
+
+void closeEvents()
+{
+  for (int& fd : fds) {
+    if (fd != -1) {
+      close(fd);
+      fd = -1;
+    }
+  }
+}
+#else
+int openEvent(const PerfEvent /* event */)
+{
+  return -1;
+}
+
+uint64_t readEvent(const int /* fd */)
+{
+  return 0;
+}
+
+void closeEvents()
+{
+}
+#endif
+
+// Expects state_lock to be held.
+bool openEvents()
+{
+  if (std::ranges::any_of(fds, [](const int fd) { return fd != -1; })) {
+    return true;
+  }
+  bool any_open = false;
+  for (int i = 0; i < kNumPerfEvents; i++) {
+    fds[i] = openEvent(static_cast<PerfEvent>(i));
+    any_open |= fds[i] != -1;
+  }
+  if (any_open) {
+    current_session++;
+    owner_thread = std::this_thread::get_id();
+  }
+  return any_open;
+}
+
+void record(const char* kind,
+            const std::string& name,
+            const std::string& metric_prefix,
+            const PerfCounts& delta,
+            const bool accumulate)
+{
+  if (!delta.valid) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(state_lock);
+  for (int i = 0; i < kNumPerfEvents; i++) {
+    if (fds[i] == -1) {
+      continue;
+    }
+    const std::string metric = metric_prefix + kEventNames[i];
+    if (accumulate) {
+      state_logger->addStageMetric(metric, delta.values[i]);
+    } else {
+      state_logger->metric(metric, delta.values[i]);
+    }
+    families[i]
+        ->Add({{"kind", kind}, {"name", name}})
+        .Increment(static_cast<double>(delta.values[i]));
+  }
+}
+
+// Scope names are free text (e.g. "DR: main"); metric keys are lower case
+// words joined by underscores.
+std::string metricKey(const std::string_view name)
+{
+  std::string key;
+  bool separate = false;
+  for (const char c : name) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '_') {
+      if (separate && !key.empty()) {
+        key += '_';
+      }
+      separate = false;
+      key += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    } else {
+      separate = true;
+    }
+  }
+  return key;
+}
+
+}  // namespace
+
+const char* perfEventName(const PerfEvent event)
+{
+  return kEventNames[static_cast<int>(event)];
+}
+
+PerfCounts PerfCounts::operator-(const PerfCounts& begin) const
+{
+  PerfCounts delta;
+  delta.session = session;
+  delta.valid = valid && begin.valid && session == begin.session;
+  for (int i = 0; i < kNumPerfEvents; i++) {
+    delta.values[i] = values[i] - begin.values[i];
+  }
+  return delta;
+}
+
+std::atomic<bool> PerfCounters::enabled_{false};
+
+bool PerfCounters::open()
+{
+  std::lock_guard<std::mutex> lock(state_lock);
+  return openEvents();
+}
+
+bool PerfCounters::start(Logger* logger)
+{
+  std::lock_guard<std::mutex> lock(state_lock);
+  if (!openEvents()) {
+    return false;
+  }
+
+  state_logger = logger;
+  std::shared_ptr<PrometheusRegistry> registry = logger->getRegistry();
+  for (int i = 0; i < kNumPerfEvents; i++) {
+    families[i] = &BuildCounter()
+                       .Name(std::string("ord_perf_") + kEventNames[i]
+                             + "_total")
+                       .Help(kEventHelp[i])
+                       .Register(*registry);
+  }
+  enabled_.store(true, std::memory_order_relaxed);
+  return true;
+}
+
+void PerfCounters::stop()
+{
+  std::lock_guard<std::mutex> lock(state_lock);
+  enabled_.store(false, std::memory_order_relaxed);
+  closeEvents();
+}
+
+void PerfCounters::detach(const Logger* logger)
+{
+  std::lock_guard<std::mutex> lock(state_lock);
+  if (state_logger == logger) {
+    enabled_.store(false, std::memory_order_relaxed);
+    closeEvents();
+    state_logger = nullptr;
+  }
+}
+
+bool PerfCounters::available(const PerfEvent event)
+{
+  return enabled() && fds[static_cast<int>(event)] != -1;
+}
+
+PerfCounts PerfCounters::read()
+{
+  PerfCounts counts;
+  if (!enabled()) {
+    return counts;
+  }
+  for (int i = 0; i < kNumPerfEvents; i++) {
+    if (fds[i] != -1) {
+      counts.values[i] = readEvent(fds[i]);
+    }
+  }
+  counts.session = current_session;
+  counts.valid = true;
+  return counts;
+}
+
+bool PerfCounters::isOwnerThread()
+{
+  return std::this_thread::get_id() == owner_thread;
+}
+
+void PerfCounters::recordScope(const char* name, const PerfCounts& delta)
+{
+  // A scope can run many times in a stage, so its deltas are summed and
+  // reported once for the stage.
+  record("scope",
+         name,
+         fmt::format("perf__{}__", metricKey(name)),
+         delta,
+         /*accumulate=*/true);
+}
+
+void PerfCounters::recordStage(const std::string& stage,
+                               const PerfCounts& delta)
+{
+  record("stage", stage, "perf__", delta, /*accumulate=*/false);
+}
+
+}  // namespace utl
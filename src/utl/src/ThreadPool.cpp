@@ -10,6 +10,8 @@
 #include <mutex>
 #include <utility>
 
+#include "utl/Trace.h"
+
 namespace utl {
 
 // Each thread keeps its own active-pool pointer so worker-only nested-wait
@@ -54,6 +56,7 @@ bool ThreadPool::isWorkerThreadFor(const ThreadPool* pool)
 bool ThreadPool::tryRunPendingTask()
 {
   std::function<void()> task;
+  size_t queue_depth;
   {
     std::lock_guard<std::mutex> lock(lock_);
     if (tasks_.empty()) {
@@ -62,8 +65,10 @@ bool ThreadPool::tryRunPendingTask()
 
     task = std::move(tasks_.front());
     tasks_.pop();
+    queue_depth = tasks_.size();
   }
 
+  traceCounter("thread_pool_queue", queue_depth);
   task();
   return true;
 }
@@ -77,6 +82,7 @@ void ThreadPool::workerLoop()
   while (true) {
     std::function<void()> task;
     bool exit_worker = false;
+    size_t queue_depth = 0;
     {
       std::unique_lock<std::mutex> lock(lock_);
       cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
@@ -85,11 +91,13 @@ void ThreadPool::workerLoop()
       } else {
         task = std::move(tasks_.front());
         tasks_.pop();
+        queue_depth = tasks_.size();
       }
     }
     if (exit_worker) {
       break;
     }
+    traceCounter("thread_pool_queue", queue_depth);
     task();
   }
   active_pool_ = previous_pool;
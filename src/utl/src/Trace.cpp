@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "utl/Trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "utl/mem_stats.h"
+
+namespace utl {
+
+namespace {
+
+struct TraceEvent
+{
+  const char* name;
+  int64_t begin_ns;
+  // Span end for spans, unused for counters
+  int64_t end_ns;
+  // Sample value for counters, unused for spans
+  double value;
+  bool is_counter;
+};
+
+constexpr int kChunkEvents = 4096;
+
+// Events are appended by the owning thread only.  count and next are
+// published with release stores so that a concurrent writeChromeTrace sees
+// fully written events.
+struct EventChunk
+{
+  TraceEvent events[kChunkEvents];
+  std::atomic<int> count{0};
+  std::atomic<EventChunk*> next{nullptr};
+};
+
+struct ThreadBuffer
+{
+  ThreadBuffer(int tid, bool is_trace_thread)
+      : tid(tid), is_trace_thread(is_trace_thread), tail(&head)
+  {
+  }
+  ~ThreadBuffer()
+  {
+    EventChunk* chunk = head.next.load(std::memory_order_relaxed);
+    while (chunk) {
+      EventChunk* next = chunk->next.load(std::memory_order_relaxed);
+      delete chunk;
+      chunk = next;
+    }
+  }
+
+  const int tid;
+  const bool is_trace_thread;
+  EventChunk head;
+  EventChunk* tail;
+};
+
+using Clock = std::chrono::steady_clock;
+
+std::mutex registry_lock;
+std::vector<std::unique_ptr<ThreadBuffer>> registry;
+// Bumped by start() so threads drop buffers of an earlier trace
+std::atomic<uint64_t> generation{0};
+Clock::time_point trace_start;
+std::thread::id trace_thread;
+
+// Interned run time names.  They are never released since events of any
+// trace may point at them.
+std::mutex names_lock;
+std::unordered_set<std::string> names;
+
+thread_local ThreadBuffer* local_buffer = nullptr;
+thread_local uint64_t local_generation = 0;
+thread_local int local_depth = 0;
+
+int64_t now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now()
+                                                              - trace_start)
+      .count();
+}
+
+ThreadBuffer* threadBuffer()
+{
+  const uint64_t gen = generation.load(std::memory_order_acquire);
+  if (local_buffer == nullptr || local_generation != gen) {
+    std::lock_guard<std::mutex> lock(registry_lock);
+    registry.push_back(std::make_unique<ThreadBuffer>(
+        registry.size(), std::this_thread::get_id() == trace_thread));
+    local_buffer = registry.back().get();
+    local_generation = gen;
+  }
+  return local_buffer;
+}
+
+void append(const TraceEvent& event)
+{
+  ThreadBuffer* buffer = threadBuffer();
+  EventChunk* chunk = buffer->tail;
+  int count = chunk->count.load(std::memory_order_relaxed);
+  if (count == kChunkEvents) {
+    auto* next = new EventChunk;
+    chunk->next.store(next, std::memory_order_release);
+    buffer->tail = chunk = next;
+    count = 0;
+  }
+  chunk->events[count] = event;
+  chunk->count.store(count + 1, std::memory_order_release);
+}
+
+void writeName(std::ostream& out, const char* name)
+{
+  out << '"';
+  for (const char* c = name; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      out << '\\';
+    }
+    out << *c;
+  }
+  out << '"';
+}
+
+// Chrome trace timestamps are in microseconds
+void writeMicros(std::ostream& out, const int64_t ns)
+{
+  out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+}  // namespace
+
+std::atomic<bool> Tracer::enabled_{false};
+
+void Tracer::start()
+{
+  std::lock_guard<std::mutex> lock(registry_lock);
+  registry.clear();
+  generation.fetch_add(1, std::memory_order_release);
+  trace_start = Clock::now();
+  trace_thread = std::this_thread::get_id();
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::stop()
+{
+  enabled_.store(false, std::memory_order_relaxed);
+}
+
+const char* Tracer::intern(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(names_lock);
+  return names.insert(name).first->c_str();
+}
+
+int64_t Tracer::beginSpan()
+{
+  local_depth++;
+  return now();
+}
+
+void Tracer::endSpan(const char* name, const int64_t begin_ns)
+{
+  const int64_t end_ns = now();
+  append({.name = name,
+          .begin_ns = begin_ns,
+          .end_ns = end_ns,
+          .value = 0,
+          .is_counter = false});
+  // Sample memory when a top level phase of the tracing thread finishes;
+  // doing it for every worker task would cost more than the tasks.
+  if (--local_depth == 0 && std::this_thread::get_id() == trace_thread) {
+    recordCounter("rss_mb", getCurrentRSS() / (1024.0 * 1024.0));
+  }
+}
+
+void Tracer::recordCounter(const char* name, const double value)
+{
+  append({.name = name,
+          .begin_ns = now(),
+          .end_ns = 0,
+          .value = value,
+          .is_counter = true});
+}
+
+bool Tracer::writeChromeTrace(const std::string& filename)
+{
+  std::ofstream out(filename);
+  if (!out) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(registry_lock);
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  bool first = true;
+  auto separator = [&]() {
+    if (!first) {
+      out << ",\n";
+    }
+    first = false;
+  };
+
+  for (const auto& buffer : registry) {
+    separator();
+    out << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << buffer->tid
+        << R"(,"args":{"name":")"
+        << (buffer->is_trace_thread ? "main"
+                                    : "thread " + std::to_string(buffer->tid))
+        << "\"}}";
+
+    for (const EventChunk* chunk = &buffer->head; chunk;
+         chunk = chunk->next.load(std::memory_order_acquire)) {
+      const int count = chunk->count.load(std::memory_order_acquire);
+      for (int i = 0; i < count; i++) {
+        const TraceEvent& event = chunk->events[i];
+        separator();
+        out << "{\"name\":";
+        writeName(out, event.name);
+        out << ",\"pid\":1,\"tid\":" << buffer->tid << ",\"ts\":";
+        writeMicros(out, event.begin_ns);
+        if (event.is_counter) {
+          out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value << "}}";
+        } else {
+          out << ",\"ph\":\"X\",\"dur\":";
+          writeMicros(out, event.end_ns - event.begin_ns);
+          out << '}';
+        }
+      }
+    }
+  }
+  out << "\n]}\n";
+  return static_cast<bool>(out);
+}
+
+}  // namespace utl
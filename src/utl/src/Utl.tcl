@@ -155,6 +155,24 @@ proc tee { args } {
   }
 }
 
+sta::define_cmd_args "start_trace" {}
+proc start_trace { args } {
+  sta::check_argc_eq0 "start_trace" $args
+  utl::startTrace
+}
+
+sta::define_cmd_args "stop_trace" {}
+proc stop_trace { args } {
+  sta::check_argc_eq0 "stop_trace" $args
+  utl::stopTrace
+}
+
+sta::define_cmd_args "write_trace" {filename}
+proc write_trace { args } {
+  sta::check_argc_eq1 "write_trace" $args
+  utl::writeTrace [file nativename [lindex $args 0]]
+}
+
 namespace eval utl {
 proc get_input { } {
   # Get the relative path from the user
@@ -193,3 +211,15 @@ proc check_valid_man_path { path } {
 
 # utl namespace end
 }
+
+sta::define_cmd_args "start_perf_counters" {}
+proc start_perf_counters { args } {
+  sta::check_argc_eq0 "start_perf_counters" $args
+  utl::startPerfCounters
+}
+
+sta::define_cmd_args "stop_perf_counters" {}
+proc stop_perf_counters { args } {
+  sta::check_argc_eq0 "stop_perf_counters" $args
+  utl::stopPerfCounters
+}
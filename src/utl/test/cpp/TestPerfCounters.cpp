@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+#include "utl/PerfCounters.h"
+
+namespace utl {
+
+namespace {
+
+std::string readFile(const std::string& path)
+{
+  std::ifstream in(path);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+// Keeps the counters busy without being optimized away.
+uint64_t spin()
+{
+  volatile uint64_t sum = 0;
+  for (int i = 0; i < 1000000; i++) {
+    sum = sum + i;
+  }
+  return sum;
+}
+
+}  // namespace
+
+TEST(PerfCounters, DisabledRecordsNothing)
+{
+  PerfCounters::stop();
+  EXPECT_FALSE(PerfCounters::read().valid);
+
+  const std::string path = testing::TempDir() + "/perf_disabled.json";
+  {
+    Logger logger(nullptr, path.c_str());
+    logger.pushMetricsStage("stage__{}");
+    {
+      PerfScope scope("ignored_scope");
+      spin();
+    }
+    logger.popMetricsStage();
+  }
+  const std::string metrics = readFile(path);
+  EXPECT_EQ(metrics.find("perf__"), std::string::npos);
+}
+
+TEST(PerfCounters, ClearEndsInnermostStage)
+{
+  const std::string path = testing::TempDir() + "/perf_clear.json";
+  {
+    Logger logger(nullptr, path.c_str());
+    const bool started = PerfCounters::start(&logger);
+    logger.pushMetricsStage("outer__{}");
+    logger.pushMetricsStage("inner__{}");
+    spin();
+    logger.clearMetricsStage();
+    EXPECT_EQ(logger.popMetricsStage(), "");
+    logger.metric("unstaged", 1);
+    if (!started) {
+      GTEST_SKIP() << "perf_event_open is not permitted in this runtime.";
+    }
+  }
+  const std::string metrics = readFile(path);
+  EXPECT_NE(metrics.find("\"unstaged\""), std::string::npos);
+  EXPECT_NE(metrics.find("\"inner__perf__"), std::string::npos);
+  EXPECT_EQ(metrics.find("\"outer__perf__"), std::string::npos);
+}
+
+TEST(PerfCounters, CountsThreadsCreatedAfterStart)
+{
+  const std::string path = testing::TempDir() + "/perf_threads.json";
+  Logger logger(nullptr, path.c_str());
+  if (!PerfCounters::start(&logger)
+      || !PerfCounters::available(PerfEvent::kContextSwitches)) {
+    GTEST_SKIP() << "perf_event_open is not permitted in this runtime.";
+  }
+
+  const PerfCounts begin = PerfCounters::read();
+  // Every sleep of the worker switches it out.
+  std::thread worker([] {
+    for (int i = 0; i < 20; i++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  worker.join();
+  const PerfCounts delta = PerfCounters::read() - begin;
+  ASSERT_TRUE(delta.valid);
+  // The starting thread only waits for the worker.
+  EXPECT_GE(delta[PerfEvent::kContextSwitches], 20);
+}
+
+TEST(PerfCounters, ScopesReportedOncePerStage)
+{
+  const std::string path = testing::TempDir() + "/perf_scopes.json";
+  std::string event;
+  {
+    Logger logger(nullptr, path.c_str());
+    if (!PerfCounters::start(&logger)) {
+      GTEST_SKIP() << "perf_event_open is not permitted in this runtime.";
+    }
+    for (int i = 0; i < kNumPerfEvents; i++) {
+      if (PerfCounters::available(static_cast<PerfEvent>(i))) {
+        event = perfEventName(static_cast<PerfEvent>(i));
+        break;
+      }
+    }
+
+    logger.pushMetricsStage("stage__{}");
+    for (int i = 0; i < 3; i++) {
+      PerfScope scope("DR: main");
+      spin();
+    }
+    logger.popMetricsStage();
+    {
+      PerfScope scope("gpl::nesterovPlace");
+      spin();
+    }
+  }
+
+  const std::string metrics = readFile(path);
+  const std::string staged = "\"stage__perf__dr_main__" + event + "\"";
+  const size_t first = metrics.find(staged);
+  EXPECT_NE(first, std::string::npos);
+  EXPECT_EQ(metrics.find(staged, first + 1), std::string::npos);
+  EXPECT_EQ(metrics.find("DR: main"), std::string::npos);
+  // Scopes outside of any stage are reported with the final metrics.
+  EXPECT_NE(metrics.find("\"perf__gpl_nesterovplace__" + event + "\""),
+            std::string::npos);
+}
+
+TEST(PerfCounters, StagesAndScopes)
+{
+  const std::string path = testing::TempDir() + "/perf_enabled.json";
+  {
+    Logger logger(nullptr, path.c_str());
+    if (!PerfCounters::start(&logger)) {
+      GTEST_SKIP() << "perf_event_open is not permitted in this runtime.";
+    }
+    ASSERT_TRUE(PerfCounters::available(PerfEvent::kContextSwitches)
+                || PerfCounters::available(PerfEvent::kCycles)
+                || PerfCounters::available(PerfEvent::kInstructions)
+                || PerfCounters::available(PerfEvent::kLlcMisses));
+
+    logger.pushMetricsStage("stage__{}");
+    {
+      PerfScope scope("busy");
+      spin();
+    }
+    logger.popMetricsStage();
+
+    if (PerfCounters::available(PerfEvent::kInstructions)) {
+      const PerfCounts begin = PerfCounters::read();
+      spin();
+      const PerfCounts delta = PerfCounters::read() - begin;
+      ASSERT_TRUE(delta.valid);
+      EXPECT_GT(delta[PerfEvent::kInstructions], 1000000);
+    }
+    // The logger detaches the counters when it goes away.
+  }
+  EXPECT_FALSE(PerfCounters::enabled());
+
+  const std::string metrics = readFile(path);
+  EXPECT_NE(metrics.find("\"stage__perf__"), std::string::npos);
+  EXPECT_NE(metrics.find("\"stage__perf__busy__"), std::string::npos);
+}
+
+}  // namespace utl
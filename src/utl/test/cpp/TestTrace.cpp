@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utl/Trace.h"
+
+namespace utl {
+
+namespace {
+
+std::string readFile(const std::string& path)
+{
+  std::ifstream in(path);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+int countOccurrences(const std::string& text, const std::string& pattern)
+{
+  int count = 0;
+  for (size_t pos = text.find(pattern); pos != std::string::npos;
+       pos = text.find(pattern, pos + pattern.size())) {
+    count++;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(Trace, DisabledRecordsNothing)
+{
+  Tracer::start();
+  Tracer::stop();
+  {
+    TraceScope scope("ignored_span");
+    traceCounter("ignored_counter", 1);
+  }
+  const std::string path = testing::TempDir() + "/trace_disabled.json";
+  ASSERT_TRUE(Tracer::writeChromeTrace(path));
+  const std::string trace = readFile(path);
+  EXPECT_EQ(trace.find("ignored_span"), std::string::npos);
+  EXPECT_EQ(trace.find("ignored_counter"), std::string::npos);
+}
+
+TEST(Trace, SpansFromEveryThread)
+{
+  constexpr int kThreads = 4;
+  // More than one buffer chunk per thread
+  constexpr int kSpans = 5000;
+
+  Tracer::start();
+  {
+    TraceScope outer("outer");
+    std::vector<std::thread> threads;
+    threads.reserve(kThreads);
+    for (int t = 0; t < kThreads; t++) {
+      threads.emplace_back([]() {
+        for (int i = 0; i < kSpans; i++) {
+          TraceScope scope("inner");
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    traceCounter("depth", 3);
+  }
+  Tracer::stop();
+
+  const std::string path = testing::TempDir() + "/trace_threads.json";
+  ASSERT_TRUE(Tracer::writeChromeTrace(path));
+  const std::string trace = readFile(path);
+  EXPECT_EQ(countOccurrences(trace, R"("name":"inner")"), kThreads * kSpans);
+  EXPECT_EQ(countOccurrences(trace, R"("name":"outer")"), 1);
+  EXPECT_EQ(countOccurrences(trace, R"("name":"depth")"), 1);
+  // The outer span closes the top level phase of the tracing thread.
+  EXPECT_EQ(countOccurrences(trace, R"("name":"rss_mb")"), 1);
+  EXPECT_EQ(countOccurrences(trace, R"("name":"thread_name")"), kThreads + 1);
+}
+
+TEST(Trace, EndClosesSpanEarly)
+{
+  Tracer::start();
+  {
+    TraceScope scope("early");
+    scope.end();
+  }
+  Tracer::stop();
+
+  const std::string path = testing::TempDir() + "/trace_end.json";
+  ASSERT_TRUE(Tracer::writeChromeTrace(path));
+  EXPECT_EQ(countOccurrences(readFile(path), R"("name":"early")"), 1);
+}
+
+TEST(Trace, UnwritablePath)
+{
+  EXPECT_FALSE(Tracer::writeChromeTrace("/nonexistent_dir/trace.json"));
+}
+
+}  // namespace utl